@@ -16,7 +16,7 @@ void FireCannon()
                 // If we are a repair tank, we immobilze the tank when firing the repair signal. 
                 // This is very similar to what we do if we *receive* a repair signal
                 RepairOngoing = REPAIR_OTHER;   // This marks the start of a repair operation - we are repairing an other vehicle
-                if (DEBUG) { DebugSerial->println(F("Fire Repair Signal")); }
+                if (DEBUG) { DebugLog.write(LOG_FIRE_REPAIR); }
                 
                 // Disengage the transmission - we will keep it in neutral until the repair is over. 
                 // Even if the user tries to re-engage it, the TransmissionEngage() function will check if a repair is ongoing, if so, it won't do anything. 
@@ -32,7 +32,7 @@ void FireCannon()
             // This is a fighting tank. But we can't fire the cannon if we're in the midst of being repaired by another tank.
             if (!Tank.isRepairOngoing())
             {
-                if (DEBUG) { DebugSerial->println(F("Fire Cannon")); } 
+                if (DEBUG) { DebugLog.write(LOG_FIRE_CANNON); } 
                 Tank.Fire(); // See OP_Tank library. This triggers the mechanical and servo recoils, the high intensity flash unit, the cannon sound, and it sends the IR signal
             }
         }
@@ -49,12 +49,12 @@ void FireCannon()
 void MG_Start()
 {   
     Tank.MachineGun();
-    if (DEBUG) {DebugSerial->println(F("MG Start"));}
+    if (DEBUG) {DebugLog.write(LOG_MG_START);}
 }
 void MG_Stop()
 {
     Tank.MachineGun_Stop();
-    if (DEBUG) {DebugSerial->println(F("MG Stop"));}
+    if (DEBUG) {DebugLog.write(LOG_MG_STOP);}
 }
 
 
@@ -67,11 +67,7 @@ void MG_Stop()
 void MechBarrel()
 {
     Tank.TriggerMechBarrel();
-    if (DEBUG) 
-    { 
-        if (eeprom.ramcopy.Airsoft) DebugSerial->println(F("Airsoft - Manual Trigger")); 
-        else DebugSerial->println(F("Mechanical Recoil - Manual Trigger")); 
-    }
+    if (DEBUG) DebugLog.write(LOG_MANUAL_TRIGGER, eeprom.ramcopy.Airsoft ? F("Airsoft") : F("Mechanical Recoil"));
 }
 // These functions let us include or not include the mechanical barrel action with the CannonFire function (mechanical barrel is either Airsoft or mechanical recoil unit, whichever the user has specified). 
 // The setting can be specified once in OP Config, but the user may also want to change it on the fly - for example if they have a combination airsoft/IR setup, they may want to fire the IR on occasion
@@ -79,20 +75,12 @@ void MechBarrel()
 void MechBarrel_Enable()
 {
     Tank.SetMechBarrelWithCannon(true);
-    if (DEBUG)
-    { 
-        if (eeprom.ramcopy.Airsoft) DebugSerial->println(F("Airsoft - Enabled")); 
-        else DebugSerial->println(F("Mechanical Recoil - Enabled"));     
-    }
+    if (DEBUG) DebugLog.write(LOG_MECH_BARREL_ENABLE, eeprom.ramcopy.Airsoft ? F("Airsoft") : F("Mechanical Recoil"));
 }
 void MechBarrel_Disable()
 {
     Tank.SetMechBarrelWithCannon(false);
-    if (DEBUG)
-    { 
-        if (eeprom.ramcopy.Airsoft) DebugSerial->println(F("Airsoft - Disabled")); 
-        else DebugSerial->println(F("Mechanical Recoil - Disabled"));     
-    }
+    if (DEBUG) DebugLog.write(LOG_MECH_BARREL_DISABLE, eeprom.ramcopy.Airsoft ? F("Airsoft") : F("Mechanical Recoil"));
 }
 void MechBarrel_Toggle()
 {
@@ -112,7 +100,7 @@ void MechBarrel_Toggle()
 void TriggerServoRecoil()
 {
     RecoilServo->Recoil();
-    if (DEBUG) { DebugSerial->println(F("Servo Recoil - Manual Trigger")); }
+    if (DEBUG) { DebugLog.write(LOG_MANUAL_TRIGGER, F("Servo Recoil")); }
 }
 
 // SPECIAL FUNCTIONS: Trigger Muzzle Flash
@@ -122,7 +110,7 @@ void TriggerServoRecoil()
 void MuzzleFlash()
 {
     Tank.TriggerMuzzleFlash();
-    if (DEBUG) { DebugSerial->println(F("High Intensity Flash Unit - Manual Trigger")); }
+    if (DEBUG) { DebugLog.write(LOG_MANUAL_TRIGGER, F("High Intensity Flash Unit")); }
 }
 
 
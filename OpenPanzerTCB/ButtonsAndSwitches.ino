@@ -87,14 +87,14 @@ void SetActiveCommPort()
         {
             PCComm.switchToAltSerial();     // Use Serial 1 for PC comm
             DebugSerial = &Serial1;         // Use Serial 1 for debugging messages
-            if (DEBUG) DebugSerial->println(F("Comms changed to Serial 1"));        
+            if (DEBUG) DebugLog.write(LOG_COMMS_CHANGED, F("Serial 1"));        
             useAlternate = 0xFF;
         }
         else if (!UseAuxSerialForPCComm() && useAlternate == 0xFF)
         {
             PCComm.revertToDefaultSerial(); // Use Serial 0 for PC comm
             DebugSerial = &Serial;          // Use Serial 0 for debugging messages
-            if (DEBUG) DebugSerial->println(F("Comms changed to USB"));        
+            if (DEBUG) DebugLog.write(LOG_COMMS_CHANGED, F("USB"));        
             useAlternate = 0x00;
         }
     }
@@ -114,11 +114,11 @@ boolean DipSwitchOff(uint8_t switchNum)
 {   
     switch (switchNum)
     {
-        case 1:     return digitalRead(pin_Dip1);   break;
-        case 2:     return digitalRead(pin_Dip2);   break;
-        case 3:     return digitalRead(pin_Dip3);   break;
-        case 4:     return digitalRead(pin_Dip4);   break;
-        case 5:     return digitalRead(pin_Dip5);   break;
+        case 1:     return PIN_READ(pin_Dip1);   break;
+        case 2:     return PIN_READ(pin_Dip2);   break;
+        case 3:     return PIN_READ(pin_Dip3);   break;
+        case 4:     return PIN_READ(pin_Dip4);   break;
+        case 5:     return PIN_READ(pin_Dip5);   break;
         default:    return false;
     }        
 }
@@ -37,11 +37,7 @@ void SetDrivingProfile(uint8_t profile)
     {
         DrivingProfile = profile;
 
-        if (DEBUG)
-        {
-            DebugSerial->print(F("Driving Profile set to #"));
-            DebugSerial->println(profile);
-        }
+        if (DEBUG) DebugLog.write(LOG_DRIVING_PROFILE, profile);
     }
 }
 
@@ -116,9 +112,10 @@ void UpdateEngineIdleTimer()
     if (eeprom.ramcopy.EngineAutoStopTime_mS > 0)
     {
         if (TankEngine.Running())
-        {
-            if (timer.isEnabled(IdleOffTimerID)) timer.restartTimer(IdleOffTimerID);
-            else IdleOffTimerID = timer.setTimeout(eeprom.ramcopy.EngineAutoStopTime_mS, EngineIdleOff);
+        {   // This gets called every time through the loop while we are moving, so all we do is mark the time. CheckEngineIdleTimer() will turn the engine off 
+            // once EngineAutoStopTime_mS has passed since the last mark. 
+            IdleOffStart = millis();
+            IdleOffArmed = true;
         }
         else
         {
@@ -129,8 +126,16 @@ void UpdateEngineIdleTimer()
 }
 void StopEngineIdleTimer()
 {
-    if (timer.isEnabled(IdleOffTimerID)) timer.deleteTimer(IdleOffTimerID);
-    IdleOffTimerID = 0;
+    IdleOffArmed = false;
+}
+void CheckEngineIdleTimer()
+{
+    // Called from UpdateSimpleTimers() along with the rest of the timers
+    if (IdleOffArmed && (millis() - IdleOffStart) >= (uint32_t)eeprom.ramcopy.EngineAutoStopTime_mS)
+    {
+        IdleOffArmed = false;
+        EngineIdleOff();
+    }
 }
 void EngineIdleOff()
 {
@@ -139,7 +144,7 @@ void EngineIdleOff()
     if (TankEngine.Running()) 
     {
         EngineOff();
-        if (DEBUG) DebugSerial->println(F("Engine Auto Shutdown"));
+        if (DEBUG) DebugLog.write(LOG_ENGINE_AUTO_SHUTDOWN);
     }
 }
 
@@ -175,16 +180,16 @@ void TransmissionToggle()
 
 // SPECIAL FUNCTIONS: Turn Mode
 // ----------------------------------------------------------------------------------------------------------------------------------------------->>
-void SF_TurnMode1(uint16_t ignoreMe)            { if (Driver.getTurnMode() != 1) { Driver.setTurnMode(1); if (DEBUG) DebugSerial->println(F("Set Turn Mode: 1")); } }
-void SF_TurnMode2(uint16_t ignoreMe)            { if (Driver.getTurnMode() != 2) { Driver.setTurnMode(2); if (DEBUG) DebugSerial->println(F("Set Turn Mode: 2")); } }
-void SF_TurnMode3(uint16_t ignoreMe)            { if (Driver.getTurnMode() != 3) { Driver.setTurnMode(3); if (DEBUG) DebugSerial->println(F("Set Turn Mode: 3")); } }
+void SF_TurnMode1(uint16_t ignoreMe)            { if (Driver.getTurnMode() != 1) { Driver.setTurnMode(1); if (DEBUG) DebugLog.write(LOG_TURN_MODE, 1); } }
+void SF_TurnMode2(uint16_t ignoreMe)            { if (Driver.getTurnMode() != 2) { Driver.setTurnMode(2); if (DEBUG) DebugLog.write(LOG_TURN_MODE, 2); } }
+void SF_TurnMode3(uint16_t ignoreMe)            { if (Driver.getTurnMode() != 3) { Driver.setTurnMode(3); if (DEBUG) DebugLog.write(LOG_TURN_MODE, 3); } }
 
 
 // SPECIAL FUNCTIONS: Neutral Turns
 // ----------------------------------------------------------------------------------------------------------------------------------------------->>
 // Only enable neutral turns for tanks and halftracks, not cars. 
-void SF_NT_Enable(uint16_t ignoreMe)            { if (eeprom.ramcopy.DriveType != DT_CAR && Driver.getNeutralTurnAllowed() == false) { Driver.setNeutralTurnAllowed(true);  if (DEBUG) DebugSerial->println(F("Enable Neutral Turns"));  } }
-void SF_NT_Disable(uint16_t ignoreMe)           { if (Driver.getNeutralTurnAllowed() == true ) { Driver.setNeutralTurnAllowed(false); if (DEBUG) DebugSerial->println(F("Disable Neutral Turns")); } }
+void SF_NT_Enable(uint16_t ignoreMe)            { if (eeprom.ramcopy.DriveType != DT_CAR && Driver.getNeutralTurnAllowed() == false) { Driver.setNeutralTurnAllowed(true);  if (DEBUG) DebugLog.write(LOG_NEUTRAL_TURN_ENABLE);  } }
+void SF_NT_Disable(uint16_t ignoreMe)           { if (Driver.getNeutralTurnAllowed() == true ) { Driver.setNeutralTurnAllowed(false); if (DEBUG) DebugLog.write(LOG_NEUTRAL_TURN_DISABLE); } }
 void SF_NT_Toggle(uint16_t ignoreMe)            { Driver.getNeutralTurnAllowed() ? SF_NT_Disable(0) : SF_NT_Enable(0); }
 
 
@@ -194,11 +199,11 @@ void StopDriveMotors()
 {
     switch (eeprom.ramcopy.DriveType)
     {
-        case DT_TANK:       { RightTread->stop(); LeftTread->stop();     }  break;
-        case DT_HALFTRACK:  { RightTread->stop(); LeftTread->stop();     }  break;
-        case DT_CAR:        { DriveMotor->stop();                        }  break;
-        case DT_DKLM:       { DriveMotor->stop(); SteeringMotor->stop(); }  break;
-        default:                                                            break;
+        case DT_TANK:       { RightTread->stop(); LeftTread->stop(); TrackSpeed.stop(); }  break;
+        case DT_HALFTRACK:  { RightTread->stop(); LeftTread->stop(); TrackSpeed.stop(); }  break;
+        case DT_CAR:        { DriveMotor->stop();                                       }  break;
+        case DT_DKLM:       { DriveMotor->stop(); SteeringMotor->stop();                }  break;
+        default:                                                                           break;
     }
 }
 
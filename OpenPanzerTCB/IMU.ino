@@ -5,15 +5,6 @@
 // on the fly. 
 
 
-// We use this to restrict how often we sample the IMU. After each sample the IMU_ReadyToSample flag is set to false.
-// A timer is started that will last for SampleIMU_Delay length of time. While ReadyToSample = false, no samples will be taken.
-// When the timer expires it calls this function which sets the ready flag to True, and a new sample is taken, starting
-// the process over again. 
-void SetReadyToSample(void)
-{
-    IMU_ReadyToSample = true;
-}
-
 void EnableBarrelStabilization(boolean enable)
 {
     // We can't just enable barrel stabilization because the user says so. Several other conditions
@@ -22,17 +13,12 @@ void EnableBarrelStabilization(boolean enable)
     {   // Ok, we can enable barrel stabilization
         eeprom.ramcopy.EnableBarrelStabilize = true;
         UseIMU = true;    // Make sure we're taking readings
-        if (DEBUG) 
-        {
-            DebugSerial->print(F("Barrel Stabilization: Turned ON"));
-            PrintBarrelSensitivity();
-            DebugSerial->println();
-        }
+        if (DEBUG) DebugLog.write(LOG_BARREL_STAB_ON, BarrelSensitivity);
     }
     else
     {
         eeprom.ramcopy.EnableBarrelStabilize = false;
-        if (DEBUG) DebugSerial->println(F("Barrel Stabilization: Turned OFF"));
+        if (DEBUG) DebugLog.write(LOG_BARREL_STAB_OFF);
         // If hill physics is also disabled, just quit using accelerometer completely
         // (If UseAccel = false, we won't bother taking readings, which are time-consuming)
         if (eeprom.ramcopy.EnableHillPhysics == false)
@@ -54,17 +40,12 @@ void EnableHillPhysics(boolean enable)
     {
         eeprom.ramcopy.EnableHillPhysics = true;
         UseIMU = true;    // Make sure we're taking readings
-        if (DEBUG) 
-        {
-            DebugSerial->print(F("Hill Physics: Turned ON"));
-            PrintHillSensitivity();
-            DebugSerial->println();
-        }
+        if (DEBUG) DebugLog.write(LOG_HILL_PHYSICS_ON, HillSensitivity);
     }
     else
     {
         eeprom.ramcopy.EnableHillPhysics = false;
-        if (DEBUG) DebugSerial->println(F("Hill Physics: Turned OFF"));
+        if (DEBUG) DebugLog.write(LOG_HILL_PHYSICS_OFF);
         // If barrel stabilization is also disabled, just quit using accelerometer completely
         // (If UseAccel = false, we won't bother taking readings, which are time-consuming)
         if (eeprom.ramcopy.EnableBarrelStabilize == false)
@@ -79,3 +60,16 @@ void ToggleHillPhysics()
     EnableHillPhysics(!eeprom.ramcopy.EnableHillPhysics);
 }
 
+
+// The barrel and hill math in the main loop is all integer, using scale factors that only change when the sensitivity does (or for the barrel, the servo
+// end-points). These work them out again. Call them whenever one of those changes. 
+void SetBarrelStabilizationScale()
+{
+    Incline.setBarrelScale(BarrelSensitivity, eeprom.ramcopy.TurretElevation_EPMin, eeprom.ramcopy.TurretElevation_EPMax, eeprom.ramcopy.TurretElevation_Reversed);
+}
+
+void SetHillPhysicsScale()
+{
+    Incline.setHillScale(HillSensitivity);
+}
+
@@ -12,7 +12,7 @@ void SetActiveInputFlag(void)
     for (int i=0; i<NUM_IO_PORTS; i++)
     {
         IO_Pin[i].inputActive = false;   // Start off with Active = false
-        if (IO_Pin[i].Settings.dataDirection == INPUT)
+        if (IO_Pin[i].Settings.dataDirection == INPUT && IO_Pin[i].Settings.dataType != IO_INPUT_ENCODER)   // Encoder inputs belong to the speed loop
         {
             for (int t = 0; t <MAX_FUNCTION_TRIGGERS; t++)
             {   
@@ -31,6 +31,18 @@ void SetActiveInputFlag(void)
     //PrintLnYesNo(IO_Pin[1].inputActive);
 }
 
+// Closed-loop track speed. If both ports are set to encoder inputs they count pulses from sensors on the left (A) and right (B) track drives, and
+// the tread motors are run through the speed loop in OP_TrackSpeed. That only means something for vehicles with independent treads. 
+void StartTrackSpeed()
+{
+    if (IO_Pin[IOA].Settings.dataDirection == INPUT && IO_Pin[IOA].Settings.dataType == IO_INPUT_ENCODER &&
+        IO_Pin[IOB].Settings.dataDirection == INPUT && IO_Pin[IOB].Settings.dataType == IO_INPUT_ENCODER &&
+        (eeprom.ramcopy.DriveType == DT_TANK || eeprom.ramcopy.DriveType == DT_HALFTRACK))
+    {
+        TrackSpeed.begin(EEPROM_VAR(EncoderFullSpeedCPS), EEPROM_VAR(SpeedLoop_Kp), EEPROM_VAR(SpeedLoop_Ki));
+    }
+}
+
 void ReadIOPorts()
 {
     // No point doing analog reads every loop if these are not set as inputs to some function,
@@ -49,18 +61,18 @@ void PortA_On()
 {   // For safety, we only do anything if this has been set to output
     if (isPortA_Output()) 
     { 
-        digitalWrite(pin_IO_A, HIGH);
+        PIN_HIGH(pin_IO_A);
         IO_Pin[IOA].outputValue = HIGH;
-        if (DEBUG) { DebugSerial->println(F("IO Port A Output - On")); }
+        if (DEBUG) { DebugLog.write(LOG_IO_OUTPUT_ON, F("A")); }
     }
 }
 void PortA_Off()
 {   // For safety, we only do anything if this has been set to output
     if (isPortA_Output()) 
     { 
-        digitalWrite(pin_IO_A, LOW);
+        PIN_LOW(pin_IO_A);
         IO_Pin[IOA].outputValue = LOW;
-        if (DEBUG) { DebugSerial->println(F("IO Port A Output - Off")); }
+        if (DEBUG) { DebugLog.write(LOG_IO_OUTPUT_OFF, F("A")); }
     }
 }
 void PortA_Toggle()
@@ -118,18 +130,18 @@ void PortB_On()
 {   // For safety, we only do anything if this has been set to output
     if (isPortB_Output()) 
     { 
-        digitalWrite(pin_IO_B, HIGH);
+        PIN_HIGH(pin_IO_B);
         IO_Pin[IOB].outputValue = HIGH;
-        if (DEBUG) { DebugSerial->println(F("IO Port B Output - On")); }
+        if (DEBUG) { DebugLog.write(LOG_IO_OUTPUT_ON, F("B")); }
     }
 }
 void PortB_Off()
 {   // For safety, we only do anything if this has been set to output
     if (isPortB_Output()) 
     { 
-        digitalWrite(pin_IO_B, LOW);
+        PIN_LOW(pin_IO_B);
         IO_Pin[IOB].outputValue = LOW;
-        if (DEBUG) { DebugSerial->println(F("IO Port B Output - Off")); }
+        if (DEBUG) { DebugLog.write(LOG_IO_OUTPUT_OFF, F("B")); }
     }
 }
 void PortB_Toggle()
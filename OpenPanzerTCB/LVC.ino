@@ -25,9 +25,8 @@ void CheckVoltage(void)
             HavePower = false;
             if (DEBUG) 
             {
-                DebugSerial->print(F("LVC threshold reached! ("));
-                DumpLVC_Voltage();
-                DebugSerial->println(F("v)"));
+                uint16_t tenths = (eeprom.ramcopy.LVC_Cutoff_mV + 50) / 100;   // Cutoff voltage rounded to one decimal
+                DebugLog.write(LOG_LVC_CUTOFF, tenths / 10, tenths % 10);
             }
             StopEverything();
             LVC_BlinkHandler();                 // Start the special blinker to indicate LVC
@@ -37,7 +36,7 @@ void CheckVoltage(void)
             // Restore power
             LVC = false;
             HavePower = true;
-            if (DEBUG) DebugSerial->println(F("LVC Exit - Voltage Restored"));
+            if (DEBUG) DebugLog.write(LOG_LVC_EXIT);
         }
     }
 }
@@ -4,16 +4,16 @@
 // Light 1 also has the option of triggering a headlight sound
 void Light1On()
 {
-    digitalWrite(pin_Light1, HIGH);    
+    PIN_HIGH(pin_Light1);    
     TankSound->HeadlightSound(); // The sound object will automatically ignore this if the headlight sound was disabled
-    if (DEBUG) { DebugSerial->println(F("Light 1 On")); }
+    if (DEBUG) { DebugLog.write(LOG_LIGHT_ON, 1); }
 }
 
 void Light1Off()
 {
-    digitalWrite(pin_Light1, LOW);
+    PIN_LOW(pin_Light1);
     TankSound->HeadlightSound(); // The sound object will automatically ignore this if the headlight sound was disabled
-    if (DEBUG) { DebugSerial->println(F("Light 1 Off")); }
+    if (DEBUG) { DebugLog.write(LOG_LIGHT_OFF, 1); }
 }
 
 void Light1Toggle()
@@ -28,14 +28,14 @@ void Light1Toggle()
 // -------------------------------------------------------------------------------------------------------------------------------------------------->
 void Light2On()
 {
-    digitalWrite(pin_Light2, HIGH);    
-    if (DEBUG) { DebugSerial->println(F("Light 2 On")); }
+    PIN_HIGH(pin_Light2);    
+    if (DEBUG) { DebugLog.write(LOG_LIGHT_ON, 2); }
 }
 
 void Light2Off()
 {
-    digitalWrite(pin_Light2, LOW);
-    if (DEBUG) { DebugSerial->println(F("Light 2 Off")); }
+    PIN_LOW(pin_Light2);
+    if (DEBUG) { DebugLog.write(LOG_LIGHT_OFF, 2); }
 }
 
 void Light2Toggle()
@@ -51,7 +51,8 @@ void Light2Toggle()
 void BrakeLightsOn()
 {
     BrakeLightsActive = true;
-    digitalWrite(pin_Brakelights, HIGH);
+    PIN_PWM_OFF(pin_Brakelights);
+    PIN_HIGH(pin_Brakelights);
 }
 
 void BrakeLightsOff()
@@ -61,7 +62,8 @@ void BrakeLightsOff()
     // But just because we are turning off the brake lights, doesn't necessarily mean we are turning off the *running* lights
     if (RunningLightsActive == false)
     {   // If the running lighs aren't active, we can turn these off
-        digitalWrite(pin_Brakelights, LOW);                
+        PIN_PWM_OFF(pin_Brakelights);
+        PIN_LOW(pin_Brakelights);                
     }
     else
     {   // Otherwise set them to the dim level
@@ -79,7 +81,7 @@ void RunningLightsOn()
     {   // But we only set the dim level if the brake lights aren't on
         analogWrite(pin_Brakelights, RunningLightsDimLevel);
     }
-    if (DEBUG) { DebugSerial->println(F("Running Lights On")); }
+    if (DEBUG) { DebugLog.write(LOG_RUNNING_LIGHTS_ON); }
 }
 
 void RunningLightsOff()
@@ -89,9 +91,10 @@ void RunningLightsOff()
     // But just because we want to turn off the running lights, doesn't necessarily mean we want the brake lights off
     if (BrakeLightsActive == false)
     {   // Only turn the lights off if the brakes aren't on either
-        digitalWrite(pin_Brakelights, LOW);
+        PIN_PWM_OFF(pin_Brakelights);
+        PIN_LOW(pin_Brakelights);
     }
-    if (DEBUG) { DebugSerial->println(F("Running Lights Off")); }
+    if (DEBUG) { DebugLog.write(LOG_RUNNING_LIGHTS_OFF); }
 }
 
 void RunningLightsToggle()
@@ -105,19 +108,21 @@ void RunningLightsToggle()
 // -------------------------------------------------------------------------------------------------------------------------------------------------->
 void AuxOutputOn()
 {
-    digitalWrite(pin_AuxOutput, HIGH);    
-    if (DEBUG && !AuxOutputBlinking) { DebugSerial->println(F("Aux Output On")); }
+    PIN_PWM_OFF(pin_AuxOutput);
+    PIN_HIGH(pin_AuxOutput);    
+    if (DEBUG && !AuxOutputBlinking) { DebugLog.write(LOG_AUX_ON); }
 }
 void AuxOutputOff()
 {
     // Turn off
     if (timer.isEnabled(AuxOutputTimerID)) timer.deleteTimer(AuxOutputTimerID);
-    digitalWrite(pin_AuxOutput, LOW);
+    PIN_PWM_OFF(pin_AuxOutput);
+    PIN_LOW(pin_AuxOutput);
     if (DEBUG)
     {
-        if (AuxOutputBlinking)          { DebugSerial->println(F("Stop Aux Output Blinking")); }
-        else if (AuxOutputRevolving)    { DebugSerial->println(F("Stop Revolving Aux Light")); }
-        else if (!Failsafe)             { DebugSerial->println(F("Aux Output Off")); }  // Don't need to print anything if the reason we turned it off is because of radio failsafe
+        if (AuxOutputBlinking)          { DebugLog.write(LOG_AUX_BLINK_STOP); }
+        else if (AuxOutputRevolving)    { DebugLog.write(LOG_AUX_REVOLVE_STOP); }
+        else if (!Failsafe)             { DebugLog.write(LOG_AUX_OFF); }  // Don't need to print anything if the reason we turned it off is because of radio failsafe
     }
     // Now these are also false
     AuxOutputBlinking = false;
@@ -127,7 +132,8 @@ void AuxOutputTempOff()
 {
     // We use this one internally when we want the output to go off but we don't necessarily want to stop 
     // a blinking or revolving effect, or to display a debug message.
-    digitalWrite(pin_AuxOutput, LOW);
+    PIN_PWM_OFF(pin_AuxOutput);
+    PIN_LOW(pin_AuxOutput);
 }
 void AuxOutputToggle()
 {
@@ -139,7 +145,7 @@ void AuxOutputToggle()
 void AuxOutput_PresetDim()
 {
     analogWrite(pin_AuxOutput, eeprom.ramcopy.AuxLightPresetDim);
-    if (DEBUG) DebugSerial->println(F("Aux Output Preset Dim"));
+    if (DEBUG) DebugLog.write(LOG_AUX_PRESET_DIM);
 }
 void AuxOutput_SetLevel(uint16_t level)
 {   
@@ -172,7 +178,7 @@ void AuxOutputFlash()
     // Then we set a timer to turn it off after the flash length of time has passed
     AuxOutputTimerID = timer.setTimeout(eeprom.ramcopy.AuxLightFlashTime_mS, AuxOutputOff);
 
-    if (DEBUG) DebugSerial->println(F("Aux Output Flashed"));
+    if (DEBUG) DebugLog.write(LOG_AUX_FLASH);
 }
 void AuxOutputInverseFlash()
 {
@@ -184,7 +190,7 @@ void AuxOutputInverseFlash()
     // Then we set a timer to turn it on after the flash length of time has passed
     AuxOutputTimerID = timer.setTimeout(eeprom.ramcopy.AuxLightFlashTime_mS, AuxOutputOn);
 
-    if (DEBUG) DebugSerial->println(F("Aux Output Inverse Flashed"));
+    if (DEBUG) DebugLog.write(LOG_AUX_FLASH_INVERSE);
 }
 void AuxOutputBlink()
 {
@@ -195,7 +201,7 @@ void AuxOutputBlink()
     {   // Don't do blinking and revolving at the same time
         AuxOutputOff(); // This clears any other effects first
         AuxOutputBlinking = true;
-        if (DEBUG) { DebugSerial->println(F("Start Aux Output Blinking")); }
+        if (DEBUG) { DebugLog.write(LOG_AUX_BLINK_START); }
     }
 
     // Toggle the light state
@@ -214,7 +220,7 @@ void AuxOutputToggleBlink()
         AuxOutputOff();
         AuxOutputBlinking = false;
         if (timer.isEnabled(AuxOutputTimerID)) timer.deleteTimer(AuxOutputTimerID);
-        if (DEBUG) { DebugSerial->println(F("Stop Aux Output Blinking")); }
+        if (DEBUG) { DebugLog.write(LOG_AUX_BLINK_STOP); }
     }
     else
     {
@@ -225,13 +231,14 @@ void AuxOutputRevolve()
 {   // This starts the "revolving" effect, which frankly, doesn't look that great. 
     if (!AuxOutputRevolving)
     {   // Turn off light to start
-        digitalWrite(pin_AuxOutput, LOW);
+        PIN_PWM_OFF(pin_AuxOutput);
+        PIN_LOW(pin_AuxOutput);
         // Don't do blinking and revolving at the same time, clear any other junk going on
         AuxOutputBlinking = false;
         if (timer.isEnabled(AuxOutputTimerID)) timer.deleteTimer(AuxOutputTimerID);
         // Ok, we are starting the revolver
         AuxOutputRevolving = true;
-        if (DEBUG) { DebugSerial->println(F("Start Revolving Aux Light")); }        
+        if (DEBUG) { DebugLog.write(LOG_AUX_REVOLVE_START); }        
         AuxOutputRevolver();
     }
 }
@@ -240,9 +247,10 @@ void AuxOutputToggleRevolve()
     if (AuxOutputRevolving)
     {
         AuxOutputRevolving = false;
-        digitalWrite(pin_AuxOutput, LOW);
+        PIN_PWM_OFF(pin_AuxOutput);
+        PIN_LOW(pin_AuxOutput);
         if (timer.isEnabled(AuxOutputTimerID)) timer.deleteTimer(AuxOutputTimerID);
-        if (DEBUG) { DebugSerial->println(F("Stop Revolving Aux Light")); }
+        if (DEBUG) { DebugLog.write(LOG_AUX_REVOLVE_STOP); }
     }
     else
     {
@@ -311,19 +319,19 @@ void LED(int WhatLed, byte Status)
 
 void RedLedOn()
 {
-    digitalWrite(pin_RedLED, HIGH);
+    PIN_HIGH(pin_RedLED);
 }
 void RedLedOff()
 {
-    digitalWrite(pin_RedLED, LOW);
+    PIN_LOW(pin_RedLED);
 }
 void GreenLedOn()
 {
-    digitalWrite(pin_GreenLED, HIGH);
+    PIN_HIGH(pin_GreenLED);
 }
 void GreenLedOff()
 {
-    digitalWrite(pin_GreenLED, LOW);
+    PIN_LOW(pin_GreenLED);
 }
 
 void GreenBlink()
@@ -423,12 +431,14 @@ void RedBlinkThree()
 
 void AllLightsOff()
 {
-    digitalWrite(pin_RedLED, LOW);
-    digitalWrite(pin_GreenLED, LOW);
-    digitalWrite(pin_Light1, LOW);
-    digitalWrite(pin_Light2, LOW);
-    digitalWrite(pin_Brakelights, LOW);   
-    digitalWrite(pin_HitNotifyLEDs, LOW);
+    PIN_LOW(pin_RedLED);
+    PIN_LOW(pin_GreenLED);
+    PIN_LOW(pin_Light1);
+    PIN_LOW(pin_Light2);
+    PIN_PWM_OFF(pin_Brakelights);
+    PIN_LOW(pin_Brakelights);   
+    PIN_PWM_OFF(pin_HitNotifyLEDs);
+    PIN_LOW(pin_HitNotifyLEDs);
     // We don't include the Aux output because we don't know if it's a light or what the user is using it for. 
     MGLightOff();
 }
@@ -438,12 +448,14 @@ void RandomLights()
 static boolean Toggle = true;
     // This routine turns some lights on, and some lights off. Each time it is called, the on lights go off, and the off lights go on. 
     // We don't include the Aux output, because the user may have something other than a light plugged into it. 
-    digitalWrite(pin_RedLED, Toggle);
-    digitalWrite(pin_GreenLED, !Toggle);
-    digitalWrite(pin_Light1, Toggle);
-    digitalWrite(pin_Light2, !Toggle);
-    digitalWrite(pin_Brakelights, !Toggle);   
-    digitalWrite(pin_HitNotifyLEDs, Toggle);
+    PIN_WRITE(pin_RedLED, Toggle);
+    PIN_WRITE(pin_GreenLED, !Toggle);
+    PIN_WRITE(pin_Light1, Toggle);
+    PIN_WRITE(pin_Light2, !Toggle);
+    PIN_PWM_OFF(pin_Brakelights);
+    PIN_WRITE(pin_Brakelights, !Toggle);   
+    PIN_PWM_OFF(pin_HitNotifyLEDs);
+    PIN_WRITE(pin_HitNotifyLEDs, Toggle);
     Toggle ? MGLightOff() : MGLightOn();
     // Swap for next time
     Toggle = !Toggle;
@@ -453,8 +465,8 @@ void RandomLightsOnboardOnly()
 {
 static boolean Toggle = true;
     // Same thing as RandomLights, but we only toggle onboard LEDs
-    digitalWrite(pin_RedLED, Toggle);
-    digitalWrite(pin_GreenLED, !Toggle);
+    PIN_WRITE(pin_RedLED, Toggle);
+    PIN_WRITE(pin_GreenLED, !Toggle);
     // Swap for next time
     Toggle = !Toggle;
 }
@@ -505,12 +517,14 @@ void BlinkLightsTankDestroyed()
 void ResetAllLights()
 {   // This resets all the lights blinked above, otherwise when we exit failsafe some may be left on
     // This uses Delays and blocks all code!
-    digitalWrite(pin_RedLED, LOW);
-    digitalWrite(pin_GreenLED, LOW);
-    digitalWrite(pin_Light1, LOW);
-    digitalWrite(pin_Light2, LOW);
-    digitalWrite(pin_Brakelights, LOW);   
-    digitalWrite(pin_HitNotifyLEDs, LOW);
+    PIN_LOW(pin_RedLED);
+    PIN_LOW(pin_GreenLED);
+    PIN_LOW(pin_Light1);
+    PIN_LOW(pin_Light2);
+    PIN_PWM_OFF(pin_Brakelights);
+    PIN_LOW(pin_Brakelights);   
+    PIN_PWM_OFF(pin_HitNotifyLEDs);
+    PIN_LOW(pin_HitNotifyLEDs);
     MGLightOff();
 }
 
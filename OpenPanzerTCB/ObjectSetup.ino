@@ -24,44 +24,44 @@ void InstantiateMotorObjects()
    
     if (eeprom.ramcopy.DriveType == DT_CAR || eeprom.ramcopy.DriveType == DT_DKLM)
     {   
-        switch (eeprom.ramcopy.DriveMotors)
+        switch (EEPROM_VAR(DriveMotors))
         {
             case OP_SCOUT:
                 // For a single rear drive motor (or a single propulsion motor), connect it to M1
-                DriveMotor = new OPScout_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_DRIVE_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, false);    
+                DriveMotor = new (ObjectArena) OPScout_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_DRIVE_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, false);    
                 DriveMotor->begin();
                 
                 // For ancient Tamiya gearboxes, the DKLM "Propulsion Dynamic" gearboxes, and any others that use a single motor for drive and a secondary motor to shift power from one tread to the other, 
                 // we have a "SteeringMotor" which will be the otherwise unused second output of the dual-motor serial controller 
-                SteeringMotor = new OPScout_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_DRIVE_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, false);
+                SteeringMotor = new (ObjectArena) OPScout_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_DRIVE_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, false);
                 SteeringMotor->begin();    
                 break;
                 
             case SABERTOOTH:
                 // For a single rear drive motor (or a single propulsion motor), connect it to M1
-                DriveMotor = new Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
+                DriveMotor = new (ObjectArena) Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
                 DriveMotor->begin();
                 
                 // For ancient Tamiya gearboxes, the DKLM "Propulsion Dynamic" gearboxes, and any others that use a single motor for drive and a secondary motor to shift power from one tread to the other, 
                 // we have a "SteeringMotor" which will be the otherwise unused second output of the dual-motor serial controller 
-                SteeringMotor = new Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
+                SteeringMotor = new (ObjectArena) Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
                 SteeringMotor->begin();
                 break;
     
             case POLOLU:
                 // For a single rear drive motor (or a single propulsion motor), connect it to M0
-                DriveMotor = new Pololu_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_DRIVE_ID,&MotorSerial);
+                DriveMotor = new (ObjectArena) Pololu_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_DRIVE_ID,&MotorSerial);
                 DriveMotor->begin();
 
                 // For ancient Tamiya gearboxes, the DKLM "Propulsion Dynamic" gearboxes, and any others that use a single motor for drive and a secondary motor to shift power from one tread to the other, 
                 // we have a "SteeringMotor" which will be the otherwise unused second output of the dual-motor serial controller 
-                SteeringMotor = new Pololu_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_DRIVE_ID,&MotorSerial);
+                SteeringMotor = new (ObjectArena) Pololu_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_DRIVE_ID,&MotorSerial);
                 SteeringMotor->begin();
                 break;
     
             case ONBOARD:
                 // For a single rear drive motor (or a single propulsion motor), connect it to  MOTOR A
-                DriveMotor = new Onboard_ESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+                DriveMotor = new (ObjectArena) Onboard_ESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
                 DriveMotor->begin();                
                 MotorA_Available = false;
 
@@ -70,7 +70,7 @@ void InstantiateMotorObjects()
                     // For ancient Tamiya gearboxes, the DKLM "Propulsion Dynamic" gearboxes, and any others that use a single motor for drive and a secondary motor to shift power from one tread to the other, 
                     // we have a "SteeringMotor" which will be MOTOR B. Technically one should not be using this option for those gearboxes because they will exceed the current draw limits of the 
                     // onboard driver, but perhaps some day this same code will be used on different hardware. 
-                    SteeringMotor = new Onboard_ESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+                    SteeringMotor = new (ObjectArena) Onboard_ESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
                     SteeringMotor->begin();
                     MotorB_Available = false;       // This becomes unavailable for general purpose controller
                 }
@@ -79,7 +79,7 @@ void InstantiateMotorObjects()
                 
             case SERVO_ESC:
                 // For a single rear drive motor, connect it to the "Left" servo port (Servo 1)
-                DriveMotor = new Servo_ESC (SERVONUM_LEFTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+                DriveMotor = new (ObjectArena) Servo_ESC (SERVONUM_LEFTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
                 DriveMotor->begin();                    
                 RCOutput1_Available = false;
 
@@ -87,7 +87,7 @@ void InstantiateMotorObjects()
                 {
                     // For ancient Tamiya gearboxes, the DKLM "Propulsion Dynamic" gearboxes, and any others that use a single motor for drive and a secondary motor to shift power from one tread to the other, 
                     // we have a "SteeringMotor" which will be RC Output 2.
-                    SteeringMotor = new Servo_ESC (SERVONUM_RIGHTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+                    SteeringMotor = new (ObjectArena) Servo_ESC (SERVONUM_RIGHTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
                     SteeringMotor->begin();
                     RCOutput2_Available = false;    // This slot becomes unavailable for general purpose servo
                 }
@@ -97,40 +97,39 @@ void InstantiateMotorObjects()
             default:
                 // We shouldn't end up here but in case we do, we need to define something or else the program will croak at runtime.
                 // We set it to SABERTOOTH, and save it to EEPROM so we don't end up here again next time
-                eeprom.ramcopy.DriveMotors = SABERTOOTH;
-                EEPROM.updateInt(offsetof(_eeprom_data, DriveMotors), SABERTOOTH);
-                DriveMotor = new Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
+                EEPROM.updateByte(offsetof(_eeprom_data, DriveMotors), SABERTOOTH);
+                DriveMotor = new (ObjectArena) Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
                 DriveMotor->begin();
-                SteeringMotor = new Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
+                SteeringMotor = new (ObjectArena) Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
                 SteeringMotor->begin();
         }
     }
     else
     {   // The user wants independent tread speeds, either tank or halftrack
-        switch (eeprom.ramcopy.DriveMotors)
+        switch (EEPROM_VAR(DriveMotors))
         {
             case OP_SCOUT:
                 // Left drive to M1, Right drive to M2. 
-                LeftTread = new OPScout_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_DRIVE_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, eeprom.ramcopy.DragInnerTrack);    
-                RightTread = new OPScout_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_DRIVE_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, eeprom.ramcopy.DragInnerTrack);
+                LeftTread = new (ObjectArena) OPScout_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_DRIVE_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, EEPROM_VAR(DragInnerTrack));    
+                RightTread = new (ObjectArena) OPScout_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_DRIVE_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, EEPROM_VAR(DragInnerTrack));
                 break;
                 
             case SABERTOOTH:
                 // Left drive to M1, Right drive to M2. 
-                LeftTread = new Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
-                RightTread = new Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
+                LeftTread = new (ObjectArena) Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
+                RightTread = new (ObjectArena) Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
                 break;
     
             case POLOLU:
                 // Left drive to M0, Right drive to M1
-                LeftTread = new Pololu_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_DRIVE_ID,&MotorSerial);
-                RightTread = new Pololu_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_DRIVE_ID,&MotorSerial);
+                LeftTread = new (ObjectArena) Pololu_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_DRIVE_ID,&MotorSerial);
+                RightTread = new (ObjectArena) Pololu_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_DRIVE_ID,&MotorSerial);
                 break;
     
             case ONBOARD:
                 // Left drive to Motor A, Right drive to Motor B
-                LeftTread = new Onboard_ESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
-                RightTread = new Onboard_ESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+                LeftTread = new (ObjectArena) Onboard_ESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+                RightTread = new (ObjectArena) Onboard_ESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
                 MotorA_Available = false;
                 MotorB_Available = false;
                 break;
@@ -147,8 +146,8 @@ void InstantiateMotorObjects()
                     EEPROM.updateInt(offsetof(_eeprom_data, DriveType), DT_TANK);
                 }
                 // In this case they have selected DriveType = DT_TANK. That means they won't be needing a steering servo. 
-                LeftTread = new Servo_ESC (SERVONUM_LEFTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
-                RightTread = new Servo_ESC (SERVONUM_RIGHTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+                LeftTread = new (ObjectArena) Servo_ESC (SERVONUM_LEFTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+                RightTread = new (ObjectArena) Servo_ESC (SERVONUM_RIGHTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
                 RCOutput1_Available = false;
                 RCOutput2_Available = false;
                 break;
@@ -156,10 +155,9 @@ void InstantiateMotorObjects()
             default:
                 // We shouldn't end up here but in case we do, we need to define something or else the program will croak at runtime
                 // We set it to SABERTOOTH, and save it to EEPROM so we don't end up here again next time
-                eeprom.ramcopy.DriveMotors = SABERTOOTH;
-                EEPROM.updateInt(offsetof(_eeprom_data, DriveMotors), SABERTOOTH);
-                LeftTread = new Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
-                RightTread = new Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
+                EEPROM.updateByte(offsetof(_eeprom_data, DriveMotors), SABERTOOTH);
+                LeftTread = new (ObjectArena) Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
+                RightTread = new (ObjectArena) Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_DRIVE_Address,&MotorSerial);
         }
         // Now initialize the motors
         RightTread->begin();        
@@ -173,7 +171,7 @@ void InstantiateMotorObjects()
         // be used for the right tread. If a single rear drive axle is used, the drive ESC can be plugged into the Left tread servo port. Otherwise
         // if independent tread speeds are still desired in addition to the steering servo (halftracks with independent tread control), 
         // the user will have to use a serial dual motor controller or the onboard motor controllers. 
-        SteeringServo = new Servo_ESC (SERVONUM_RIGHTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+        SteeringServo = new (ObjectArena) Servo_ESC (SERVONUM_RIGHTTREAD,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
         // Initialize the servo
         SteeringServo->begin();
         // This slot is unavailable for general purpose servo
@@ -185,24 +183,24 @@ void InstantiateMotorObjects()
     switch (eeprom.ramcopy.TurretRotationMotor)
     {
         case OP_SCOUT:      // M1
-            TurretRotation = new OPScout_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_TURRET_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, false);
+            TurretRotation = new (ObjectArena) OPScout_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_TURRET_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, false);
             break;
         case SABERTOOTH:    // M1
-            TurretRotation = new Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_TURRET_Address,&MotorSerial);
+            TurretRotation = new (ObjectArena) Sabertooth_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_TURRET_Address,&MotorSerial);
             break;
         case POLOLU:        // M0
-             TurretRotation = new Pololu_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_TURRET_ID,&MotorSerial);
+             TurretRotation = new (ObjectArena) Pololu_SerialESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_TURRET_ID,&MotorSerial);
             break;
         case ONBOARD:       // Motor A
-            TurretRotation = new Onboard_ESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            TurretRotation = new (ObjectArena) Onboard_ESC (SIDEA,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             MotorA_Available = false;
             break;
         case SERVO_ESC:
-            TurretRotation = new Servo_ESC (SERVONUM_TURRETROTATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            TurretRotation = new (ObjectArena) Servo_ESC (SERVONUM_TURRETROTATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             RCOutput3_Available = false;
             break;
         case SERVO_PAN:
-            TurretRotation = new Servo_PAN (SERVONUM_TURRETROTATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            TurretRotation = new (ObjectArena) Servo_PAN (SERVONUM_TURRETROTATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             RCOutput3_Available = false;
             break;
         case DRIVE_DETACHED:
@@ -211,14 +209,14 @@ void InstantiateMotorObjects()
             // cumbersome to always add a check for drive type before any action to be taken on the object. We will of course need to check the drive 
             // type in some cases, most importantly when processing turret stick movements, which should apply only if the drive type is not DRIVE_DETACHED.
             // Most other instances are harmless, but would become bugs if an object didn't exist. We use a special Null_Motor object that does nothing. 
-            TurretRotation = new Null_Motor();
+            TurretRotation = new (ObjectArena) Null_Motor();
             break;
         default:
             // We shouldn't end up here but in case we do, we need to define something or else the program will croak at runtime
             // We set it to SERVO_ESC, and save it to EEPROM so we don't end up here next time. 
             eeprom.ramcopy.TurretRotationMotor = SERVO_ESC;
             EEPROM.updateInt(offsetof(_eeprom_data, TurretRotationMotor), SERVO_ESC);
-            TurretRotation = new Servo_ESC (SERVONUM_TURRETROTATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            TurretRotation = new (ObjectArena) Servo_ESC (SERVONUM_TURRETROTATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             RCOutput3_Available = false;
     }
     // Now initialize the motor
@@ -228,7 +226,7 @@ void InstantiateMotorObjects()
     // In that case limiting the max speed will actually just limit the servo's travel. However for turret rotation it is unlikely an unmodified hobby servo would be used. 
     // We could do a check for SERVO_ESC, but that won't help, because the user could have plugged in a continuous rotation servo, or be using a hobby ESC, and still selected SERVO_ESC,
     // and in those cases limiting the max speed would indeed work as intended. 
-    if (eeprom.ramcopy.TurretRotation_MaxSpeedPct < 100) { TurretRotation->set_MaxSpeedPct(eeprom.ramcopy.TurretRotation_MaxSpeedPct); }   
+    if (EEPROM_VAR(TurretRotation_MaxSpeedPct) < 100) { TurretRotation->set_MaxSpeedPct(EEPROM_VAR(TurretRotation_MaxSpeedPct)); }   
     
     // We may also have some custom end-points defined for the rotation motor, if it is set to servo. 
     // These end-points need to be set after the begin() statement, which initializes the endpoints to defaults.
@@ -236,12 +234,12 @@ void InstantiateMotorObjects()
     {
         // The end-points are actually handled in the servo class, not the motor class. Since TurretRotation is a pointer to the motor class, 
         // and not the servo class we need to call the servo class directly using TankServos (even though in this case TurretRotation is also a subclass of servo)
-        TankServos.setMinPulseWidth(SERVONUM_TURRETROTATION, eeprom.ramcopy.TurretRotation_EPMin);
-        TankServos.setMaxPulseWidth(SERVONUM_TURRETROTATION, eeprom.ramcopy.TurretRotation_EPMax);
+        TankServos.setMinPulseWidth(SERVONUM_TURRETROTATION, EEPROM_VAR(TurretRotation_EPMin));
+        TankServos.setMaxPulseWidth(SERVONUM_TURRETROTATION, EEPROM_VAR(TurretRotation_EPMax));
         
         // For turret rotation, we use the reversed setting of the motor class. 
         // FYI, we don't have a reversed setting for traditional motors (Sabertooth, onboard, etc...) because in those cases you can just swap the motor wires. 
-        TurretRotation->set_Reversed(eeprom.ramcopy.TurretRotation_Reversed);
+        TurretRotation->set_Reversed(EEPROM_VAR(TurretRotation_Reversed));
     }
 
     // TURRET MOTOR DEFINITION - ELEVATION
@@ -249,28 +247,28 @@ void InstantiateMotorObjects()
     switch (eeprom.ramcopy.TurretElevationMotor)
     {
         case OP_SCOUT:      // M2
-            TurretElevation = new OPScout_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_TURRET_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, false);
+            TurretElevation = new (ObjectArena) OPScout_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,OPScout_TURRET_Address,&MotorSerial,&eeprom.ramcopy.MotorSerialBaud, false);
             break;
         case SABERTOOTH:    // M2
-            TurretElevation = new Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_TURRET_Address,&MotorSerial);
+            TurretElevation = new (ObjectArena) Sabertooth_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Sabertooth_TURRET_Address,&MotorSerial);
             break;
         case POLOLU:        // M1
-            TurretElevation = new Pololu_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_TURRET_ID,&MotorSerial);
+            TurretElevation = new (ObjectArena) Pololu_SerialESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,Pololu_TURRET_ID,&MotorSerial);
             break;
         case ONBOARD:       // Motor B
-            TurretElevation = new Onboard_ESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            TurretElevation = new (ObjectArena) Onboard_ESC (SIDEB,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             MotorB_Available = false;
             break;
         case SERVO_ESC:
-            TurretElevation = new Servo_ESC (SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            TurretElevation = new (ObjectArena) Servo_ESC (SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             RCOutput4_Available = false;
             break;
         case SERVO_PAN:
-            TurretElevation = new Servo_PAN (SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            TurretElevation = new (ObjectArena) Servo_PAN (SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             // TurretElevation is a pointer of class Motor. But if we are using barrel stabilization it will be useful to have an 
             // object of Servo_PAN type directly, we call this one Barrel. The two are the same, but Barrel will expose some methods that TurretElevation won't have.
             // FYI: Barrel stabilization can only be enabled if TurretElevation is set to pan servo, so you won't see this under any other category. 
-            Barrel = new Servo_PAN (SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            Barrel = new (ObjectArena) Servo_PAN (SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             Barrel->begin();    // Initialize the barrel
             RCOutput4_Available = false;
             break;
@@ -280,14 +278,14 @@ void InstantiateMotorObjects()
             // cumbersome to always add a check for drive type before any action to be taken on the object. We will of course need to check the drive 
             // type in some cases, most importantly when processing turret stick movements, which should apply only if the drive type is not DRIVE_DETACHED.
             // Most other instances are harmless, but would become bugs if an object didn't exist. We use a special Null_Motor object that does nothing. 
-            TurretElevation = new Null_Motor();
+            TurretElevation = new (ObjectArena) Null_Motor();
             break;
         default:
             // We shouldn't end up here but in case we do, we need to define something or else the program will croak at runtime
             // We set it to SERVO_ESC, and save it to EEPROM so we don't end up here next time. 
             eeprom.ramcopy.TurretElevationMotor = SERVO_ESC;
             EEPROM.updateInt(offsetof(_eeprom_data, TurretElevationMotor), SERVO_ESC);            
-            TurretElevation = new Servo_ESC (SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            TurretElevation = new (ObjectArena) Servo_ESC (SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             RCOutput4_Available = false;
     }
     // Now initialize the motor
@@ -297,7 +295,7 @@ void InstantiateMotorObjects()
     // For barrel elevation, that very well could be the case although we suggest that SERVO_PAN is a better choice for hobby servos in this application, which the user would
     // hopefully use instead, and in which case the speed limitation will work. 
     // Note we do not set a speed limitation on the Barrel copy object. That one is only used for barrel stabilization and in that case we don't want any limit on the speed of the servo. 
-    if (eeprom.ramcopy.TurretElevation_MaxSpeedPct < 100) { TurretElevation->set_MaxSpeedPct(eeprom.ramcopy.TurretElevation_MaxSpeedPct); }
+    if (EEPROM_VAR(TurretElevation_MaxSpeedPct) < 100) { TurretElevation->set_MaxSpeedPct(EEPROM_VAR(TurretElevation_MaxSpeedPct)); }
     
     // We may also have some custom end-points defined for the elevation motor, if it is set to servo. 
     // These end-points need to be set after the begin() statement, which initializes the endpoints to defaults.
@@ -322,13 +320,13 @@ void InstantiateMotorObjects()
 	// We still pass an external min/max speed although it won't be used for this object. 
 	// What will be used are recoil/return times, along with a reverse setting if the servo needs to be reversed. These can be modified
 	// later but will be initialized to sensible defaults.
-        RecoilServo = new Servo_RECOIL (SERVONUM_RECOIL,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,eeprom.ramcopy.RecoilServo_Recoil_mS,eeprom.ramcopy.RecoilServo_Return_mS,eeprom.ramcopy.RecoilReversed);
+        RecoilServo = new (ObjectArena) Servo_RECOIL (SERVONUM_RECOIL,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0,EEPROM_VAR(RecoilServo_Recoil_mS),EEPROM_VAR(RecoilServo_Return_mS),EEPROM_VAR(RecoilReversed));
         // Recoil servos also have custom end-points. Because RecoilServo is a motor of class Servo, we can call setMin/MaxPulseWidth from the servo class directly, rather than from TankServos
-        RecoilServo->setMinPulseWidth(SERVONUM_RECOIL, eeprom.ramcopy.RecoilServo_EPMin);
-        RecoilServo->setMaxPulseWidth(SERVONUM_RECOIL, eeprom.ramcopy.RecoilServo_EPMax);
+        RecoilServo->setMinPulseWidth(SERVONUM_RECOIL, EEPROM_VAR(RecoilServo_EPMin));
+        RecoilServo->setMaxPulseWidth(SERVONUM_RECOIL, EEPROM_VAR(RecoilServo_EPMax));
         // The reversed setting needs to be applied both to the motor class (flag) as well as to the servo class (actual recoil movement settings). 
-        RecoilServo->set_Reversed(eeprom.ramcopy.RecoilReversed);                       // motor class method
-        RecoilServo->setRecoilReversed(SERVONUM_RECOIL, eeprom.ramcopy.RecoilReversed); // servo class method
+        RecoilServo->set_Reversed(EEPROM_VAR(RecoilReversed));                          // motor class method
+        RecoilServo->setRecoilReversed(SERVONUM_RECOIL, EEPROM_VAR(RecoilReversed));    // servo class method
         // The begin function will make sure the recoil servo is initialized to its "battery" position
         RecoilServo->begin();
 
@@ -338,12 +336,12 @@ void InstantiateMotorObjects()
         // The smoker object also has two settings for idle and fast idle, which the user can save to EEPROM. Those are also passed to the constructor. 
         if (eeprom.ramcopy.SmokerControlAuto)
         {   // If the user wants the smoker to be controlled automatically with engine speed, we pass the user's  max speed setting
-            Smoker = new Onboard_Smoker (SIDEA,0,eeprom.ramcopy.SmokerMaxSpeed,0,eeprom.ramcopy.SmokerIdleSpeed,eeprom.ramcopy.SmokerFastIdleSpeed);
+            Smoker = new (ObjectArena) Onboard_Smoker (SIDEA,0,EEPROM_VAR(SmokerMaxSpeed),0,EEPROM_VAR(SmokerIdleSpeed),EEPROM_VAR(SmokerFastIdleSpeed));
         }
         else
         {   // But if the user wants to disconnect the smoker from the engine and control it manually, we set max speed to MOTOR_MAX_FWDSPEED (100%)
             // We still pass the Idle and FastIdle speeds but they will not be used. 
-            Smoker = new Onboard_Smoker (SIDEA,0,MOTOR_MAX_FWDSPEED,0,eeprom.ramcopy.SmokerIdleSpeed,eeprom.ramcopy.SmokerFastIdleSpeed);
+            Smoker = new (ObjectArena) Onboard_Smoker (SIDEA,0,MOTOR_MAX_FWDSPEED,0,EEPROM_VAR(SmokerIdleSpeed),EEPROM_VAR(SmokerFastIdleSpeed));
         }
         Smoker->begin();
 
@@ -352,8 +350,8 @@ void InstantiateMotorObjects()
         // If either of the two onboard motor controllers (A & B) have not been assigned to any drive or turret function, we let the user
         // control them directly for whatever purpose, using an analog function trigger. We also can conveniently set the external speed range of the
         // motor objects to the actual range of the input we know we will receive from an analog trigger (0-1023 where 511 is center). 
-        if (MotorA_Available) { MotorA = new Onboard_ESC (SIDEA, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); MotorA->begin(); }
-        if (MotorB_Available) { MotorB = new Onboard_ESC (SIDEB, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); MotorB->begin(); }
+        if (MotorA_Available) { MotorA = new (ObjectArena) Onboard_ESC (SIDEA, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); MotorA->begin(); }
+        if (MotorB_Available) { MotorB = new (ObjectArena) Onboard_ESC (SIDEB, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); MotorB->begin(); }
         //DebugSerial->print(F("Motor A Available: ")); PrintLnTrueFalse(MotorA_Available);
         //DebugSerial->print(F("Motor B Available: ")); PrintLnTrueFalse(MotorB_Available);
 }
@@ -398,7 +396,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC1_PASS:       // RC Output 1 passthrough
                         if (RCOutput1_Available && !RCOutput1_Assigned) 
                         {   //RC Output on LEFTTREAD
-                            RCOutput1 = new Servo_ESC (SERVONUM_LEFTTREAD, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            RCOutput1 = new (ObjectArena) Servo_ESC (SERVONUM_LEFTTREAD, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             RCOutput1->begin(); 
                             RCOutput1_Assigned = true;
                         }
@@ -406,7 +404,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC2_PASS:       // RC Output 2 passthrough
                         if (RCOutput2_Available && !RCOutput2_Assigned) 
                         {   //RC Output on RIGHTTREAD
-                            RCOutput2 = new Servo_ESC (SERVONUM_RIGHTTREAD, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            RCOutput2 = new (ObjectArena) Servo_ESC (SERVONUM_RIGHTTREAD, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             RCOutput2->begin(); 
                             RCOutput2_Assigned = true;
                         }
@@ -414,7 +412,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC3_PASS:       // RC Output 3 passthrough
                         if (RCOutput3_Available && !RCOutput3_Assigned) 
                         {   //RC Output on TURRETROTATION
-                            RCOutput3 = new Servo_ESC (SERVONUM_TURRETROTATION, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            RCOutput3 = new (ObjectArena) Servo_ESC (SERVONUM_TURRETROTATION, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             RCOutput3->begin(); 
                             RCOutput3_Assigned = true;
                         }
@@ -422,7 +420,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC4_PASS:       // RC Output 4 passthrough
                         if (RCOutput4_Available && !RCOutput4_Assigned) 
                         {   //RC Output on TURRETELEVATION
-                            RCOutput4 = new Servo_ESC (SERVONUM_TURRETELEVATION, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            RCOutput4 = new (ObjectArena) Servo_ESC (SERVONUM_TURRETELEVATION, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             RCOutput4->begin(); 
                             RCOutput4_Assigned = true;
                         }
@@ -430,7 +428,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC6_PASS:       // RC Output 6 passthrough
                         if (RCOutput6_Available && !RCOutput6_Assigned) 
                         {   //RC Output on TURRETELEVATION
-                            RCOutput6 = new Servo_ESC (SERVONUM_PROP3, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            RCOutput6 = new (ObjectArena) Servo_ESC (SERVONUM_PROP3, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             RCOutput6->begin(); 
                             RCOutput6_Assigned = true;
                         }
@@ -438,7 +436,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC7_PASS:       // RC Output 7 passthrough
                         if (RCOutput7_Available && !RCOutput7_Assigned) 
                         {   //RC Output on TURRETELEVATION
-                            RCOutput7 = new Servo_ESC (SERVONUM_PROP2, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            RCOutput7 = new (ObjectArena) Servo_ESC (SERVONUM_PROP2, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             RCOutput7->begin(); 
                             RCOutput7_Assigned = true;
                         }
@@ -446,7 +444,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC8_PASS:       // RC Output 8 passthrough
                         if (RCOutput8_Available && !RCOutput8_Assigned) 
                         {   //RC Output on TURRETELEVATION
-                            RCOutput8 = new Servo_ESC (SERVONUM_PROP1, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            RCOutput8 = new (ObjectArena) Servo_ESC (SERVONUM_PROP1, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             RCOutput8->begin(); 
                             RCOutput8_Assigned = true;
                         }
@@ -455,7 +453,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC1_PASS_PAN:   // Pan Servo on RC Output 1
                         if (RCOutput1_Available && !RCOutput1_Assigned) 
                         {   // Servo_PAN on LEFTTTREAD
-                            ServoOutput1 = new Servo_PAN (SERVONUM_LEFTTREAD, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            ServoOutput1 = new (ObjectArena) Servo_PAN (SERVONUM_LEFTTREAD, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             ServoOutput1->begin(); 
                             RCOutput1_Assigned = true;
                         }
@@ -463,7 +461,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC2_PASS_PAN:   // Pan Servo on RC Output 2
                         if (RCOutput2_Available && !RCOutput2_Assigned) 
                         {   // Servo_PAN on RIGHTTREAD
-                            ServoOutput2 = new Servo_PAN (SERVONUM_RIGHTTREAD, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            ServoOutput2 = new (ObjectArena) Servo_PAN (SERVONUM_RIGHTTREAD, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             ServoOutput2->begin(); 
                             RCOutput2_Assigned = true;
                         }
@@ -471,7 +469,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC3_PASS_PAN:   // Pan Servo on RC Output 3
                         if (RCOutput3_Available && !RCOutput3_Assigned) 
                         {   // Servo_PAN on TURRETROTATION
-                            ServoOutput3 = new Servo_PAN (SERVONUM_TURRETROTATION, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            ServoOutput3 = new (ObjectArena) Servo_PAN (SERVONUM_TURRETROTATION, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             ServoOutput3->begin(); 
                             RCOutput3_Assigned = true;
                         }
@@ -479,7 +477,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC4_PASS_PAN:   // Pan Servo on RC Output 4
                         if (RCOutput4_Available && !RCOutput4_Assigned) 
                         {   // Servo_PAN on TURRETELEVATION
-                            ServoOutput4 = new Servo_PAN (SERVONUM_TURRETELEVATION, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            ServoOutput4 = new (ObjectArena) Servo_PAN (SERVONUM_TURRETELEVATION, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             ServoOutput4->begin(); 
                             RCOutput4_Assigned = true;
                         }
@@ -487,7 +485,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC6_PASS_PAN:   // Pan Servo on RC Output 6
                         if (RCOutput6_Available && !RCOutput6_Assigned) 
                         {   // Servo_PAN on TURRETELEVATION
-                            ServoOutput6 = new Servo_PAN (SERVONUM_PROP3, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            ServoOutput6 = new (ObjectArena) Servo_PAN (SERVONUM_PROP3, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             ServoOutput6->begin(); 
                             RCOutput6_Assigned = true;
                         }
@@ -495,7 +493,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC7_PASS_PAN:   // Pan Servo on RC Output 7
                         if (RCOutput7_Available && !RCOutput7_Assigned) 
                         {   // Servo_PAN on TURRETELEVATION
-                            ServoOutput7 = new Servo_PAN (SERVONUM_PROP2, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            ServoOutput7 = new (ObjectArena) Servo_PAN (SERVONUM_PROP2, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             ServoOutput7->begin(); 
                             RCOutput7_Assigned = true;
                         }
@@ -503,7 +501,7 @@ void InstantiateOptionalServoOutputs()
                     case SF_RC8_PASS_PAN:   // Pan Servo on RC Output 8
                         if (RCOutput8_Available && !RCOutput8_Assigned) 
                         {   // Servo_PAN on TURRETELEVATION
-                            ServoOutput8 = new Servo_PAN (SERVONUM_PROP1, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
+                            ServoOutput8 = new (ObjectArena) Servo_PAN (SERVONUM_PROP1, ANALOG_SPECFUNCTION_MIN_VAL, ANALOG_SPECFUNCTION_MAX_VAL, ANALOG_SPECFUNCTION_CENTER_VAL); 
                             ServoOutput8->begin(); 
                             RCOutput8_Assigned = true;
                         }
@@ -521,6 +519,25 @@ void InstantiateOptionalServoOutputs()
     //DebugSerial->print(F("RCOutput 8 Available: ")); PrintLnTrueFalse(RCOutput8_Available);
 }
 
+// Called by ObjectArena if one of the objects above doesn't fit. That means the arena sizing in the main tab is out of date, and without the object we can't
+// run, so we stop right here. This uses straight delays and never returns.
+void ObjectArenaFull(uint16_t needed)
+{
+    DebugLog.flush(DebugSerial);            // We print directly from here on, so send anything the log is holding first
+    PrintDebugLine();
+    DebugSerial->print(F("OBJECT ARENA FULL! Needed ")); DebugSerial->print(needed); DebugSerial->print(F(" bytes, "));
+    DebugSerial->print(ObjectArena.reserved() - ObjectArena.used()); DebugSerial->println(F(" left. Check OBJECT_ARENA_SIZE."));
+    PrintDebugLine();
+    GreenLedOff();
+    while (true)
+    {   // Fast red blink forever
+        RedLedOn();
+        delay(100);
+        RedLedOff();
+        delay(100);
+    }
+}
+
 
 void SetupPins()
 {
@@ -529,28 +546,28 @@ void SetupPins()
 // IO pins
     // These can be setup as input or output depending on the user's preference. 
     // IO "A" setup
-    IO_Pin[IOA].Settings = eeprom.ramcopy.PortA_Settings;
+    IO_Pin[IOA].Settings = EEPROM_VAR(PortA_Settings);
     if (IO_Pin[IOA].Settings.dataDirection == OUTPUT)    
     {
         pinMode(pin_IO_A, OUTPUT);
         IO_Pin[IOA].Settings.dataType ? PortA_On() : PortA_Off();   // The default pin state is defined by the dataType setting
     }   
     else                                            
-    {   // Use pullups if the input is "digital" (only needs to read on/off)
+    {   // Use pullups if the input is "digital" (only needs to read on/off) or a wheel encoder
         // But if they want a full analog range, don't use pullups because it will prevent us from going all the way to ground (0)
         if (IO_Pin[IOA].Settings.dataType) pinMode(pin_IO_A, INPUT_PULLUP); 
         else pinMode(pin_IO_A, INPUT); 
         PortA_ReadValue();  // Get the present value
     }
     // IO "B" setup
-    IO_Pin[IOB].Settings = eeprom.ramcopy.PortB_Settings;
+    IO_Pin[IOB].Settings = EEPROM_VAR(PortB_Settings);
     if (IO_Pin[IOB].Settings.dataDirection == OUTPUT)
     {
         pinMode(pin_IO_B, OUTPUT);
         IO_Pin[IOB].Settings.dataType ? PortB_On() : PortB_Off();   // The default pin state is defined by the dataType setting
     }
     else                                            
-    {   // Use pullups if the input is "digital" (only needs to read on/off)
+    {   // Use pullups if the input is "digital" (only needs to read on/off) or a wheel encoder
         // But if they want a full analog range, don't use pullups because it will prevent us from going all the way to ground (0)
         if (IO_Pin[IOB].Settings.dataType) pinMode(pin_IO_B, INPUT_PULLUP);
         else pinMode(pin_IO_B, INPUT);        
@@ -30,6 +30,7 @@
 #include "src/OP_PPMDecode/OP_PPMDecode.h"
 #include "src/OP_SBusDecode/OP_SBusDecode.h"
 #include "src/OP_IBusDecode/OP_iBusDecode.h"
+#include "src/OP_CRSFDecode/OP_CRSFDecode.h"
 #include "src/OP_Motors/OP_Motors.h"
 #include "src/OP_Servo/OP_Servo.h"
 #include "src/OP_Sabertooth/OP_Sabertooth.h"
@@ -37,6 +38,10 @@
 #include "src/OP_Scout/OP_Scout.h"
 #include "src/OP_SimpleTimer/OP_SimpleTimer.h"
 #include "src/OP_Driver/OP_Driver.h"
+#include "src/OP_TrackSpeed/OP_TrackSpeed.h"
+#include "src/OP_I2C/OP_I2C.h"
+#include "src/OP_BNO055/OP_BNO055.h"
+#include "src/OP_Incline/OP_Incline.h"
 #include "src/OP_IRLib/OP_IRLib.h"
 #include "src/OP_IRLib/OP_IRLibMatch.h"
 #include "src/OP_Sound/OP_Sound.h"
@@ -46,6 +51,9 @@
 #include "src/OP_Radio/OP_Radio.h"
 #include "src/OP_Tank/OP_Tank.h"
 #include "src/OP_PCComm/OP_PCComm.h"
+#include "src/OP_Log/OP_Log.h"
+#include "src/OP_Arena/OP_Arena.h"
+#include "src/OP_Memory/OP_Memory.h"
 // It would be nice to just have the user install the EEPROMex library through Arduino library manager, 
 // but we actually need to make a change to the default settings, so we include a copy in our own src folder.
 // You must comment-out the "#define _EEPROMEX_DEBUG" line in EEPROMex.cpp
@@ -65,14 +73,20 @@
     boolean DEBUG = false;                       // Start at false, but it will later get set to whatever value is stored in EEPROM
     boolean SAVE_DEBUG = false;                  // We may temporarily want to disable the debug, but we save a copy of the actual state so we can revert it
     HardwareSerial *DebugSerial;                 // Which serial port to print debug messages to (HardwareSerial is equal to Serial0/Serial Port 0/USART0)
+    OP_Log DebugLog;                             // Messages printed from the main loop are saved here and sent to DebugSerial a bit at a time, so they don't hold up the loop
+    uint8_t SysInfoStep = 0;                     // Which section of the system info dump gets printed next, 0 if no dump is in progress (see DumpSysInfo in Utilities)
+    uint8_t SysInfoItem = 0;                     // Which line of that section gets printed next
+    boolean SysInfoCompact = false;              // Is the dump in progress the compact, machine-readable variant
 
 // RADIO INPUTS
     OP_Radio Radio;
     boolean Failsafe = false;                    // Are we in failsafe due to some radio problem?
+    uint32_t FailsafeRecoveryStart = 0;          // micros() time we got the first good frame after a failsafe, for measuring how quickly the outputs respond
     int RxSignalLostTimerID = 0;                 // Timer used to blink lights when the Rx signal is lost
 
 // SPECIAL FUNCTIONS AND TRIGGERS
     void_FunctionPointer_uint16 SF_Callback[MAX_FUNCTION_TRIGGERS];  // An array of function pointers that we will tie to our special function triggers. 
+    analog_trigger_state SF_AnalogState[MAX_FUNCTION_TRIGGERS];     // What we last passed to each analog function, see SF_AnalogTrigger() in the SpecFunctions tab
     uint8_t triggerCount = 0;                    // How many triggers defined. Will be determined at run time. 
     uint16_t AdHocTriggers = 0x0000;             // We use individual bits of a 2-byte number to flag up to 16 different ad-hoc triggers. Initialize all to zero.
 
@@ -91,6 +105,7 @@
 // TANK OBJECTS
     OP_Servos TankServos;
     OP_Driver Driver;                         
+    OP_TrackSpeed TrackSpeed;                    // Closed-loop track speed, only if the IO ports are set to encoder inputs
     OP_Engine TankEngine;
     OP_Transmission TankTransmission;
     OP_Sound * TankSound;
@@ -144,20 +159,59 @@
         boolean MotorA_Available = false;
         boolean MotorB_Available = false;
 
+// OBJECT ARENA
+    // The motor and servo output objects above, and the TankSound object, are created in InstantiateMotorObjects(), InstantiateOptionalServoOutputs() and 
+    // InstantiateSoundObject() once we know the user's settings. Rather than the heap they are created in this fixed block of RAM, which is sized here for 
+    // the worst case: the largest class that could fill each role. The block is counted in the RAM usage the compiler reports, and the system info dump 
+    // shows how much of it the present settings actually use. If you add a new motor or sound class, or a new object to ObjectSetup, add it here too - 
+    // the ARENA_FITS checks below will stop the build if a class is larger than its slot, and if the arena runs out at runtime we halt (see ObjectArenaFull). 
+    #define ARENA_ANY_MOTOR     ARENA_MAX(ARENA_MAX(ARENA_MAX(ARENA_SLOT(OPScout_SerialESC), ARENA_SLOT(Sabertooth_SerialESC)), ARENA_MAX(ARENA_SLOT(Pololu_SerialESC), ARENA_SLOT(Onboard_ESC))), \
+                                          ARENA_MAX(ARENA_MAX(ARENA_SLOT(Servo_ESC), ARENA_SLOT(Servo_PAN)), ARENA_SLOT(Null_Motor)))
+    #define ARENA_ANY_RCOUTPUT  ARENA_MAX(ARENA_SLOT(Servo_ESC), ARENA_SLOT(Servo_PAN))
+    #define ARENA_ANY_SOUND     ARENA_MAX(ARENA_MAX(ARENA_SLOT(BenediniTBS) + ARENA_SLOT(OP_Servos), ARENA_SLOT(OP_SoundCard)), ARENA_SLOT(OP_TaigenSound))    // The TBS creates its own servo object too
+    #define OBJECT_ARENA_SIZE   ( (2 * ARENA_ANY_MOTOR)                 /* Left & right treads, or drive & steering motors */   \
+                                + ARENA_SLOT(Servo_ESC)                 /* Steering servo */                                    \
+                                + (2 * ARENA_ANY_MOTOR)                 /* Turret rotation & elevation */                       \
+                                + ARENA_SLOT(Servo_PAN)                 /* Barrel */                                            \
+                                + ARENA_SLOT(Servo_RECOIL)              /* Recoil servo */                                      \
+                                + ARENA_SLOT(Onboard_Smoker)            /* Smoker */                                            \
+                                + (2 * ARENA_SLOT(Onboard_ESC))         /* Motors A & B */                                      \
+                                + (7 * ARENA_ANY_RCOUTPUT)              /* RC outputs 1-4 & 6-8, pass-through or pan servo */   \
+                                + ARENA_ANY_SOUND                       /* TankSound */                                         \
+                                + ARENA_SLOT(Servo_PAN) )               /* Temporary object in SetupServo(), released on exit */
+    uint8_t ObjectArenaBuffer[OBJECT_ARENA_SIZE] __attribute__((aligned(ARENA_ALIGN)));
+    OP_Arena ObjectArena(ObjectArenaBuffer, OBJECT_ARENA_SIZE);
+    // Every class ObjectSetup and Sound can create must fit the slot of the role it is created for
+    ARENA_FITS(OPScout_SerialESC,    ARENA_ANY_MOTOR);
+    ARENA_FITS(Sabertooth_SerialESC, ARENA_ANY_MOTOR);
+    ARENA_FITS(Pololu_SerialESC,     ARENA_ANY_MOTOR);
+    ARENA_FITS(Onboard_ESC,          ARENA_ANY_MOTOR);
+    ARENA_FITS(Servo_ESC,            ARENA_ANY_MOTOR);
+    ARENA_FITS(Servo_PAN,            ARENA_ANY_MOTOR);
+    ARENA_FITS(Null_Motor,           ARENA_ANY_MOTOR);
+    ARENA_FITS(Servo_ESC,            ARENA_ANY_RCOUTPUT);
+    ARENA_FITS(Servo_PAN,            ARENA_ANY_RCOUTPUT);
+    ARENA_FITS(BenediniTBS,          ARENA_ANY_SOUND - ARENA_SLOT(OP_Servos));
+    ARENA_FITS(OP_SoundCard,         ARENA_ANY_SOUND);
+    ARENA_FITS(OP_TaigenSound,       ARENA_ANY_SOUND);
+    static_assert(OBJECT_ARENA_SIZE <= 0xFFFF, "Object arena is larger than OP_Arena can address");
+
 // MOTOR IDLE TIMER
-    int IdleOffTimerID = 0;                       // User has the option of setting a length of time, after which, if the engine has been idle the whole time, the engine will automatically turn off. 
+    boolean IdleOffArmed = false;                 // User has the option of setting a length of time, after which, if the engine has been idle the whole time, the engine will automatically turn off. 
+    uint32_t IdleOffStart = 0;                    // millis() time of the last movement. This is updated every loop while we move, so rather than restart a SimpleTimer we just store the time and compare it in CheckEngineIdleTimer()
 
 // DRIVING ADJUSTMENTS
     uint8_t DrivingProfile = 1;                   // There are 2 driving profiles possible - we default to 1, but if the user implements a special function they can change it to 2 (alternate) on the fly
     boolean Nudge = false;                        // We can nudge the motors when first moving from a stop, for a crisper response. When the Nudge flag is true, the nudge effect will be active. 
+    uint32_t NudgeStart = 0;                      // millis() time the nudge began, it ends once NudgeTime_mS has passed
 
 // INERTIAL MEASUREMENT UNIT (IMU)
-//    OP_BNO055 IMU;                                // Class for handling the Bosch BNO055 9DOF IMU sensor (on the Adafruit breakout board) - NOT USED FOR NOW
+    OP_BNO055 IMU;                                // Class for handling the Bosch BNO055 9DOF IMU sensor (on the Adafruit breakout board)
     boolean UseIMU = false;
     boolean IMU_Present = false;
-    boolean IMU_ReadyToSample = true;
     uint8_t BarrelSensitivity;                    // Number from 0-100 that defines how sensitive the barrel stabilization is
     uint8_t HillSensitivity;                      // Number from 0-100 that defines how sensitive the hill physics effect is
+    OP_Incline Incline;                           // Barrel stabilization and hill physics, worked out from the pitch the IMU gives us
 
 // PC COMMUNICATION OBJECT
     OP_PCComm PCComm;
@@ -191,17 +245,18 @@ void setup()
         
     // INIT SERIALS & COMMS
     // -------------------------------------------------------------------------------------------------------------------------------------------------->
-        Serial.begin(USB_BAUD_RATE);                               // Hardware Serial 0 - Connected to FTDI/USB connector. We also have a baud rate in EEPROM (eeprom.ramcopy.USBSerialBaud) but for now we leave this static at the baud rate set in OP_Settings.h
-        AuxSerial.begin(eeprom.ramcopy.AuxSerialBaud);             // Hardware Serial 1 - alternate communication port
+        Serial.begin(USB_BAUD_RATE);                               // Hardware Serial 0 - Connected to FTDI/USB connector. We also have a baud rate in EEPROM (USBSerialBaud) but for now we leave this static at the baud rate set in OP_Settings.h
+        AuxSerial.begin(EEPROM_VAR(AuxSerialBaud));                // Hardware Serial 1 - alternate communication port
         MotorSerial.begin(eeprom.ramcopy.MotorSerialBaud);         // Hardware Serial 2 - reserved for serial motor controllers
-        Serial3Tx.begin(eeprom.ramcopy.Serial3TxBaud);             // Hardware Serial 3 - Receive used for serial radio receivers (SBus,iBus,etc). Tx brought out to Serial 3 connector, but Tx disabled if serial receiver detected. 
+        Serial3Tx.begin(EEPROM_VAR(Serial3TxBaud));                // Hardware Serial 3 - Receive used for serial radio receivers (SBus,iBus,CRSF,etc). Tx brought out to Serial 3 connector, but Tx disabled if serial receiver detected. 
                                                                    //                     The original idea was to use Serial 3 for an Adafruit or Sparkfun serial LCD, and the connector is compatible with those, but no code was written for that application.
         PCComm.begin(&eeprom, &Radio);                             // Initialize the PC communication class. It needs a reference to OP_EEPROM annd OP_Radio objects which we pass by reference.
+        PCComm.setSysInfoHandler(PrintSysInfoCompact);             // OP Config can ask for the compact system info dump while connected (see Utilities tab)
         //PCComm.skipCRC();                                        // We can skip CRC checking for testing, but don't use this in production. 
         SetActiveCommPort();                                       // Check Dipswitch #5 and set the active communication port to USB if switch On, or Serial 1 if switch Off
 
         // Now send our first message out the port, if we initialized the EEPROM
-        SAVE_DEBUG = eeprom.ramcopy.PrintDebug;                    // Does the user want to see debug messages
+        SAVE_DEBUG = EEPROM_VAR(PrintDebug);                       // Does the user want to see debug messages
         DEBUG = false;                                             // But we leave the actual DEBUG initialized to false. It will get set equal to SAVE_DEBUG only after a certain amount of time has passed, so we 
                                                                    // don't put messages out the port right after boot - they could conflict with our ability to detect communication efforts from the PC. 
 
@@ -230,6 +285,7 @@ void setup()
                 eeprom.factoryReset();
                 // In general we try to avoid sending anything out the serial port for a few seconds after boot in case the PC is trying to communicate with us - 
                 // but if we are doing a factory reset, then it's fair to assume we don't need to catch any comms right now. 
+                DebugLog.flush(DebugSerial);        // We print directly from here on, so send anything the log is holding first
                 PrintLines(2);
                 PrintDebugLine();
                 DebugSerial->print(F("FACTORY RESET! "));
@@ -255,18 +311,20 @@ void setup()
         
     // MOTOR OBJECTS
     // -------------------------------------------------------------------------------------------------------------------------------------------------->    
-        TankServos.begin();                             // Do this before setting up motor objects
+        TankServos.begin(SERVO_FRAME_MODE);             // Do this before setting up motor objects. Frame mode is set in OP_Settings.h
+        ObjectArena.setFullHandler(ObjectArenaFull);    // Halts with a message if the object arena is ever too small for the objects below. See ObjectSetup tab. 
         InstantiateMotorObjects();
+        StartTrackSpeed();                              // Closed-loop track speed if the IO ports are set to encoder inputs. See IO tab. 
 
     // OTHER OBJECTS - BEGIN
     // -------------------------------------------------------------------------------------------------------------------------------------------------->    
         Radio.saveTimer(&timer);                        // Pass the radio a pointer our timer object
         Driver.begin(eeprom.ramcopy.DriveType, 
                      eeprom.ramcopy.TurnMode, 
-                     eeprom.ramcopy.NeutralTurnAllowed);
+                     EEPROM_VAR(NeutralTurnAllowed));
         SetDrivingProfile(DrivingProfile);              // See Driving tab
-        TankEngine.begin(eeprom.ramcopy.EnginePauseTime_mS, SAVE_DEBUG, DebugSerial);
-        TankTransmission.begin(SAVE_DEBUG, DebugSerial);
+        TankEngine.begin(EEPROM_VAR(EnginePauseTime_mS), SAVE_DEBUG);
+        TankTransmission.begin(SAVE_DEBUG);
         InstantiateSoundObject();                       // Do this after TankServos.begin();
         InstantiateOptionalServoOutputs();              // Do this after InstantiateSoundObject();
         // The tank object needs to be told whether IR is enabled, the weight class and settings, the IR and Damage protocols to use, whether or not the tank is a repair tank or battle, 
@@ -275,27 +333,27 @@ void setup()
         // First fill a temp battle_seetings struct
         battle_settings BattleSettings;
         BattleSettings.WeightClass = GetWeightClass();  // This is set by the user via dip-switch
-        BattleSettings.ClassSettings = eeprom.ramcopy.CustomClassSettings;
-        BattleSettings.IR_FireProtocol = eeprom.ramcopy.IR_FireProtocol;
-        BattleSettings.IR_Team = eeprom.ramcopy.IR_Team;
-        BattleSettings.IR_HitProtocol_2 = eeprom.ramcopy.IR_HitProtocol_2;
-        BattleSettings.IR_RepairProtocol = eeprom.ramcopy.IR_RepairProtocol;
-        BattleSettings.IR_MGProtocol = eeprom.ramcopy.IR_MGProtocol;
-        BattleSettings.Use_MG_Protocol = eeprom.ramcopy.Use_MG_Protocol;
-        BattleSettings.Accept_MG_Damage = eeprom.ramcopy.Accept_MG_Damage;
-        BattleSettings.DamageProfile = eeprom.ramcopy.DamageProfile;
-        BattleSettings.SendTankID = eeprom.ramcopy.SendTankID;
-        BattleSettings.TankID = eeprom.ramcopy.TankID;
+        BattleSettings.ClassSettings = EEPROM_VAR(CustomClassSettings);
+        BattleSettings.IR_FireProtocol = EEPROM_VAR(IR_FireProtocol);
+        BattleSettings.IR_Team = EEPROM_VAR(IR_Team);
+        BattleSettings.IR_HitProtocol_2 = EEPROM_VAR(IR_HitProtocol_2);
+        BattleSettings.IR_RepairProtocol = EEPROM_VAR(IR_RepairProtocol);
+        BattleSettings.IR_MGProtocol = EEPROM_VAR(IR_MGProtocol);
+        BattleSettings.Use_MG_Protocol = EEPROM_VAR(Use_MG_Protocol);
+        BattleSettings.Accept_MG_Damage = EEPROM_VAR(Accept_MG_Damage);
+        BattleSettings.DamageProfile = EEPROM_VAR(DamageProfile);
+        BattleSettings.SendTankID = EEPROM_VAR(SendTankID);
+        BattleSettings.TankID = EEPROM_VAR(TankID);
         // Now pass the battle settings and other settings
         Tank.begin(BattleSettings, 
-                   eeprom.ramcopy.MechanicalBarrelWithCannon,
+                   EEPROM_VAR(MechanicalBarrelWithCannon),
                    eeprom.ramcopy.Airsoft,
-                   eeprom.ramcopy.ServoRecoilWithCannon,
-                   eeprom.ramcopy.RecoilDelay, 
-                   eeprom.ramcopy.HiFlashWithCannon,
-                   eeprom.ramcopy.AuxFlashWithCannon,
+                   EEPROM_VAR(ServoRecoilWithCannon),
+                   EEPROM_VAR(RecoilDelay), 
+                   EEPROM_VAR(HiFlashWithCannon),
+                   EEPROM_VAR(AuxFlashWithCannon),
                    eeprom.ramcopy.AuxLightFlashTime_mS,
-                   eeprom.ramcopy.MGLightBlink_mS,
+                   EEPROM_VAR(MGLightBlink_mS),
                    RecoilServo, 
                    TankSound,
                    &timer);
@@ -311,21 +369,21 @@ void setup()
     // SETUP SOUND STUFF
     // -------------------------------------------------------------------------------------------------------------------------------------------------->            
         // We retreived our squeak intervals from EEPROM, now load into the sound object
-        TankSound->SetSqueak_Interval(1, eeprom.ramcopy.Squeak1_MinInterval_mS, eeprom.ramcopy.Squeak1_MaxInterval_mS);
-        TankSound->SetSqueak_Interval(2, eeprom.ramcopy.Squeak2_MinInterval_mS, eeprom.ramcopy.Squeak2_MaxInterval_mS);
-        TankSound->SetSqueak_Interval(3, eeprom.ramcopy.Squeak3_MinInterval_mS, eeprom.ramcopy.Squeak3_MaxInterval_mS);
-        TankSound->SetSqueak_Interval(4, eeprom.ramcopy.Squeak4_MinInterval_mS, eeprom.ramcopy.Squeak4_MaxInterval_mS);
-        TankSound->SetSqueak_Interval(5, eeprom.ramcopy.Squeak5_MinInterval_mS, eeprom.ramcopy.Squeak5_MaxInterval_mS);
-        TankSound->SetSqueak_Interval(6, eeprom.ramcopy.Squeak6_MinInterval_mS, eeprom.ramcopy.Squeak6_MaxInterval_mS);          
+        TankSound->SetSqueak_Interval(1, EEPROM_VAR(Squeak1_MinInterval_mS), EEPROM_VAR(Squeak1_MaxInterval_mS));
+        TankSound->SetSqueak_Interval(2, EEPROM_VAR(Squeak2_MinInterval_mS), EEPROM_VAR(Squeak2_MaxInterval_mS));
+        TankSound->SetSqueak_Interval(3, EEPROM_VAR(Squeak3_MinInterval_mS), EEPROM_VAR(Squeak3_MaxInterval_mS));
+        TankSound->SetSqueak_Interval(4, EEPROM_VAR(Squeak4_MinInterval_mS), EEPROM_VAR(Squeak4_MaxInterval_mS));
+        TankSound->SetSqueak_Interval(5, EEPROM_VAR(Squeak5_MinInterval_mS), EEPROM_VAR(Squeak5_MaxInterval_mS));
+        TankSound->SetSqueak_Interval(6, EEPROM_VAR(Squeak6_MinInterval_mS), EEPROM_VAR(Squeak6_MaxInterval_mS));          
         // Also whether squeaks are even enabled
-        TankSound->Squeak_SetEnabled(1, eeprom.ramcopy.Squeak1_Enabled);
-        TankSound->Squeak_SetEnabled(2, eeprom.ramcopy.Squeak2_Enabled);
-        TankSound->Squeak_SetEnabled(3, eeprom.ramcopy.Squeak3_Enabled);
-        TankSound->Squeak_SetEnabled(4, eeprom.ramcopy.Squeak4_Enabled);
-        TankSound->Squeak_SetEnabled(5, eeprom.ramcopy.Squeak5_Enabled);
-        TankSound->Squeak_SetEnabled(6, eeprom.ramcopy.Squeak6_Enabled);        
+        TankSound->Squeak_SetEnabled(1, EEPROM_VAR(Squeak1_Enabled));
+        TankSound->Squeak_SetEnabled(2, EEPROM_VAR(Squeak2_Enabled));
+        TankSound->Squeak_SetEnabled(3, EEPROM_VAR(Squeak3_Enabled));
+        TankSound->Squeak_SetEnabled(4, EEPROM_VAR(Squeak4_Enabled));
+        TankSound->Squeak_SetEnabled(5, EEPROM_VAR(Squeak5_Enabled));
+        TankSound->Squeak_SetEnabled(6, EEPROM_VAR(Squeak6_Enabled));        
         // And whether some other sounds are enabled
-        TankSound->HeadlightSound_SetEnabled(eeprom.ramcopy.HeadlightSound_Enabled);
+        TankSound->HeadlightSound_SetEnabled(EEPROM_VAR(HeadlightSound_Enabled));
         TankSound->TurretSound_SetEnabled(eeprom.ramcopy.TurretSound_Enabled);
         TankSound->BarrelSound_SetEnabled(eeprom.ramcopy.BarrelSound_Enabled);
 
@@ -335,8 +393,7 @@ void setup()
         // Sadly, the Arduino i2c library (called "Wire" or TWI), is completely incompatible with a project of this nature. It breaks every good practice
         // by not only using long delays to block the rest of code, but doing so within ISRs so it blocks other interrupts as well. This wreaks havoc
         // with time-critical tasks like reading the incoming PPM stream, creating the outgoing servo pulses, and reading/writing IR signals. 
-        // Therefore we need to use a non-blocking implementation (the underlying hardware uses interrupts so this should be possible). 
-        // See the OP_I2C library for our version. 
+        // Therefore we use a non-blocking implementation where the TWI interrupt does all the work. See the OP_I2C library for our version. 
         
         // Let's determine if we even want to use the IMU in the first place. Initialize to false. 
         UseIMU = false;
@@ -355,18 +412,10 @@ void setup()
         // Hill physics requires the user to enable it.
         if (eeprom.ramcopy.EnableHillPhysics) UseIMU = true;
 
-        // EDIT: THE IMU IS NOT YET WORKING RELIABLY. I BELIEVE IT IS AN ISSUE WITH I2C COMMUNICATIONS, WHICH OCCASIONALLY CRASH THE PROGRAM. SEVERAL PORTIONS RELATED
-        // TO THE IMU HAVE BEEN COMMENTED-OUT ON THIS TAB OF THE SKETCH, HOWEVER MOST OF THIS CODE IS PERFECTLY FINE IF YOU CAN GET THE LIBRARIES TO DO WHAT THEY'RE 
-        // SUPPOSED TO
-
-        // HARD-CODED TO DISABLE:
-        IMU_Present = false;
-        UseIMU = false;
-/*
         // Now see if the IMU is even attached (don't predicate this on UseIMU = true, because the user may have elected to turn off/on the IMU from the radio)
         IMU.begin();                                // Initialize the IMU class
-        IMU.checkIfPresent();                       // Now see if the IMU can be detected on the bus
-        while (!IMU.process()) { delay(1); }        // Wait for transaction to complete (yes, we block but this is the setup routine so we don't care)
+        IMU.checkIfPresent(UseIMU);                 // Now see if the IMU can be detected on the bus (yes, this one waits for the bus but this is the setup routine so we don't care). 
+                                                    // If the user has enabled one of the IMU features we also give the sensor time to start up, otherwise we don't hold up the boot for it. 
         if (IMU.isPresent()) 
         {   
             //IMU.setup(true, OP_BNO055::OPERATION_MODE_NDOF);    // Device is present, let's see if we can initialize it (true to use external crystal, mode = 9-DOF fusion mode)
@@ -385,19 +434,29 @@ void setup()
             IMU_Present = false; // Not attached
             UseIMU = false;     // If it's not present, we're also not going to be using it.
         }
-*/        
+        
+        // Without the IMU neither feature can work. Turn them off in our working copy, otherwise the barrel would be driven through the stabilization
+        // code (which has no speed limit) without ever actually being stabilized. 
+        if (!IMU_Present)
+        {
+            eeprom.ramcopy.EnableBarrelStabilize = false;
+            eeprom.ramcopy.EnableHillPhysics = false;
+        }
        
         // Now just because IMU_Present might equal true, doesn't mean we will actually use it: UseIMU can still be false if nothing is enabled. 
 
         // We also obtain our sensitivity values
         BarrelSensitivity = eeprom.ramcopy.BarrelSensitivity;
         HillSensitivity = eeprom.ramcopy.HillSensitivity;
+        // And work out the scale factors they translate to, so the main loop doesn't have to
+        SetBarrelStabilizationScale();
+        SetHillPhysicsScale();
              
 
     // LIGHTS
     // -------------------------------------------------------------------------------------------------------------------------------------------------->            
-        RunningLightsDimLevel = map(eeprom.ramcopy.RunningLightsDimLevelPct, 0, 100, 0, 255);   // The user sets the dim level as a percent from 0-100, but we want it as a PWM value from 0-255
-        if (eeprom.ramcopy.RunningLightsAlwaysOn) RunningLightsOn();
+        RunningLightsDimLevel = map(EEPROM_VAR(RunningLightsDimLevelPct), 0, 100, 0, 255);   // The user sets the dim level as a percent from 0-100, but we want it as a PWM value from 0-255
+        if (EEPROM_VAR(RunningLightsAlwaysOn)) RunningLightsOn();
 
        
     // WAIT FOR PC COMM - AND TRY TO DETECT RECEIVER (kill two birds with one stone)
@@ -513,21 +572,16 @@ void loop()
     static int DestroyedBlinkerID = 0;                                // Timer ID for blinking lights when tank is destroyed
     HIT_TYPE HitType;                                                 // If we were hit, what kind of hit was it
 // Inertial Measurement Unit
-    const int IMU_SampleDelay = 20;                                   // The BNO055 can output fusion data up to 100hz. If we set this delay to 20mS that will actually be a refresh rate of 50 times per second. 
-    static boolean IMU_WaitingForSample = false;
+    const int IMU_SamplePeriod = INCLINE_SAMPLE_PERIOD_mS;            // The BNO055 can output fusion data up to 100hz. We sample every 20mS, which is 50 times per second. 
+    static uint32_t IMU_NextSample = 0;                               // millis() when the next sample is due
     static boolean IMU_Updated = false;
-    float rawpitch;
-    static float pitch;
-    const float alpha = 0.90;                                         // Alpha determines the low pass filter on the pitch reading. If Alpha is set to 0.99, it is like taking the average of 100 readings. 
+    static int16_t pitch;                                             // In 1/16ths of a degree, as the sensor gives it to us
 // Barrel stabilization
-    static int Barrel_Level;   
-    static int Barrel_Offset;
     static boolean BarrelPosChanged = true;
-    float TankPitchRange;
 // Hill physics
     static uint16_t ThrottlePulseMin = Radio.Sticks.Throttle.Settings->pulseMin;    // Save these so we can manipulate them but always know what to put them back to
     static uint16_t ThrottlePulseMax = Radio.Sticks.Throttle.Settings->pulseMax;
-    float HillInclineRange;
+    const uint16_t HillMinExtra = 200;                                // Never bring an end-point closer than this to center, or the speed scale would turn around
 // Sounds
     static uint8_t MinSqueakSpeed;
 // Blinkers
@@ -550,10 +604,10 @@ if (Startup)
 {   // This is the first time through the loop - initalize some things
 
     // We take the user setting of NeutralTurnPct and calculate a max speed for neutral turns
-        NeutralTurn_Max = (int)(((float)eeprom.ramcopy.NeutralTurnPct / 100.0) * (float)MOTOR_MAX_FWDSPEED); 
+        NeutralTurn_Max = (int)(((float)EEPROM_VAR(NeutralTurnPct) / 100.0) * (float)MOTOR_MAX_FWDSPEED); 
         
     // Same for the percent of turns that can be applied to the treds in halftrack mode
-        HalftrackTurn_Max = (int)(((float)eeprom.ramcopy.HalftrackTreadTurnPct / 100.0) * (float)MOTOR_MAX_FWDSPEED); 
+        HalftrackTurn_Max = (int)(((float)EEPROM_VAR(HalftrackTreadTurnPct) / 100.0) * (float)MOTOR_MAX_FWDSPEED); 
     
     // Convert the user setting of MaxForwardSpeedPct & MaxReverseSpeedPct into an absolute max forward/reverse speed
         if (eeprom.ramcopy.MaxForwardSpeedPct < 100) { ForwardSpeed_Max = (int)(((float)eeprom.ramcopy.MaxForwardSpeedPct / 100.0) * (float)MOTOR_MAX_FWDSPEED); }
@@ -567,18 +621,18 @@ if (Startup)
     // would only be 70% in absolute terms. For now we leave it as-is, which means that it is possibe for the NudgePct to equal a drive speed greater than the 
     // actual restricted speed limit. This can look silly but the user must be responsible for choosing settings that make sense for his model, and this way gives him
     // the greatest flexibility. 
-        if (eeprom.ramcopy.MotorNudgePct == 0) NudgeEnabled = false;
+        if (EEPROM_VAR(MotorNudgePct) == 0) NudgeEnabled = false;
         else
         {
             NudgeEnabled = true;
-            NudgeAmount = (uint8_t)(((float)eeprom.ramcopy.MotorNudgePct / 100.0) * (float)MOTOR_MAX_FWDSPEED);
+            NudgeAmount = (uint8_t)(((float)EEPROM_VAR(MotorNudgePct) / 100.0) * (float)MOTOR_MAX_FWDSPEED);
         }
 
     // The user can specify a minimum speed percent below which squeaks will not occur. We convert this percent to an absolute speed number. 
-        MinSqueakSpeed = (uint8_t)(((float)eeprom.ramcopy.MinSqueakSpeedPct / 100.0) * (float)MOTOR_MAX_FWDSPEED);
+        MinSqueakSpeed = (uint8_t)(((float)EEPROM_VAR(MinSqueakSpeedPct) / 100.0) * (float)MOTOR_MAX_FWDSPEED);
 
     // If the user enabled LVC, check the voltage every so often
-        if (eeprom.ramcopy.LVC_Enabled)
+        if (EEPROM_VAR(LVC_Enabled))
         {
             EnableRoutineVoltageCheck();   
         }
@@ -609,6 +663,8 @@ if (Startup)
     // PER-LOOP UPDATES
     // -------------------------------------------------------------------------------------------------------------------------------------------------->
         PerLoopUpdates();       // Reads the input button, and updates all timers
+        if (SysInfoStep == 0) DebugLog.update(DebugSerial);     // Send any waiting debug messages, as much as fits in the serial transmit buffer without waiting. 
+        UpdateSysInfoDump();                                    // But not during a system info dump, which prints the next line here and has the port to itself.
 
 
     // CHECK THE BUTTON
@@ -638,14 +694,17 @@ if (Startup)
                             { SetupServo(SERVONUM_TURRETELEVATION); }
                             else
                             { 
-                                if (DEBUG) DebugSerial->println(F("Turret elevation is not of type Servo. No setup available.")); 
+                                if (DEBUG) { DebugLog.flush(DebugSerial); DebugSerial->println(F("Turret elevation is not of type Servo. No setup available.")); }
                                 // Wait for them to release the button before proceeding
                                 do { delay(10); InputButton.read(); } while (!InputButton.wasReleased()); 
                             }
                             break;
                             
                         case 2: 
-                            // Reserved for future use                            
+                            // Compact system info dump for the PC - switch 3 ON & 4 OFF
+                            DumpSysInfoCompact();
+                            // Wait for them to release the button before proceeding
+                            do { delay(10); InputButton.read(); } while (!InputButton.wasReleased()); 
                             break;        
                             
                         case 3: 
@@ -654,7 +713,7 @@ if (Startup)
                             { SetupServo(SERVONUM_TURRETROTATION); }
                             else
                             { 
-                                if (DEBUG) DebugSerial->println(F("Turret rotation is not of type Servo. No setup available.")); 
+                                if (DEBUG) { DebugLog.flush(DebugSerial); DebugSerial->println(F("Turret rotation is not of type Servo. No setup available.")); }
                                 // Wait for them to release the button before proceeding
                                 do { delay(10); InputButton.read(); } while (!InputButton.wasReleased()); 
                             }                            
@@ -684,7 +743,9 @@ if (Startup)
         if (PCComm.CheckPC())
         {   // Yep. Stop everything, then enter listening mode. 
             StopEverything();
+            if (Failsafe) StopFailsafeLights();     // Temporarily disable the failsafe lights
             PCComm.ListenToPC();
+            if (Failsafe) StartFailsafeLights();    // But when we're done talking to the PC, restart them
         }
 
         
@@ -692,83 +753,69 @@ if (Startup)
     // GET IMU DATA - BNO055 9-DOF IMU
     // -------------------------------------------------------------------------------------------------------------------------------------------------->
     // Product:  https://www.adafruit.com/products/2472
-    // Because we are using a non-blockin i2c library, we basically submit a request, go on to do other things, then check back to see if the request is complete.
-    // EDIT: BECAUSE THE IMU IS NOT WORKING RELIABLY YET, THIS PORTION OF CODE HAS BEEN COMMENTED-OUT. HOWEVER THERE IS NOTHING WRONG WITH IT, THE ISSUE IS I2C COMMUNICATIONS.
-    //       WE WILL PROBABLY HAVE TO SWITCH TO SERIAL COMS WITH THE BNO055 OVER THE SERIAL 1 PORT. 
-/*    
+    // Because we are using a non-blocking i2c library, we basically submit a request, go on to do other things, then check back to see if the request is complete.
+    // The TWI interrupt does all the work in between, and each step of it only takes a few uS, so radio decoding and everything else carries on as usual. 
     if (UseIMU && HavePower)
     {
         IMU_Updated = false;    // This can only be true for one loop. We always start it at false, then set it to true below if an update did occur. 
         
-        if (IMU_WaitingForSample)
-        {
-            if (IMU.process())  // Processing is done
+        if (IMU.process())      // Returns true once the sample we asked for has come back
+        {   
+            // Update the reading if the request was successful and the sensor is calibrated
+            if (IMU.transactionSuccessful()) 
             {   
-                // Update the reading if the request was successful and the system calibration level is greater than 0
-                if (IMU.transactionSuccessful()) 
-                {   
-                    // You may actually want to just request accel/gyro readings directly, and fuse them yourself using a complimentary filter. 
-                    // The BNO fusion works well but is constantly going in and out of calibration...
-                    
-                    //if (IMU.calibration.system > 0)   // Use this in 9DOF mode
-                    if (IMU.calibration.gyro > 0 && IMU.calibration.accel > 0)
-                    {
-                        // The beauty of this device is that it provides us absolute orientation directly - the accelerometer, gyro and magnetometer data have all been fused already. 
-                        // The results are floating point Euler angles - in other words, we have pitch, roll and yaw directly without any maths. 
-                        // Range of Euler is 0-359 (360 degrees) 
-                        rawpitch = IMU.orientation.z;             // We can use any axis for pitch so long as we install the sensor in the correct orientation. Z makes most sense from an installation standpoint. 
-                        if (rawpitch >= 180) rawpitch -= 360;     // Convert angles from 0:360 to -180:180 which works better for our purposes
-                        //pitch = alpha * pitch + ((1.0 - alpha) * rawpitch);   // We can apply a filter to the reading to remove glitches if necessary
-                        pitch = rawpitch;
-                        IMU_Updated = true;
-                    }
+                // You may actually want to just request accel/gyro readings directly, and fuse them yourself using a complimentary filter. 
+                // The BNO fusion works well but is constantly going in and out of calibration...
+                
+                //if (IMU.calibration.system > 0)   // Use this in 9DOF mode
+                if (IMU.calibration.gyro > 0 && IMU.calibration.accel > 0)
+                {
+                    // The beauty of this device is that it provides us absolute orientation directly - the accelerometer, gyro and magnetometer data have all been fused already. 
+                    // The results are Euler angles in 1/16ths of a degree - in other words, we have pitch, roll and yaw directly without any maths. 
+                    // We leave it in those units, all the barrel and hill math is integer (see OP_Incline). 
+                    pitch = IMU.orientation.z;                // We can use any axis for pitch so long as we install the sensor in the correct orientation. Z makes most sense from an installation standpoint. 
+                    if (pitch >= (180 * BNO055_LSB_PER_DEGREE)) pitch -= (360 * BNO055_LSB_PER_DEGREE);  // Make sure angles are -180:180 which works better for our purposes
+                    IMU_Updated = true;
                 }
-                IMU_WaitingForSample = false;                           // We got the sample, successful or not, so we are not waiting for anything
-                IMU_ReadyToSample = false;                              // We are also not yet ready to sample again
-                timer.setTimeout(IMU_SampleDelay, SetReadyToSample);    // Instead we wait a while before taking another sample
             }
         }
-        // Request the next reading if we are ready for the next sample
-        if (IMU_ReadyToSample)
+        
+        // Request the next reading at a fixed rate. The next sample is due one period after the last one was due, not after it came back, so the rate doesn't 
+        // drift with how long the bus took. If we have fallen well behind (talking to the PC, say) we just start again from now rather than try to catch up. 
+        if (!IMU.sampling() && (long)(currentMillis - IMU_NextSample) >= 0)
         {
-            IMU.requestEuler();         // Request fusion data
-            IMU_ReadyToSample = false;  // While false, no further samples will be taken
-            IMU_WaitingForSample = true;    // 
+            if (IMU.requestSample())
+            {
+                IMU_NextSample += IMU_SamplePeriod;
+                if ((long)(currentMillis - IMU_NextSample) >= 0) IMU_NextSample = currentMillis + IMU_SamplePeriod;
+            }
         }
     }
-*/
         
 
-    // ADJUST FOR HILLS - DISABLED FOR NOW
+    // ADJUST FOR HILLS
     // -------------------------------------------------------------------------------------------------------------------------------------------------->
-    // THIS WAS NOT QUITE COMPLETED. IF YOU CAN GET THE IMU TO WORK, THIS CODE IS CLOSE, BUT PROBABLY NEEDS A FEW MORE CONDITIONAL CHECKS, AND MAYBE
-    // SOME ADJUSTMENT ON THE RANGES. HOWEVER THE PRINCIPLE IS SOUND AND TESTED TO WORK (eg, the idea that we reduce or increase speed by temporarily 
-    // manipulating the throttle channel end-points)
-    /*
+    // We reduce or increase speed by temporarily manipulating the throttle channel end-points. This may still need some adjustment on the ranges. 
+    // The adjustment is worked out once per IMU sample by Incline, from a scale precomputed from HillSensitivity (see SetHillPhysicsScale on the IMU tab). 
+    // It is signed the same as the pitch: positive nose-up, which pushes the end-point out (less speed) going forward and in (more speed) in reverse. 
     if (eeprom.ramcopy.EnableHillPhysics)
     {
         if (IMU_Updated)
         {
-            HillInclineRange = 120.0 - float(HillSensitivity);   // Range will be 20 to 120
-            //#define MaxHillPulseSubtract 300;
-    //        #define MinExtra 200
-            uint16_t ThrottleAdjust;
-            ThrottleAdjust = abs(int(mapf(pitch, -HillInclineRange,  HillInclineRange, -400, 400))); 
+            Incline.updateHill(pitch);
             // Case where moving forward, or moving in reverse with throttle channel reversed
             if ((DriveModeActual == FORWARD && !Radio.Sticks.Throttle.Settings->reversed) || (DriveModeActual == REVERSE && Radio.Sticks.Throttle.Settings->reversed))
             {
-                if (pitch > 0) { Radio.Sticks.Throttle.Settings->pulseMax = ThrottlePulseMax + ThrottleAdjust; } // Uphill forward   - reduce speed
-                else           { Radio.Sticks.Throttle.Settings->pulseMax = ThrottlePulseMax - ThrottleAdjust; } // Downhill forward - increase speed
-                //Radio.Sticks.Throttle.Settings->pulseMax = max(Radio.Sticks.Throttle.Settings->pulseMax, Radio.Sticks.Throttle.Settings->pulseCenter + MinExtra);
+                Radio.Sticks.Throttle.Settings->pulseMax = ThrottlePulseMax + Incline.hillAdjust();              // Uphill forward reduces speed, downhill increases it
+                Radio.Sticks.Throttle.Settings->pulseMax = max(Radio.Sticks.Throttle.Settings->pulseMax, Radio.Sticks.Throttle.Settings->pulseCenter + HillMinExtra);
                 // Keep the other side of the scale normal because we will use it for braking
                 Radio.Sticks.Throttle.Settings->pulseMin = ThrottlePulseMin;
             }
             // Case where moving in reverse, or moving forward with throttle channel reversed
             else if ((DriveModeActual == REVERSE && !Radio.Sticks.Throttle.Settings->reversed) || (DriveModeActual == FORWARD && Radio.Sticks.Throttle.Settings->reversed))
             {
-                if (pitch > 0) { Radio.Sticks.Throttle.Settings->pulseMin = ThrottlePulseMin + ThrottleAdjust; } // Downhill reverse - increase speed
-                else           { Radio.Sticks.Throttle.Settings->pulseMin = ThrottlePulseMin - ThrottleAdjust; } // Uphill reverse   - reduce speed
-                //Radio.Sticks.Throttle.Settings->pulseMin = min(Radio.Sticks.Throttle.Settings->pulseMin, Radio.Sticks.Throttle.Settings->pulseCenter - MinExtra);
+                Radio.Sticks.Throttle.Settings->pulseMin = ThrottlePulseMin + Incline.hillAdjust();              // Downhill reverse increases speed, uphill reduces it
+                Radio.Sticks.Throttle.Settings->pulseMin = min(Radio.Sticks.Throttle.Settings->pulseMin, Radio.Sticks.Throttle.Settings->pulseCenter - HillMinExtra);
                 // Keep the other side of the scale normal because we will use it for braking
                 Radio.Sticks.Throttle.Settings->pulseMax = ThrottlePulseMax;            
             }
@@ -778,30 +825,21 @@ if (Startup)
     {   // Restore end-points
         Radio.Sticks.Throttle.Settings->pulseMin = ThrottlePulseMin;
         Radio.Sticks.Throttle.Settings->pulseMax = ThrottlePulseMax;
+        Incline.resetHill();                                    // So if it gets turned back on it eases in from level
     }
-    */
     
     
     // GET RX COMMANDS
     // -------------------------------------------------------------------------------------------------------------------------------------------------->
         Radio.GetCommands();    // Only call this once per loop, otherwise you will discard frames
-        // If we have lost connection with the radio, blink some lights and wait for it to reconnect
+        // If we have lost connection with the radio, stop all movement and blink some lights. We don't wait here for the radio to come back, 
+        // the rest of the loop keeps running (hit detection, IO ports, low voltage, timers) but skips anything driven by radio commands while Failsafe is true. 
         if (Radio.InFailsafe) { StartFailsafe(); }
-        while(Radio.InFailsafe)
-        {
-            Radio.GetCommands();
-            if (PCComm.CheckPC()) 
-            {   // Temporarily disable the failsafe lights
-                StopFailsafeLights();
-                // Talk to the computer
-                PCComm.ListenToPC();
-                // But when we're done talking to the PC, restart the lights
-                StartFailsafeLights();
-            }
-            PerLoopUpdates();    // Update timers
+        else if (Failsafe)
+        {   // We're out of failsafe - stop the blinking
+            EndFailsafe();
+            FailsafeRecoveryStart = micros();
         }
-        // We're out of failsafe - stop the blinking
-        EndFailsafe();
 
 
     // GET EXTERNAL INPUTS
@@ -811,14 +849,13 @@ if (Startup)
         
     // SET TURRET 
     // -------------------------------------------------------------------------------------------------------------------------------------------------->
-    // The turret can move without the engine started, but it can't move if the tank has been destroyed (Alive == false)
-    if (Alive & HavePower)
+    // The turret can move without the engine started, but it can't move if the tank has been destroyed (Alive == false), or if we've lost the radio
+    if (Alive && HavePower && !Failsafe)
     {   
         // BARREL UP / DOWN
         // We have two different sets of code for dealing with the barrel. If barrel stabilization is enabled, we manipulate the 
         // Servo_PAN class object called "Barrel"
-        // EDIT: THIS IS TESTED TO WORK WELL. IF YOU GET THE IMU TO WORK RELIABLY, YOU CAN SIMPLY UN-COMMENT THE STUFF BELOW
-/*        if (eeprom.ramcopy.EnableBarrelStabilize) // This will only be enabled if the elevation motor is of the correct type (SERVO_PAN)
+        if (eeprom.ramcopy.EnableBarrelStabilize) // This will only be enabled if the elevation motor is of the correct type (SERVO_PAN)
         {
             // Move barrel up/down in response to user commands
             if (Radio.Sticks.Elevation.updated && (Radio.Sticks.Elevation.ignore == false)) 
@@ -841,36 +878,29 @@ if (Startup)
             {   
                 // Pitch will be a number from -180 to 179 degrees, but most servos will only travel from -45 to 45. But of course some servos
                 // can travel more or less, and the actual range of travel of the barrel will depend on the linkage between the servo and the barrel. 
-                // We adjust sensitivy by changing the range from which the pitch is being mapped. We let the user specify a number from 1 to 100, 
+                // We adjust sensitivy by changing the range of pitch that is mapped across the servo's travel. We let the user specify a number from 1 to 100, 
                 // with 100 being most sensitive. Right in the middle would be 50, which is very close to the -45/45* the sensor is likely to actually move in 
                 // practice, as well as the servo travel. Lower numbers will mean less sensitivity, higher numbers will mean more sensitivity. 
-                TankPitchRange = 100.0 - float(BarrelSensitivity);  // Lower pitch numbers are actually more sensitive, but we want the user to see large numbers as more sensitive.
-                if (eeprom.ramcopy.TurretElevation_Reversed)
-                { Barrel_Level = int(mapf(pitch,  TankPitchRange, -TankPitchRange, eeprom.ramcopy.TurretElevation_EPMin, eeprom.ramcopy.TurretElevation_EPMax)); }
-                else 
-                { Barrel_Level = int(mapf(pitch, -TankPitchRange,  TankPitchRange, eeprom.ramcopy.TurretElevation_EPMin, eeprom.ramcopy.TurretElevation_EPMax)); }
-
+                // That mapping is precomputed into a fixed-point scale whenever the sensitivity or the end-points change (see SetBarrelStabilizationScale on the IMU tab). 
                 
                 // If BarrelPosChanged (and command = 0), we know that the user has finished setting the barrel to a new position.
-                // We save the current level as measured by the accelerometer as our offset for this position. 
+                // We save the current pitch of the tank along with the position the servo stopped at. From here on Incline moves the barrel by however much 
+                // the pitch changes from that reference, in the opposite direction, so the barrel stays at the angle to the ground the user left it at. 
                 if (BarrelPosChanged)
                 {
-                    Barrel_Offset = Barrel_Level;
-                    BarrelPosChanged = false;   // Set this to false so we don't record a new offset until user changes position again. 
+                    Incline.setBarrelReference(pitch, Barrel->fixedPos);
+                    BarrelPosChanged = false;   // Set this to false so we don't record a new reference until user changes position again. 
                 }
-                // Barrel_Level:                 instantaneous pulse width that would set the barrel level with the ground (in other words, a measure of the tank's inclination)
-                // Barrel_Offset:                will be the servo pulse width needed to put the barrel at the actual angle to the ground the user wants, at the inclination the tank was at when the user set it. 
-                // Barrel_Offset - Barrel_Level: the change needed to adjust for a change in inclination since the set point. 
                 
                 // We don't use setSpeed in this case, because by definition this is a pan servo, and setSpeed for pan servos only sets the rate at which they move.
                 // When stabilizing the servo we need to set the position directly, so we use the setPos function of the Servo_PAN class. 
-                Barrel->setPos(Barrel->fixedPos + (Barrel_Offset - Barrel_Level));
+                // Small corrections are ignored and large ones are spread over several samples, so we only write the servo when it actually needs to move. 
+                if (Incline.updateBarrel(pitch)) Barrel->setPos(Incline.barrelPosition());
             }
         }
         // Barrel stabilization is not enabled: in this case we maninpulate the Motor object called "TurretElevation" (because in this case the motor could be anything, not necessarily a pan servo)
         else
         {
-*/            
             if (eeprom.ramcopy.TurretElevationMotor != DRIVE_DETACHED)  // Only apply turret stick movements if we have specified an actual motor type
             {
                 // Move barrel up/down in response to user commands
@@ -884,7 +914,7 @@ if (Startup)
                     }                    
                 }                
             }
-//        }
+        }
 
         // TURRET LEFT / RIGHT
         // Move turret left/right if command has changed. Also check if there is a turret sound associated with this movement
@@ -905,7 +935,8 @@ if (Startup)
 
     // DRIVING
     // -------------------------------------------------------------------------------------------------------------------------------------------------->
-    if (TankEngine.Running() && HavePower)
+    // StartFailsafe() turns the engine off, but an IO port or ad-hoc trigger could start it again. In failsafe we treat it as stopped either way. 
+    if (TankEngine.Running() && HavePower && !Failsafe)
     {
         if (WasRunning == false) { WasRunning = true; }     // Means, we just started the engine running
         
@@ -990,7 +1021,7 @@ if (Startup)
                                 {                                                                
                                     NudgeStarted = true;                                        // Set a flag so we know it first began.
                                     Nudge = true;                                               // Since we are just starting from a stop, we set the Nudge flag
-                                    timer.setTimeout(eeprom.ramcopy.NudgeTime_mS, Nudge_End);   // We will quit nudging after some period of time
+                                    NudgeStart = millis();                                      // We will quit nudging after some period of time
                                 }
                             }
                         }
@@ -1033,6 +1064,9 @@ if (Startup)
 
         }  // End radio update check          
 
+        // Has the nudge effect run for as long as the user wanted? 
+        if (Nudge && (millis() - NudgeStart) >= eeprom.ramcopy.NudgeTime_mS) { Nudge_End(); }
+
 
         // TURN SCALING
         // ---------------------------------------------------------------------------------------------------------------------------------------------->        
@@ -1158,11 +1192,11 @@ if (Startup)
             ThrottleSpeed = Driver.GetThrottleSpeed(ThrottleCommand, ThrottleSpeed_Previous, DriveSpeed, DriveModeActual, Braking); 
         }
 
-        // Now pass the throttle speed to the sound unit and the smoker 
-        if (ThrottleSpeed != ThrottleSpeed_Previous)    // But only if the command has changed from last time...
+        // Now pass the throttle speed to the sound unit and the smoker. This has to be called every time through the loop, the publisher decides 
+        // whether the speed has changed enough (or long enough ago) to be worth sending, and makes sure the final settled speed always goes out. 
+        if (TankSound->PublishEngineSpeed(ThrottleSpeed))       // Sound unit speed (or Benedini Prop1)
         {
-                TankSound->SetEngineSpeed(ThrottleSpeed);    // Sound unit speed
-                SetSmoker_Speed(ThrottleSpeed);              // Smoker speed
+                SetSmoker_Speed(TankSound->PublishedEngineSpeed()); // Smoker speed follows the same updates
         }
 
         // SET DRIVE SPEED 
@@ -1199,7 +1233,15 @@ if (Startup)
                     Driver.MixSteering(DriveSpeed, TurnSpeed, &RightSpeed, &LeftSpeed);  
     
                     //Finally! We send the motor commands out to the motors, but only if something has changed since last time. 
-                    if ((RightSpeed_Previous != RightSpeed) || (LeftSpeed_Previous != LeftSpeed))
+                    if (TrackSpeed.isActive())
+                    {   // If we have encoders on the tracks, the speed loop decides what actually goes to the motors, at its own fixed rate
+                        if (TrackSpeed.update(LeftSpeed, RightSpeed))
+                        {
+                            RightTread->setSpeed(TrackSpeed.output(TRACK_RIGHT));
+                            LeftTread->setSpeed(TrackSpeed.output(TRACK_LEFT));
+                        }
+                    }
+                    else if ((RightSpeed_Previous != RightSpeed) || (LeftSpeed_Previous != LeftSpeed))
                     {
                         RightTread->setSpeed(RightSpeed);
                         LeftTread->setSpeed(LeftSpeed);
@@ -1243,8 +1285,8 @@ if (Startup)
             if (eeprom.ramcopy.BrakesAutoOnAtStop && BrakeLightsActive) { BrakeLightsOff(); }
 
             // If we are moving, keep the idle timer going. Once we come to a stop we'll quit updating it, and if the user has EngineAutoStopTime_mS set to something more than 0 (meaning, they want the 
-            // engine to automatically turn off after a certain amount of time sitting stopped at idle), then when the timer expires it will turn the engine off. UpdateEngineIdleTimer() also starts the timer
-            // if this is the first time we're calling it. 
+            // engine to automatically turn off after a certain amount of time sitting stopped at idle), then once that much time has passed since the last update CheckEngineIdleTimer() will turn the engine off. 
+            // UpdateEngineIdleTimer() also arms the check if this is the first time we're calling it. 
             if (DriveModeActual != STOP)   { UpdateEngineIdleTimer(); }
         }
     }
@@ -1275,7 +1317,14 @@ if (Startup)
     if (HavePower && (eeprom.ramcopy.DriveType == DT_HALFTRACK || eeprom.ramcopy.DriveType == DT_CAR))
     {
         // The servo object knows that "setSpeed" actually means "set servo position." 
-        SteeringServo->setSpeed(Radio.Sticks.Turn.command);   
+        SteeringServo->setSpeed(Radio.Sticks.Turn.command);   // In failsafe the radio class sets this to 0 (centered)
+    }
+
+    // If we just came out of failsafe, the outputs above have now had their first chance to respond to the radio. 
+    if (FailsafeRecoveryStart)
+    {
+        if (DEBUG) { DebugLog.write(LOG_FAILSAFE_RECOVERY, (int16_t)min(micros() - FailsafeRecoveryStart, 0xFFFF)); }
+        FailsafeRecoveryStart = 0;
     }
 
 
@@ -1286,11 +1335,12 @@ if (Startup)
         for (uint8_t t=0; t<triggerCount; t++)
         {
             // Check for any trigger matching the current turret stick position
-            if (Radio.UsingSpecialPositions && Radio.SpecialStick.updated && (eeprom.ramcopy.SF_Trigger[t].TriggerID == Radio.SpecialStick.Position)) { SF_Callback[t](0); }
+            if (!Failsafe && Radio.UsingSpecialPositions && Radio.SpecialStick.updated && (eeprom.ramcopy.SF_Trigger[t].TriggerID == Radio.SpecialStick.Position)) { SF_Callback[t](0); }
     
             // Check for any trigger matched to current aux channel switch positions. Aux channel IDs are set by the formula: 
             // (trigger_id_multiplier_auxchannel * Aux Channel Number) + (number of switch positions * switch_pos_multiplier) + Switch Position
-            for (uint8_t a=0; a<AUXCHANNELS; a++)
+            // Radio triggers are skipped in failsafe, the other triggers below still work. 
+            for (uint8_t a=0; a<AUXCHANNELS && !Failsafe; a++)
             {   // Digital aux channel triggers
                 if (Radio.AuxChannel[a].Settings->Digital && 
                     Radio.AuxChannel[a].updated && 
@@ -1300,10 +1350,10 @@ if (Startup)
                     }
                 // Anallog aux channel triggers
                 if (Radio.AuxChannel[a].Settings->Digital == false &&
-                    Radio.AuxChannel[a].updated &&
                     (eeprom.ramcopy.SF_Trigger[t].TriggerID == (trigger_id_multiplier_auxchannel * (a+1))))
                     {
-                        SF_Callback[t](ScaleAuxChannelPulse_to_AnalogInput(a));
+                        if (Radio.AuxChannel[a].updated) SF_AnalogTrigger(t, ScaleAuxChannelPulse_to_AnalogInput(a));
+                        SF_AnalogSettle(t);
                     }
             } 
 
@@ -1323,10 +1373,10 @@ if (Startup)
                 // Or the user can also keep this as an analog input
                 if (IO_Pin[io].Settings.dataDirection == 0 &&
                     IO_Pin[io].Settings.dataType == false && 
-                    IO_Pin[io].updated &&
                     (eeprom.ramcopy.SF_Trigger[t].TriggerID == (trigger_id_multiplier_ports * (io+1))))
                     {
-                        SF_Callback[t](IO_Pin[io].inputValue);
+                        if (IO_Pin[io].updated) SF_AnalogTrigger(t, IO_Pin[io].inputValue);
+                        SF_AnalogSettle(t);
                     }
             }
 
@@ -1363,7 +1413,7 @@ if (Startup)
         }
         
         // Finally, sort of a one-off trigger: the user has the option of starting the engine with the throttle channel
-        if (eeprom.ramcopy.EngineAutoStart && TankEngine.Running() == false && Radio.Sticks.Throttle.command > 126) // We check for throttle command greater than half
+        if (eeprom.ramcopy.EngineAutoStart && !Failsafe && TankEngine.Running() == false && Radio.Sticks.Throttle.command > 126) // We check for throttle command greater than half
         {
             EngineOn();
         }
@@ -1386,12 +1436,9 @@ if (Startup)
             case HIT_TYPE_CANNON: 
                 if (DEBUG) 
                 { 
-                    DebugSerial->print(F("CANNON HIT! (")); 
-                    DebugSerial->print(ptrIRName(Tank.LastHitProtocol()));
-                    if (Tank.LastHitTeam() != IR_TEAM_NONE) DebugSerial->print(ptrIRTeam(Tank.LastHitTeam()));
-                    DebugSerial->println(F(")"));
+                    DebugLog.write(LOG_CANNON_HIT, ptrIRName(Tank.LastHitProtocol()), (Tank.LastHitTeam() != IR_TEAM_NONE) ? ptrIRTeam(Tank.LastHitTeam()) : NULL);
                     // Were we in the middle of a repair?
-                    if (RepairOngoing) { DebugSerial->println(F("REPAIR OPERATION CANCELLED")); }
+                    if (RepairOngoing) { DebugLog.write(LOG_REPAIR_CANCELLED); }
                 }
                 bitSet(AdHocTriggers, ADHOCT_BIT_CANNON_HIT);           // Set the cannon hit ad-hoc trigger bit (will get canceled later if this was the destruction hit though)
                 if (RepairOngoing) { RepairOngoing = REPAIR_NONE; }     // End repair if we were in the middle of one
@@ -1399,11 +1446,9 @@ if (Startup)
             case HIT_TYPE_MG:
                 if (DEBUG) 
                 { 
-                    DebugSerial->print(F("MACHINE GUN HIT! (")); 
-                    DebugSerial->print(ptrIRName(Tank.LastHitProtocol()));
-                    DebugSerial->println(F(")"));                    
+                    DebugLog.write(LOG_MG_HIT, ptrIRName(Tank.LastHitProtocol()));
                     // Were we in the middle of a repair?
-                    if (RepairOngoing) { DebugSerial->println(F("REPAIR OPERATION CANCELLED")); }
+                    if (RepairOngoing) { DebugLog.write(LOG_REPAIR_CANCELLED); }
                 }
                 if (RepairOngoing) { RepairOngoing = REPAIR_NONE; }   // End repair if we were in the middle of one
                 break;
@@ -1412,12 +1457,7 @@ if (Startup)
                 {                   
                     // This marks the start of a repair operation
                     RepairOngoing = REPAIR_SELF;    // Repair self, meaning, we are the one being repaired
-                    if (DEBUG) 
-                    { 
-                        DebugSerial->print(F("VEHICLE REPAIR STARTED (")); 
-                        DebugSerial->print(ptrIRName(Tank.LastHitProtocol()));
-                        DebugSerial->println(F(")"));                    
-                    }
+                    if (DEBUG) { DebugLog.write(LOG_REPAIR_STARTED, ptrIRName(Tank.LastHitProtocol())); }
                     
                     // Disengage the transmission - we will keep it in neutral until the repair is over. If the tank is moving when the repair operation starts,
                     // it will coast to a stop. 
@@ -1436,6 +1476,7 @@ if (Startup)
             // In this case, we have two treads. Either can be damaged. 
             // If this is a halftrack there is also a steering servo, which for now we don't bother damaging. 
             Tank.Damage(RightTread, LeftTread, TurretRotation, TurretElevation, Smoker, eeprom.ramcopy.SmokerControlAuto, eeprom.ramcopy.DriveType);
+            TrackSpeed.setMaxSpeedPct(RightTread->get_MaxSpeedPct());   // Both treads are cut the same
         }
         else if (eeprom.ramcopy.DriveType == DT_CAR)
         {
@@ -1452,11 +1493,11 @@ if (Startup)
         LeftSpeed_Previous = 0;
 
         // Now show the remaining health level if this was a damaging hit (not a repair hit)
-        if (DEBUG && HitType != HIT_TYPE_REPAIR) { DebugSerial->print(F("Health Level: ")); DebugSerial->print(Tank.PctHealthRemaining()); DebugSerial->println(F("%")); }
+        if (DEBUG && HitType != HIT_TYPE_REPAIR) { DebugLog.write(LOG_HEALTH_LEVEL, Tank.PctHealthRemaining()); }
 
         if (Tank.isDestroyed && Alive)
         {
-            if (DEBUG) { DebugSerial->println(F("TANK DESTROYED")); }
+            if (DEBUG) { DebugLog.write(LOG_TANK_DESTROYED); }
             Alive = false;
             StopEverything();
             bitSet(AdHocTriggers, ADHOCT_BIT_VEHICLE_DESTROYED);    // Set the vehicle destroyed ad-hoc trigger bit 
@@ -1472,8 +1513,8 @@ if (Startup)
     {                   
         if (DEBUG && REPAIR_SELF) // Only show our health level if we were the one being repaired (as opposed to repairing someone else)
         { 
-            DebugSerial->println(F("VEHICLE REPAIR COMPLETE")); 
-            DebugSerial->print(F("Health Level: ")); DebugSerial->print(Tank.PctHealthRemaining()); DebugSerial->println(F("%")); 
+            DebugLog.write(LOG_REPAIR_COMPLETE); 
+            DebugLog.write(LOG_HEALTH_LEVEL, Tank.PctHealthRemaining()); 
         }  
         // Tank repair is over. 
         RepairOngoing = REPAIR_NONE;        
@@ -1494,6 +1535,7 @@ if (Startup)
             {
                 RightTread->restore_Speed();
                 LeftTread->restore_Speed();
+                TrackSpeed.setMaxSpeedPct(100);
                 if (eeprom.ramcopy.DriveType == DT_HALFTRACK) SteeringServo->restore_Speed();
             }
             else // Car or DKLM
@@ -1507,7 +1549,7 @@ if (Startup)
             Smoker_RestoreSpeed();
         // To let the user know the tank is restored, we start the engine
             EngineOn();
-            if (DEBUG) { DebugSerial->println(F("TANK RESTORED")); }
+            if (DEBUG) { DebugLog.write(LOG_TANK_RESTORED); }
     }
 
 
@@ -1522,7 +1564,7 @@ if (Startup)
         // While braking, both the Red and Green LEDs are On. 
         //if (Braking == true && DriveModeActual != STOP)   { RedLedOn(); GreenLedOn(); }
         if (Braking) { RedLedOn(); GreenLedOn(); } else { RedLedOff(); GreenLedOff(); }
-        if (DEBUG && Braking && !Braking_Previous) DebugSerial->println(F("Braking"));
+        if (DEBUG && Braking && !Braking_Previous) DebugLog.write(LOG_BRAKING);
         
         // Notify the user via lights and the debug port (if enabled) of the tank's current direction of travel
         switch (DriveModeActual)
@@ -1534,7 +1576,7 @@ if (Startup)
                     RedLedOff(); 
                     GreenLedOn();
                     // We only print a message if the mode has changed, not every loop. This is the same for all the rest of the cases below. 
-                    if (DEBUG && DriveModeActual != DriveMode_Previous) { DebugSerial->println(F("Moving Forward")); }
+                    if (DEBUG && DriveModeActual != DriveMode_Previous) { DebugLog.write(LOG_MOVING_FORWARD); }
                 }
                 break;
             
@@ -1544,7 +1586,7 @@ if (Startup)
                 {
                     RedLedOn(); 
                     GreenLedOff(); 
-                    if (DEBUG && DriveModeActual != DriveMode_Previous) { DebugSerial->println(F("Moving Reverse")); }
+                    if (DEBUG && DriveModeActual != DriveMode_Previous) { DebugLog.write(LOG_MOVING_REVERSE); }
                 }
                 break;
                 
@@ -1564,7 +1606,7 @@ if (Startup)
                     if (RedBlinker == 0) { RedBlinker = StartBlinking_ms(pin_RedLED, 1, 400); }
                 }
                 // Only print a message if we are just now starting a neutral turn, not every time through the loop
-                if (DEBUG && DriveMode_Previous != NEUTRALTURN) { DebugSerial->println(F("Neutral Turn")); }
+                if (DEBUG && DriveMode_Previous != NEUTRALTURN) { DebugLog.write(LOG_NEUTRAL_TURN); }
                 break;
             
             case STOP: 
@@ -1573,7 +1615,7 @@ if (Startup)
                 {                
                     RedLedOff(); 
                     GreenLedOff();
-                    if (DEBUG && DriveModeActual != DriveMode_Previous) { DebugSerial->println(F("Stopped")); }
+                    if (DEBUG && DriveModeActual != DriveMode_Previous) { DebugLog.write(LOG_STOPPED); }
                 }
                 break;
         }
@@ -7,7 +7,7 @@ void StartFailsafe()
         StopEverything();                           // Stop every physical movement
         Failsafe = true;                            // Set the failsafe flag
         StartFailsafeLights();                      // Start the failsafe blinking effect
-        if (DEBUG) { DebugSerial->println(F("RADIO FAILSAFE")); }
+        if (DEBUG) { DebugLog.write(LOG_RADIO_FAILSAFE); }
     }
 }
 
@@ -17,11 +17,7 @@ void EndFailsafe()
     {
         Failsafe = false;
         StopFailsafeLights();
-        if (SAVE_DEBUG) 
-        { 
-            DebugSerial->print(F("Radio Ready - ")); 
-            DebugSerial->println(RadioProtocol(Radio.getProtocol()));
-        }    
+        if (SAVE_DEBUG) DebugLog.write(LOG_RADIO_READY, RadioProtocol(Radio.getProtocol()));
     }
 }
 
@@ -18,6 +18,7 @@ void SetupServo(ESC_POS_t servoNum)
     int16_t pulseMax;
     
     Servo_PAN * servo;
+    uint16_t arenaMark = ObjectArena.mark();    // The temporary servo object is created in the object arena, and discarded again when we're done
 
     // Before we run setup, stop everything. 
     StopEverything();
@@ -26,12 +27,14 @@ void SetupServo(ESC_POS_t servoNum)
     GreenLedOff();
     RedLedOn();
     
+    // The setup menu prints directly and waits on the user anyway, so send anything the log is holding first
+    DebugLog.flush(DebugSerial);
     DebugSerial->println();
     PrintDebugLine();
     switch (servoNum)
     {
         case SERVONUM_TURRETELEVATION:
-            servo = new Servo_PAN(SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            servo = new (ObjectArena) Servo_PAN(SERVONUM_TURRETELEVATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             reversed = TurretElevation->isReversed();
             pulseMin = servo->getMinPulseWidth(SERVONUM_TURRETELEVATION);
             pulseMax = servo->getMaxPulseWidth(SERVONUM_TURRETELEVATION);
@@ -40,7 +43,7 @@ void SetupServo(ESC_POS_t servoNum)
             break;
 
         case SERVONUM_TURRETROTATION:
-            servo = new Servo_PAN(SERVONUM_TURRETROTATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            servo = new (ObjectArena) Servo_PAN(SERVONUM_TURRETROTATION,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             reversed = TurretRotation->isReversed();
             pulseMin = servo->getMinPulseWidth(SERVONUM_TURRETROTATION);
             pulseMax = servo->getMaxPulseWidth(SERVONUM_TURRETROTATION);
@@ -49,7 +52,7 @@ void SetupServo(ESC_POS_t servoNum)
             break;
             
         case SERVONUM_RECOIL:
-            servo = new Servo_PAN(SERVONUM_RECOIL,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
+            servo = new (ObjectArena) Servo_PAN(SERVONUM_RECOIL,MOTOR_MAX_REVSPEED,MOTOR_MAX_FWDSPEED,0);
             reversed = RecoilServo->isReversed();
             pulseMin = RecoilServo->getMinPulseWidth(SERVONUM_RECOIL);
             pulseMax = RecoilServo->getMaxPulseWidth(SERVONUM_RECOIL);
@@ -150,7 +153,7 @@ void SetupServo(ESC_POS_t servoNum)
                     servo->setMinPulseWidth(servoNum, absMin);
                     if (isRecoil)
                     {
-                        servo->setRampSpeed_mS(servoNum, eeprom.ramcopy.RecoilServo_Return_mS, true);
+                        servo->setRampSpeed_mS(servoNum, EEPROM_VAR(RecoilServo_Return_mS), true);
                         do {PerLoopUpdates();}
                         while (servo->PulseWidth() > pulseMin);
                         servo->stopRamping(servoNum);
@@ -163,7 +166,7 @@ void SetupServo(ESC_POS_t servoNum)
                     servo->setMaxPulseWidth(servoNum, absMax);        
                     if (isRecoil)
                     {
-                        servo->setRampSpeed_mS(servoNum, eeprom.ramcopy.RecoilServo_Return_mS, false);
+                        servo->setRampSpeed_mS(servoNum, EEPROM_VAR(RecoilServo_Return_mS), false);
                         do {PerLoopUpdates();}
                         while (servo->PulseWidth() < pulseMax);
                         servo->stopRamping(servoNum);    
@@ -230,14 +233,12 @@ void SetupServo(ESC_POS_t servoNum)
         //if (!canReverse && ReverseChannel->updated && ReverseChannel->pulse > (ReverseChannel->Settings->pulseCenter - 50) && ReverseChannel->pulse < (ReverseChannel->Settings->pulseCenter + 50) && millis() >= reverseTime ) { canReverse = true; }
         if (!canReverse && ReverseChannel->updated && ReverseChannel->pulse > (ReverseChannel->Settings->pulseCenter - 50) && ReverseChannel->pulse < (ReverseChannel->Settings->pulseCenter + 50)) { canReverse = true; }
         
-        Radio.Update();         // Update radio
-        InputButton.read();     // Read the input button
-        timer.run();            // Update timer
+        PerLoopUpdates();       // Reads the button and updates the radio and timers, and also steps the servo ramp (setSpeed above only sets the ramp rate)
 
     } while (!InputButton.wasPressed());
 
     // Now wait for the release, so it doesn't trigger a release in the main sketch
-    do {InputButton.read();}
+    do {PerLoopUpdates();}
     while (!InputButton.wasReleased());
 
     // Now save settings
@@ -252,6 +253,8 @@ void SetupServo(ESC_POS_t servoNum)
             EEPROM.updateInt(offsetof(_eeprom_data, TurretElevation_EPMin), pulseMin);
             EEPROM.updateInt(offsetof(_eeprom_data, TurretElevation_EPMax), pulseMax);
             EEPROM.updateByte(offsetof(_eeprom_data, TurretElevation_Reversed), reversed);
+            // The barrel stabilization scale depends on the end-points
+            SetBarrelStabilizationScale();
             // Finally, set the actual end-point limits to the servo class
             servo->setMinPulseWidth(SERVONUM_TURRETELEVATION, pulseMin);
             servo->setMaxPulseWidth(SERVONUM_TURRETELEVATION, pulseMax);
@@ -281,11 +284,7 @@ void SetupServo(ESC_POS_t servoNum)
             break;
 
         case SERVONUM_TURRETROTATION:
-            // Save the global variable
-            eeprom.ramcopy.TurretRotation_EPMin = pulseMin;
-            eeprom.ramcopy.TurretRotation_EPMax = pulseMax;
-            eeprom.ramcopy.TurretRotation_Reversed = reversed;
-            // Update eeprom too so it's permanent
+            // These aren't kept in the ramcopy, so we only need to update eeprom
             EEPROM.updateInt(offsetof(_eeprom_data, TurretRotation_EPMin), pulseMin);
             EEPROM.updateInt(offsetof(_eeprom_data, TurretRotation_EPMax), pulseMax);
             EEPROM.updateByte(offsetof(_eeprom_data, TurretRotation_Reversed), reversed);
@@ -315,11 +314,7 @@ void SetupServo(ESC_POS_t servoNum)
             break;
             
         case SERVONUM_RECOIL:
-            // Save the global variable
-            eeprom.ramcopy.RecoilServo_EPMin = pulseMin;
-            eeprom.ramcopy.RecoilServo_EPMax = pulseMax;
-            eeprom.ramcopy.RecoilReversed = reversed;
-            // Update eeprom too so it's permanent
+            // These aren't kept in the ramcopy, so we only need to update eeprom
             EEPROM.updateInt(offsetof(_eeprom_data, RecoilServo_EPMin), pulseMin);
             EEPROM.updateInt(offsetof(_eeprom_data, RecoilServo_EPMax), pulseMax);
             EEPROM.updateByte(offsetof(_eeprom_data, RecoilReversed), reversed);
@@ -327,15 +322,15 @@ void SetupServo(ESC_POS_t servoNum)
             servo->setMinPulseWidth(SERVONUM_RECOIL, pulseMin);
             servo->setMaxPulseWidth(SERVONUM_RECOIL, pulseMax);
             // The reversed setting needs to be applied both to the motor class (flag) as well as to the servo class (actual recoil movement settings). 
-            RecoilServo->set_Reversed(eeprom.ramcopy.RecoilReversed);                       // motor class method
-            RecoilServo->setRecoilReversed(SERVONUM_RECOIL, eeprom.ramcopy.RecoilReversed); // servo class method
+            RecoilServo->set_Reversed(reversed);                                           // motor class method
+            RecoilServo->setRecoilReversed(SERVONUM_RECOIL, reversed);                     // servo class method
             // Let's make sure we put the recoil servo back to battery on exit, since it's possible they exited while adjusting the recoil side           
             pulseNow = servo->getPulseWidth(servoNum);
-            if ((eeprom.ramcopy.RecoilReversed && pulseNow != servo->getMinPulseWidth(servoNum)) || (!eeprom.ramcopy.RecoilReversed && pulseNow != servo->getMaxPulseWidth(servoNum)))
+            if ((reversed && pulseNow != servo->getMinPulseWidth(servoNum)) || (!reversed && pulseNow != servo->getMaxPulseWidth(servoNum)))
             {   // The recoil servo is not at battery. Let's return it. 
-                if (eeprom.ramcopy.RecoilReversed)
+                if (reversed)
                 {
-                    servo->setRampSpeed_mS(servoNum, eeprom.ramcopy.RecoilServo_Return_mS, true);
+                    servo->setRampSpeed_mS(servoNum, EEPROM_VAR(RecoilServo_Return_mS), true);
                     do {PerLoopUpdates();}
                     while (servo->PulseWidth() > pulseMin);
                     servo->stopRamping(servoNum);
@@ -343,7 +338,7 @@ void SetupServo(ESC_POS_t servoNum)
                 }
                 else
                 {
-                    servo->setRampSpeed_mS(servoNum, eeprom.ramcopy.RecoilServo_Return_mS, false);
+                    servo->setRampSpeed_mS(servoNum, EEPROM_VAR(RecoilServo_Return_mS), false);
                     do {PerLoopUpdates();}
                     while (servo->PulseWidth() < pulseMax);
                     servo->stopRamping(servoNum);    
@@ -366,6 +361,7 @@ void SetupServo(ESC_POS_t servoNum)
     DebugSerial->print(F("Reversed:  ")); PrintLnTrueFalse(reversed);
     DebugSerial->println();
     
+    ObjectArena.release(arenaMark);
     RedLedOff();
 }
 
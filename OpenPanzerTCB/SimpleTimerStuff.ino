@@ -11,9 +11,11 @@ void PerLoopUpdates(void)
 void UpdateSimpleTimers()
 {
     timer.run();                        // Our simple timer object, used all over the place including by various libraries.  
-    Radio.Update();                     // Radio update (polls SBus and iBus)
+    Radio.Update();                     // Radio update (polls SBus, iBus and CRSF)
     TankEngine.UpdateTimer();           // Engine timer (see OP_Driver library)
     TankTransmission.UpdateTimer();     // Transmission timer (see OP_Driver library)
+    TankServos.updateRamps();           // Servo ramping and recoil effects (see OP_Servo library)
+    CheckEngineIdleTimer();             // Engine auto-stop (see Driving tab)
     
     // Now we also update the four motor objects. The motor update() routines will only do something if the motor type is a serial controller. 
     // We can use this to force serial commands be sent at set intervals even if the command hasn't changed; this keeps us from tripping the serial 
@@ -21,7 +21,7 @@ void EnableSmoker()
     if (!SmokerEnabled)
     {
         SmokerEnabled = true;
-        if (DEBUG) { DebugSerial->println(F("Smoker enabled")); }
+        if (DEBUG) { DebugLog.write(LOG_SMOKER_ENABLE); }
 
         // Also, if they enable while the engine is running, we need to auto-turn it on
         if (TankEngine.Running())
@@ -36,7 +36,7 @@ void DisableSmoker()
     if (SmokerEnabled)
     {
         SmokerEnabled = false;
-        if (DEBUG) { DebugSerial->println(F("Smoker disabled")); }
+        if (DEBUG) { DebugLog.write(LOG_SMOKER_DISABLE); }
         
         // Also, if they disable while the engine is running, we need to auto turn it off
         if (TankEngine.Running()) ShutdownSmoker(TankTransmission.Engaged());
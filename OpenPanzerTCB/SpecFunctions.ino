@@ -12,7 +12,10 @@ void LoadFunctionTriggers()
     // Here we setup the special functions list. The user can create up to MAX_FUNCTION_TRIGGERS (40 for now) pairs of Triggers-to-Functions.
     // Here we save the callback function address for each trigger. 
     for (int i = 0; i <MAX_FUNCTION_TRIGGERS; i++)
-    {   // A valid function-trigger will have a function number and a TriggerID > 0
+    {   // Nothing has been passed to any analog function yet (see SF_AnalogTrigger below)
+        SF_AnalogState[i].lastValue = SF_AnalogState[i].pendingValue = ANALOG_SF_NONE;
+        
+        // A valid function-trigger will have a function number and a TriggerID > 0
         if (eeprom.ramcopy.SF_Trigger[i].specialFunction != SF_NULL_FUNCTION && eeprom.ramcopy.SF_Trigger[i].TriggerID > 0)
         {
             //DebugSerial->print(F("TriggerID: "));
@@ -490,6 +493,70 @@ void SF_DecreaseVolume(uint16_t ignoreMe)       { DecreaseVolume();         }
 void SF_StopVolume(uint16_t ignoreMe)           { StopVolume();             }
 
 
+// ----------------------------------------------------------------------------------------------------------------------------------------------->>
+// ANALOG TRIGGER DISPATCH
+// ----------------------------------------------------------------------------------------------------------------------------------------------->>
+// The main loop hands every new value from an analog trigger (aux channel knob or analog input on port A or B) to SF_AnalogTrigger rather than calling
+// the function directly, and calls SF_AnalogSettle for the same trigger slot every time through. See the notes above ANALOG_SF_SETTLE_mS in OP_FunctionsTriggers.h
+void SF_AnalogTrigger(uint8_t t, uint16_t level)
+{
+    analog_trigger_state &ats = SF_AnalogState[t];
+    
+    if (level == ats.lastValue)
+    {   // Back to the value the function already has, so nothing to settle
+        ats.pendingValue = level;
+    }
+    else if (ats.lastValue == ANALOG_SF_NONE || 
+             abs((int16_t)level - (int16_t)ats.lastValue) >= AnalogFunctionThreshold(eeprom.ramcopy.SF_Trigger[t].specialFunction) ||
+             level == ANALOG_SPECFUNCTION_MIN_VAL || level == ANALOG_SPECFUNCTION_MAX_VAL)
+    {   // First value, a real movement, or the end of the range - pass it on now
+        ats.lastValue = ats.pendingValue = level;
+        SF_Callback[t](level);
+    }
+    else if (level != ats.pendingValue)
+    {   // A small change. Hold on to it, and start timing how long the input stays here. 
+        ats.pendingValue = level;
+        ats.pendingSince = (uint16_t)millis();
+    }
+}
+
+void SF_AnalogSettle(uint8_t t)
+{
+    analog_trigger_state &ats = SF_AnalogState[t];
+    
+    // If a small change has been held long enough without the input moving again, it's where the input settled, so pass it on
+    if (ats.pendingValue != ats.lastValue && (uint16_t)((uint16_t)millis() - ats.pendingSince) >= ANALOG_SF_SETTLE_mS)
+    {
+        ats.lastValue = ats.pendingValue;
+        SF_Callback[t](ats.lastValue);
+    }
+}
+
+uint8_t AnalogFunctionThreshold(_special_function sf)
+{
+    switch (sf)
+    {
+        case SF_SET_VOLUME:         return ANALOG_SF_THRESHOLD_VOLUME;
+        
+        case SF_BARREL_STAB_LEVEL:
+        case SF_HILLS_LEVEL:        return ANALOG_SF_THRESHOLD_PERCENT;
+        
+        case SF_SMOKER:
+        case SF_MOTOR_A:
+        case SF_MOTOR_B:
+        case SF_AUXOUT_LEVEL:       return ANALOG_SF_THRESHOLD_PWM;
+        
+        case SF_RC1_PASS:       case SF_RC2_PASS:       case SF_RC3_PASS:       case SF_RC4_PASS:       
+        case SF_RC6_PASS:       case SF_RC7_PASS:       case SF_RC8_PASS:
+        case SF_RC1_PASS_PAN:   case SF_RC2_PASS_PAN:   case SF_RC3_PASS_PAN:   case SF_RC4_PASS_PAN:   
+        case SF_RC6_PASS_PAN:   case SF_RC7_PASS_PAN:   case SF_RC8_PASS_PAN:
+                                    return ANALOG_SF_THRESHOLD_SERVO;
+        
+        default:                    return ANALOG_SF_THRESHOLD_DEFAULT;
+    }
+}
+
+
 // ----------------------------------------------------------------------------------------------------------------------------------------------->>
 // INPUT PARAMETER SCALING
 // ----------------------------------------------------------------------------------------------------------------------------------------------->>
@@ -532,7 +599,7 @@ void SF_SetAccelRampFreq(uint16_t val)
         if (sn != Driver.getAccelRampFrequency())
         {
             Driver.setAccelRampFrequency(sn); 
-            if (DEBUG) { DebugSerial->print(F("Set Accel Ramp Level: ")); DebugSerial->println(sn); } 
+            if (DEBUG) { DebugLog.write(LOG_ACCEL_RAMP_LEVEL, sn); } 
         }
     }
 }
@@ -545,7 +612,7 @@ void SF_SetDecelRampFreq(uint16_t val)
         if (sn != Driver.getDecelRampFrequency())
         {
             Driver.setDecelRampFrequency(sn); 
-            if (DEBUG) { DebugSerial->print(F("Set Decel Ramp Level: ")); DebugSerial->println(sn); }
+            if (DEBUG) { DebugLog.write(LOG_DECEL_RAMP_LEVEL, sn); }
         }
     }
 }
@@ -559,8 +626,9 @@ void SetBarrelSensitivity(uint16_t level)
     // Only update if changed
     if (BarrelSensitivity != bs)
     {
-        BarrelSensitivity = bs; 
-        if (DEBUG) { DebugSerial->print(F("Set Barrel Sensitivity: ")); PrintLnPct(bs); } 
+        BarrelSensitivity = bs;
+        SetBarrelStabilizationScale();
+        if (DEBUG) { DebugLog.write(LOG_BARREL_SENSITIVITY, bs); } 
     }
 }  
 void SetHillSensitivity(uint16_t level)         
@@ -569,8 +637,9 @@ void SetHillSensitivity(uint16_t level)
     // Only update if changed
     if (HillSensitivity != hs)
     {
-        HillSensitivity = hs;     
-        if (DEBUG) { DebugSerial->print(F("Set Hill Sensitivity: ")); PrintLnPct(hs); } 
+        HillSensitivity = hs;
+        SetHillPhysicsScale();
+        if (DEBUG) { DebugLog.write(LOG_HILL_SENSITIVITY, hs); } 
     }
 }  
 
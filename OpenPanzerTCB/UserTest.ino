@@ -7,7 +7,7 @@ void UserFunction1(void)
 {
     // Do something here
 
-    if (DEBUG) DebugSerial->println(F("User Function 1")); 
+    if (DEBUG) DebugLog.write(LOG_USER_FUNCTION, 1); 
 }
 
 
@@ -15,7 +15,7 @@ void UserFunction2(void)
 {
     // Do something here
 
-    if (DEBUG) DebugSerial->println(F("User Function 2")); 
+    if (DEBUG) DebugLog.write(LOG_USER_FUNCTION, 2); 
 }
 
 
@@ -34,7 +34,7 @@ void User_Analog_Function1(uint16_t level)
         
         // Do something here with "level"    
         
-        if (DEBUG) { DebugSerial->print(F("Analog User Function 1 - ")); DebugSerial->println(level); }
+        if (DEBUG) { DebugLog.write(LOG_ANALOG_USER_FUNCTION, 1, level); }
     }
 }
 
@@ -48,7 +48,7 @@ void User_Analog_Function2(uint16_t level)
         
         // Do something here with "level"    
         
-        if (DEBUG) { DebugSerial->print(F("Analog User Function 2 - ")); DebugSerial->println(level); }
+        if (DEBUG) { DebugLog.write(LOG_ANALOG_USER_FUNCTION, 2, level); }
     }
 }
 
@@ -16,8 +16,7 @@ void RestoreDebug()
 
 void PrintDebugLine()
 {
-    for (uint8_t i=0; i<45; i++) { DebugSerial->print(F("-")); }
-    DebugSerial->println(); 
+    PrintDashes();
     DebugSerial->flush();   // This causes a pause until the serial transmission is complete
 }
 
@@ -92,7 +91,7 @@ void PrintLnPct(uint8_t pct)
 }
 void PrintWaitingForRadio()
 {   // Only print this message if we are still waiting for the radio to be plugged in.
-    if (SAVE_DEBUG && Radio.Status() != READY_state) { DebugSerial->println(F("Waiting for radio... ")); }
+    if (SAVE_DEBUG && Radio.Status() != READY_state) { DebugLog.flush(DebugSerial); DebugSerial->println(F("Waiting for radio... ")); }
 }
 
 float Convert_mS_to_Sec(int mS)
@@ -100,142 +99,357 @@ float Convert_mS_to_Sec(int mS)
     return float(mS) / 1000.0;
 }
 
+// SYSTEM INFO DUMP
+// -------------------------------------------------------------------------------------------------------------------------------------------------->
+// The full dump is a couple thousand characters. Printing it all at once used to hold up the main loop for about 1/3 second, long enough to cause a 
+// brief radio failsafe. Now DumpSysInfo() only marks a dump as requested, and UpdateSysInfoDump(), called every time through the main loop, prints the 
+// next line. It only does so once the serial transmit buffer has emptied, and no line is longer than the buffer, so printing never has to wait and 
+// driving carries on in between. Each section is a function that takes a line number, prints that line and returns true, or returns false without 
+// printing anything once it has run out of lines. A few lines are too long for the buffer; those are printed in two pieces, on two passes. 
+// DumpSysInfoCompact() starts a shorter, machine-readable dump for the PC instead: one "$SI,key,values..." line per item, between "$SI,BEGIN" and 
+// "$SI,END" lines. Values are numbers rather than names (drive types, sound device, IR protocol and so on are the same enum values OP Config uses). 
+// OP Config can also ask for the compact dump while it is connected (PCCMD_SYSINFO_COMPACT), in which case PrintSysInfoCompact() prints it in one go. 
+// While a dump is in progress the debug log holds on to its messages (see the main loop), so they can't land in the middle of a line. 
+
+#ifndef SERIAL_TX_BUFFER_SIZE
+    #define SERIAL_TX_BUFFER_SIZE   64      // Defined by HardwareSerial in newer cores
+#endif
+#ifndef SERIAL_RX_BUFFER_SIZE
+    #define SERIAL_RX_BUFFER_SIZE   64
+#endif
+#define SYSINFO_TX_FREE             (SERIAL_TX_BUFFER_SIZE - 1)     // HardwareSerial can only hold one less than its buffer size, so this means "empty"
+#define SYSINFO_SECTIONS            16      // Number of sections in the full dump (see DumpSysInfoSection)
+#define SYSINFO_COMPACT_SECTIONS    10      // And in the compact dump (see DumpSysInfoCompactSection)
+
 void DumpSysInfo()
 {
-    // All this printing can take some time, so we sprinkle some per-loop-updates throughout. 
-    // I also added some flush commands, which pauses until all serial data has left the transmit buffer. 
-    // As it turns out, all the garbled serial only happens when using the Arduino IDE serial monitor, or just
-    // if I have the IDE open even if I am using some other program (such as Snoop in OP Config). 
-    // Once the Arduino IDE is closed, then I get perfectly smooth serial. Not sure what the deal is with the IDE. 
-    // The PerLoopUpdates() are good to leave in, and the serial flush commands are probably unnecessary, but
-    // don't hurt anything, so I leave them too. 
+    StartSysInfoDump(false);
+}
+
+void DumpSysInfoCompact()
+{
+    StartSysInfoDump(true);
+}
 
-    // This whole dump takes about 1/3 second. It is likely to cause a brief radio failsafe event, which will correct itself immediately after. 
+void StartSysInfoDump(boolean compact)
+{
+    // If a dump is already in progress we let it finish rather than start over
+    if (SysInfoStep > 0) return;
     
-    DumpVersion();
-        PerLoopUpdates();
-        DebugSerial->flush();
-    DumpRadioInfo();
-        PerLoopUpdates();
-        DebugSerial->flush();
-    DumpMotorInfo();
-        PerLoopUpdates();
-        DebugSerial->flush();    
-    DumpDriveSettings();
-        PerLoopUpdates();
-        DebugSerial->flush();    
-    DumpTurretInfo();
-        PerLoopUpdates();
-        DebugSerial->flush();    
-    DumpBattleInfo();
-        PerLoopUpdates();
-        DebugSerial->flush();
-    DumpSoundInfo();
-        PerLoopUpdates();
-        DebugSerial->flush();        
-    DumpIMUInfo();
-        PerLoopUpdates();
-        DebugSerial->flush();    
-    DumpFunctionTriggers();
-        PerLoopUpdates();
-        DebugSerial->flush();    
-    DumpVoltage();
-        PerLoopUpdates();
-        DebugSerial->flush();    
-    DumpBaudRates();
-        PerLoopUpdates();
-        DebugSerial->flush();    
-    DebugSerial->println();
-    PrintDebugLine();    
+    DebugLog.flush(DebugSerial);    // Send any debug messages still waiting, so they don't end up in the middle of the dump
+    SysInfoCompact = compact;
+    SysInfoItem = 0;
+    SysInfoStep = 1;
 }
 
-void DumpVersion()
+// Called by PCComm when OP Config asks for the compact dump. In communication mode the main loop isn't running and everything is stopped, so we 
+// print the whole thing here and only return once it has gone out the port. The debug log holds on to its messages until we're back in the main loop. 
+void PrintSysInfoCompact()
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->print(F("FIRMWARE VERSION: "));
-    String str = FIRMWARE_VERSION;
-    DebugSerial->println(str);
+    SysInfoCompact = true;      // If the PC connected in the middle of a dump, this starts over with the compact one
+    SysInfoItem = 0;
+    SysInfoStep = 1;
+    while (SysInfoStep > 0) UpdateSysInfoDump();
+    DebugSerial->flush();
 }
 
-void DumpRadioInfo()
+void UpdateSysInfoDump()
 {
-    DumpStickInfo();
-    DumpAuxChannelsInfo();
-    DumpChannelsDetectedUtilized();
+    if (SysInfoStep == 0) return;                                       // No dump in progress
+    if (DebugSerial->availableForWrite() < SYSINFO_TX_FREE) return;     // Last line hasn't finished going out yet
+    
+    // Print the next line of this section. If the section has run out of lines, go straight on to the first line of the next one. 
+    // Sections that skip over items they have nothing to print for (function triggers) move SysInfoItem along themselves, which is why it is passed by reference. 
+    while (!(SysInfoCompact ? DumpSysInfoCompactSection(SysInfoStep, SysInfoItem) : DumpSysInfoSection(SysInfoStep, SysInfoItem)))
+    {
+        SysInfoItem = 0;
+        if (++SysInfoStep > (SysInfoCompact ? SYSINFO_COMPACT_SECTIONS : SYSINFO_SECTIONS)) 
+        {   // That was the last section
+            SysInfoStep = 0;
+            return;
+        }
+    }
+    SysInfoItem++;
 }
 
-void DumpStickInfo()
+// Print line n of a section of the full dump. Returns false if the section has no line n. A section may move n on to the line it actually printed. 
+boolean DumpSysInfoSection(uint8_t section, uint8_t &n)
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->print(F("RADIO INFO - ")); DebugSerial->println(RadioProtocol(Radio.getProtocol()));
-    PrintDebugLine();
-    DebugSerial->println(F("Stick       Min    Center   Max    Deadband  Reversed"));
-    PrintDebugLine();
-    DebugSerial->print(F("Throttle   ")); if (Radio.Sticks.Throttle.Settings->pulseMin < 1000) { PrintSpace(); } DebugSerial->print(Radio.Sticks.Throttle.Settings->pulseMin); PrintSpaces(4); DebugSerial->print(Radio.Sticks.Throttle.Settings->pulseCenter); PrintSpaces(5); DebugSerial->print(Radio.Sticks.Throttle.Settings->pulseMax); PrintSpaces(4); DebugSerial->print(Radio.Sticks.Throttle.Settings->deadband); PrintSpaces(8); PrintLnTrueFalse(Radio.Sticks.Throttle.Settings->reversed); 
-    DebugSerial->print(F("Turn       ")); if (Radio.Sticks.Turn.Settings->pulseMin < 1000) { PrintSpace(); } DebugSerial->print(Radio.Sticks.Turn.Settings->pulseMin); PrintSpaces(4); DebugSerial->print(Radio.Sticks.Turn.Settings->pulseCenter); PrintSpaces(5); DebugSerial->print(Radio.Sticks.Turn.Settings->pulseMax); PrintSpaces(4); DebugSerial->print(Radio.Sticks.Turn.Settings->deadband); PrintSpaces(8); PrintLnTrueFalse(Radio.Sticks.Turn.Settings->reversed); 
-    DebugSerial->print(F("Elevation  ")); if (Radio.Sticks.Elevation.Settings->pulseMin < 1000) { PrintSpace(); } DebugSerial->print(Radio.Sticks.Elevation.Settings->pulseMin); PrintSpaces(4); DebugSerial->print(Radio.Sticks.Elevation.Settings->pulseCenter); PrintSpaces(5); DebugSerial->print(Radio.Sticks.Elevation.Settings->pulseMax); PrintSpaces(4); DebugSerial->print(Radio.Sticks.Elevation.Settings->deadband); PrintSpaces(8); PrintLnTrueFalse(Radio.Sticks.Elevation.Settings->reversed); 
-    DebugSerial->print(F("Azimuth    ")); if (Radio.Sticks.Azimuth.Settings->pulseMin < 1000) { PrintSpace(); } DebugSerial->print(Radio.Sticks.Azimuth.Settings->pulseMin); PrintSpaces(4); DebugSerial->print(Radio.Sticks.Azimuth.Settings->pulseCenter); PrintSpaces(5); DebugSerial->print(Radio.Sticks.Azimuth.Settings->pulseMax); PrintSpaces(4); DebugSerial->print(Radio.Sticks.Azimuth.Settings->deadband); PrintSpaces(8); PrintLnTrueFalse(Radio.Sticks.Azimuth.Settings->reversed); 
+    switch (section)
+    {
+        case 1:  return DumpVersion(n);
+        case 2:  return DumpStickInfo(n);
+        case 3:  return DumpAuxChannelsInfo(n);
+        case 4:  return DumpChannelsDetectedUtilized(n);
+        case 5:  return DumpMotorInfo(n);
+        case 6:  return DumpDriveSettings(n);
+        case 7:  return DumpTurretInfo(n);
+        case 8:  return DumpBattleInfo(n);
+        case 9:  return DumpSoundInfo(n);
+        case 10: return DumpIMUInfo(n);
+        case 11: return DumpFunctionTriggersHeader(n);
+        case 12: return DumpFunctionTriggers(n);
+        case 13: return DumpVoltage(n);
+        case 14: return DumpBaudRates(n);
+        case 15: return DumpMemoryInfo(n);
+        case 16: if (n > 0) return false;
+                 DebugSerial->println(); 
+                 PrintDashes();
+                 return true;
+    }
+    return false;
+}
 
+// Print line n of a section of the compact dump. Returns false if the section has no line n. A section may move n on to the line it actually printed. 
+boolean DumpSysInfoCompactSection(uint8_t section, uint8_t &n)
+{
+    switch (section)
+    {
+        case 1: 
+            switch (n)
+            {
+                case 0: DebugSerial->println(F("$SI,BEGIN")); break;
+                case 1: DebugSerial->print(F("$SI,FW,")); DebugSerial->println(F(FIRMWARE_VERSION)); break;
+                default: return false;
+            }
+            break;
+        case 2: 
+            if (n > 0) return false;
+            DebugSerial->print(F("$SI,RADIO,")); DebugSerial->print((uint8_t)Radio.getProtocol()); 
+            DebugSerial->print(F(",")); DebugSerial->print(Radio.getChannelCount()); 
+            DebugSerial->print(F(",")); DebugSerial->println(Radio.ChannelsUtilized);
+            break;
+        case 3: 
+            switch (n)
+            {
+                case 0: 
+                    DebugSerial->print(F("$SI,MOTORS,")); DebugSerial->print((uint8_t)eeprom.ramcopy.DriveType);
+                    DebugSerial->print(F(",")); DebugSerial->print((uint8_t)EEPROM_VAR(DriveMotors));
+                    DebugSerial->print(F(",")); DebugSerial->print((uint8_t)eeprom.ramcopy.TurretRotationMotor);
+                    DebugSerial->print(F(",")); DebugSerial->println((uint8_t)eeprom.ramcopy.TurretElevationMotor);
+                    break;
+                case 1: 
+                    // Track speed loop active, then measured speed of the left and right tracks in encoder counts per second
+                    DebugSerial->print(F("$SI,TRACKSPEED,")); DebugSerial->print(TrackSpeed.isActive());
+                    DebugSerial->print(F(",")); DebugSerial->print(TrackSpeed.measuredCPS(TRACK_LEFT));
+                    DebugSerial->print(F(",")); DebugSerial->println(TrackSpeed.measuredCPS(TRACK_RIGHT));
+                    break;
+                case 2: 
+                    DebugSerial->print(F("$SI,ARENA,")); DebugSerial->print(ObjectArena.used());
+                    DebugSerial->print(F(",")); DebugSerial->println(ObjectArena.reserved());
+                    break;
+                default: return false;
+            }
+            break;
+        case 4: 
+            if (n > 0) return false;
+            DebugSerial->print(F("$SI,SOUND,")); DebugSerial->print(EEPROM_VAR(SoundDevice));
+            DebugSerial->print(F(",")); DebugSerial->print(TankSound->EngineSpeedUpdatesSent());
+            DebugSerial->print(F(",")); DebugSerial->println(TankSound->EngineSpeedUpdatesSuppressed());
+            break;
+        case 5: 
+            switch (n)
+            {
+                case 0: 
+                    DebugSerial->print(F("$SI,BATTLE,")); DebugSerial->print((uint8_t)Tank.BattleSettings.IR_FireProtocol);
+                    DebugSerial->print(F(",")); DebugSerial->print((uint8_t)Tank.BattleSettings.IR_Team);
+                    DebugSerial->print(F(",")); DebugSerial->print(Tank.isRepairTank());
+                    DebugSerial->print(F(",")); DebugSerial->println((uint8_t)Tank.BattleSettings.WeightClass);
+                    break;
+                case 1: 
+                    DebugSerial->print(F("$SI,IMU,")); DebugSerial->print(IMU_Present);
+                    DebugSerial->print(F(",")); DebugSerial->print(eeprom.ramcopy.EnableBarrelStabilize);
+                    DebugSerial->print(F(",")); DebugSerial->println(eeprom.ramcopy.EnableHillPhysics);
+                    break;
+                default: return false;
+            }
+            break;
+        case 6: 
+            if (n > 0) return false;
+            // Battery voltage in mV, 0 if no battery is detected
+            DebugSerial->print(F("$SI,POWER,")); DebugSerial->print(IsBatteryUnplugged() ? 0 : (uint16_t)(ReadVoltage() * 1000.0));
+            DebugSerial->print(F(",")); DebugSerial->print(EEPROM_VAR(LVC_Enabled));
+            DebugSerial->print(F(",")); DebugSerial->println(eeprom.ramcopy.LVC_Cutoff_mV);
+            break;
+        case 7: 
+            if (n > 0) return false;
+            DebugSerial->print(F("$SI,BAUD,")); DebugSerial->print(EEPROM_VAR(USBSerialBaud));
+            DebugSerial->print(F(",")); DebugSerial->print(eeprom.ramcopy.MotorSerialBaud);
+            DebugSerial->print(F(",")); DebugSerial->print(EEPROM_VAR(AuxSerialBaud));
+            DebugSerial->print(F(",")); DebugSerial->println(EEPROM_VAR(Serial3TxBaud));
+            break;
+        case 8: 
+            // One line per valid function trigger: TriggerID, function number. Skip over empty trigger slots so we don't waste a pass on each one. 
+            while (n < MAX_FUNCTION_TRIGGERS && !FunctionTriggerValid(n)) n++;
+            if (n >= MAX_FUNCTION_TRIGGERS) return false;
+            DebugSerial->print(F("$SI,TRIGGER,")); DebugSerial->print(eeprom.ramcopy.SF_Trigger[n].TriggerID);
+            DebugSerial->print(F(",")); DebugSerial->println(eeprom.ramcopy.SF_Trigger[n].specialFunction);
+            break;
+        case 9: 
+            if (n > 0) return false;
+            // Bytes: total, data, bss, heap, free now, least free since boot, stack high-water mark
+            DebugSerial->print(F("$SI,MEM,")); DebugSerial->print(OP_Memory::totalRAM());
+            DebugSerial->print(F(",")); DebugSerial->print(OP_Memory::dataSize());
+            DebugSerial->print(F(",")); DebugSerial->print(OP_Memory::bssSize());
+            DebugSerial->print(F(",")); DebugSerial->print(OP_Memory::heapSize());
+            DebugSerial->print(F(",")); DebugSerial->print(OP_Memory::freeNow());
+            DebugSerial->print(F(",")); DebugSerial->print(OP_Memory::minFree());
+            DebugSerial->print(F(",")); DebugSerial->println(OP_Memory::stackHighWater());
+            break;
+        case 10: 
+            switch (n)
+            {
+                case 0: DebugSerial->print(F("$SI,LOG,")); DebugSerial->println(DebugLog.dropped()); break;
+                case 1: DebugSerial->println(F("$SI,END")); break;
+                default: return false;
+            }
+            break;
+        default: 
+            return false;
+    }
+    return true;
+}
+
+void PrintDashes()
+{   // The dashed line of PrintDebugLine(), without waiting for it to go out
+    for (uint8_t i=0; i<45; i++) { DebugSerial->print(F("-")); }
+    DebugSerial->println(); 
+}
+
+void PrintSectionBreak()
+{   // The blank line and dashed line that start each section of the dump. The title and another dashed line follow on the next two passes. 
     DebugSerial->println();
+    PrintDashes();
 }
-void DumpAuxChannelsInfo()
+
+boolean DumpVersion(uint8_t n)
 {
-    uint8_t chanCount = Radio.getChannelCount(); 
-    
-    DebugSerial->println(F("Aux Chan.   Min     Max     Type"));
-    PrintDebugLine();
-    for (int a=0; a<AUXCHANNELS; a++)
+    switch (n)
     {
-        DebugSerial->print(a+1);             
-        a < 9 ? PrintSpaces(11) : PrintSpaces(10);
-        if (Radio.AuxChannel[a].present)
-        {   
-             DebugSerial->print(Radio.AuxChannel[a].Settings->pulseMin); if (Radio.AuxChannel[a].Settings->pulseMin < 1000) { PrintSpace(); } PrintSpaces(4); DebugSerial->print(Radio.AuxChannel[a].Settings->pulseMax); PrintSpaces(4); if (Radio.AuxChannel[a].Settings->Digital) { DebugSerial->println(F("Digital")); } else {DebugSerial->println(F("Analog")); } 
-        }
-        else
-        {   // If a is less than total possible channel count, but it's flagged as not present, it's because the user has chosen not to use it.
-            // If a is greater than total possible channel count, the reason reasin it's flagged as not present is because the radio doesn't have that channel
-            if (a < chanCount) {    DebugSerial->println(F("IGNORED"));      }
-            else               {    DebugSerial->println(F("NOT DETECTED")); }
-        }
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->print(F("FIRMWARE VERSION: ")); DebugSerial->println(F(FIRMWARE_VERSION)); break;
+        default: return false;
     }
-    PrintDebugLine();
+    return true;
 }
 
-void DumpChannelsDetectedUtilized()
+boolean DumpStickInfo(uint8_t n)
 {
-    DebugSerial->print(F("Channels detected: ")); DebugSerial->println(Radio.getChannelCount());
-    DebugSerial->print(F("Channels utilized: ")); DebugSerial->println(Radio.ChannelsUtilized);
+    switch (n)
+    {
+        case 0:  PrintSectionBreak(); break;
+        case 1:  DebugSerial->print(F("RADIO INFO - ")); DebugSerial->println(RadioProtocol(Radio.getProtocol())); break;
+        case 2:  PrintDashes(); break;
+        case 3:  DebugSerial->print(F("Stick       Min    Center   Max    ")); break;   // The table is wider than the transmit buffer, 
+        case 4:  DebugSerial->println(F("Deadband  Jitter  Median  Reversed")); break;  // so every row takes two passes
+        case 5:  PrintDashes(); break;
+        case 6:  
+        case 7:  DumpStickRow(F("Throttle   "), Radio.Sticks.Throttle,  n & 1); break;
+        case 8:  
+        case 9:  DumpStickRow(F("Turn       "), Radio.Sticks.Turn,      n & 1); break;
+        case 10: 
+        case 11: DumpStickRow(F("Elevation  "), Radio.Sticks.Elevation, n & 1); break;
+        case 12: 
+        case 13: DumpStickRow(F("Azimuth    "), Radio.Sticks.Azimuth,   n & 1); break;
+        case 14: DebugSerial->println(); break;
+        default: return false;
+    }
+    return true;
 }
 
-void DumpMotorInfo()
+void DumpStickRow(const __FlashStringHelper *name, stick_channel &stick, boolean secondHalf)
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("MOTOR TYPES"));
-    PrintDebugLine();
-    DebugSerial->print(F("Drive Motors:      ")); DebugSerial->println(ptrDriveType(eeprom.ramcopy.DriveMotors)); 
-    DebugSerial->print(F("Turret Rotation:   ")); DebugSerial->print(ptrDriveType(eeprom.ramcopy.TurretRotationMotor)); 
-    switch (eeprom.ramcopy.TurretRotationMotor) {
-        case ONBOARD: DebugSerial->println(F(" (A)")); break;
-        case OP_SCOUT:   // Fall through
-        case SABERTOOTH: DebugSerial->println(F(" (M1)")); break;
-        case POLOLU: DebugSerial->println(F(" (M0)")); break;
-        default: DebugSerial->println(); }
-    DebugSerial->print(F("Barrel Elevation:  ")); DebugSerial->print(ptrDriveType(eeprom.ramcopy.TurretElevationMotor)); 
-    switch (eeprom.ramcopy.TurretElevationMotor) {
-        case ONBOARD: DebugSerial->println(F(" (B)")); break;
-        case OP_SCOUT:   // Fall through
-        case SABERTOOTH: DebugSerial->println(F(" (M2)")); break;
-        case POLOLU: DebugSerial->println(F(" (M1)")); break;
-        default: DebugSerial->println(); }
-    DebugSerial->print(F("Mechanical Barrel: ")); if (eeprom.ramcopy.Airsoft) DebugSerial->print(F("Airsoft")); else DebugSerial->print(F("Mechanical recoil")); 
-    DebugSerial->println();
+    if (!secondHalf)
+    {
+        DebugSerial->print(name); if (stick.Settings->pulseMin < 1000) { PrintSpace(); } DebugSerial->print(stick.Settings->pulseMin); PrintSpaces(4); DebugSerial->print(stick.Settings->pulseCenter); PrintSpaces(5); DebugSerial->print(stick.Settings->pulseMax); PrintSpaces(4); 
+    }
+    else
+    {
+        DebugSerial->print(stick.Settings->deadband); PrintSpaces(8); PrintJitterFilter(stick.Settings->jitterBand, stick.Settings->medianFilter); PrintLnTrueFalse(stick.Settings->reversed); 
+    }
+}
+
+boolean DumpAuxChannelsInfo(uint8_t n)
+{
+    if (n == 0)                     DebugSerial->println(F("Aux Chan.   Min     Max     Jitter  Median  Type"));
+    else if (n == 1)                PrintDashes();
+    else if (n < AUXCHANNELS + 2)   DumpAuxChannelInfo(n - 2);
+    else if (n == AUXCHANNELS + 2)  PrintDashes();
+    else return false;
+    return true;
+}
+
+void DumpAuxChannelInfo(uint8_t a)
+{
+    DebugSerial->print(a+1);             
+    a < 9 ? PrintSpaces(11) : PrintSpaces(10);
+    if (Radio.AuxChannel[a].present)
+    {   
+         DebugSerial->print(Radio.AuxChannel[a].Settings->pulseMin); if (Radio.AuxChannel[a].Settings->pulseMin < 1000) { PrintSpace(); } PrintSpaces(4); DebugSerial->print(Radio.AuxChannel[a].Settings->pulseMax); PrintSpaces(4); PrintJitterFilter(Radio.AuxChannel[a].Settings->jitterBand, Radio.AuxChannel[a].Settings->medianFilter); if (Radio.AuxChannel[a].Settings->Digital) { DebugSerial->println(F("Digital")); } else {DebugSerial->println(F("Analog")); } 
+    }
+    else
+    {   // If a is less than total possible channel count, but it's flagged as not present, it's because the user has chosen not to use it.
+        // If a is greater than total possible channel count, the reason reasin it's flagged as not present is because the radio doesn't have that channel
+        if (a < Radio.getChannelCount()) {  DebugSerial->println(F("IGNORED"));      }
+        else                             {  DebugSerial->println(F("NOT DETECTED")); }
+    }
+}
+
+void PrintJitterFilter(uint8_t jitterBand, boolean medianFilter)
+{   // The jitter filter columns of the stick and aux channel tables
+    DebugSerial->print(jitterBand); jitterBand < 10 ? PrintSpaces(7) : PrintSpaces(6);
+    PrintYesNo(medianFilter); medianFilter ? PrintSpaces(5) : PrintSpaces(6);
+}
+
+boolean DumpChannelsDetectedUtilized(uint8_t n)
+{
+    switch (n)
+    {
+        case 0: DebugSerial->print(F("Channels detected: ")); DebugSerial->println(Radio.getChannelCount()); break;
+        case 1: DebugSerial->print(F("Channels utilized: ")); DebugSerial->println(Radio.ChannelsUtilized); break;
+        case 2: DebugSerial->print(F("Detected in:       ")); DebugSerial->print(Radio.getDetectTime()); DebugSerial->print(F(" mS (worst case ")); DebugSerial->print(RADIO_DETECT_WORST_MS); DebugSerial->println(F(" mS)")); break;
+        default: return false;
+    }
+    return true;
+}
+
+boolean DumpMotorInfo(uint8_t n)
+{
+    switch (n)
+    {
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->println(F("MOTOR TYPES")); break;
+        case 2: PrintDashes(); break;
+        case 3: DebugSerial->print(F("Drive Motors:      ")); DebugSerial->println(ptrDriveType(EEPROM_VAR(DriveMotors))); break;
+        case 4: 
+            DebugSerial->print(F("Turret Rotation:   ")); DebugSerial->print(ptrDriveType(eeprom.ramcopy.TurretRotationMotor)); 
+            switch (eeprom.ramcopy.TurretRotationMotor) {
+                case ONBOARD: DebugSerial->println(F(" (A)")); break;
+                case OP_SCOUT:   // Fall through
+                case SABERTOOTH: DebugSerial->println(F(" (M1)")); break;
+                case POLOLU: DebugSerial->println(F(" (M0)")); break;
+                default: DebugSerial->println(); }
+            break;
+        case 5: 
+            DebugSerial->print(F("Barrel Elevation:  ")); DebugSerial->print(ptrDriveType(eeprom.ramcopy.TurretElevationMotor)); 
+            switch (eeprom.ramcopy.TurretElevationMotor) {
+                case ONBOARD: DebugSerial->println(F(" (B)")); break;
+                case OP_SCOUT:   // Fall through
+                case SABERTOOTH: DebugSerial->println(F(" (M2)")); break;
+                case POLOLU: DebugSerial->println(F(" (M1)")); break;
+                default: DebugSerial->println(); }
+            break;
+        case 6: 
+            DebugSerial->print(F("Mechanical Barrel: ")); if (eeprom.ramcopy.Airsoft) DebugSerial->print(F("Airsoft")); else DebugSerial->print(F("Mechanical recoil")); 
+            DebugSerial->println();
+            break;
+        case 7: DebugSerial->print(F("Object arena:      ")); DebugSerial->print(ObjectArena.used()); DebugSerial->print(F(" of ")); DebugSerial->print(ObjectArena.reserved()); DebugSerial->println(F(" bytes used")); break;
+        default: return false;
+    }
+    return true;
 }
 
-void DumpDriveSettings()
+boolean DumpDriveSettings(uint8_t n)
 {
 boolean Profile_1; 
 boolean AccelRampEnabled;
@@ -246,146 +460,200 @@ else                     Profile_1 = true;
 Profile_1 ? AccelRampEnabled = eeprom.ramcopy.AccelRampEnabled_1 : AccelRampEnabled = eeprom.ramcopy.AccelRampEnabled_2; 
 Profile_1 ? DecelRampEnabled = eeprom.ramcopy.DecelRampEnabled_1 : DecelRampEnabled = eeprom.ramcopy.DecelRampEnabled_2; 
     
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("DRIVE SETTINGS"));
-    PrintDebugLine();
-    DebugSerial->print(F("Vehicle Type:           ")); DebugSerial->println(printDriveType(eeprom.ramcopy.DriveType));
-    DebugSerial->print(F("Active Driving Profile: ")); DebugSerial->println(DrivingProfile);
-    DebugSerial->print(F("Accel Ramp Enabled:     ")); PrintYesNo(AccelRampEnabled); 
-    if (AccelRampEnabled) 
-    { 
-        DebugSerial->print(F(" (Level: ")); 
-        Profile_1 ? DebugSerial->print(eeprom.ramcopy.AccelSkipNum_1) : DebugSerial->print(eeprom.ramcopy.AccelSkipNum_2); 
-        if ((Profile_1 == true && eeprom.ramcopy.AccelSkipNum_1 != Driver.getAccelRampFrequency()) || (Profile_1 == false && eeprom.ramcopy.AccelSkipNum_2 != Driver.getAccelRampFrequency()))
-        {
-            DebugSerial->print(F(" (Adjusted to "));
-            DebugSerial->print(Driver.getAccelRampFrequency());
-            DebugSerial->print(F(")")); 
-        }
-        DebugSerial->print(F(", Preset: ")); 
-        if (Profile_1)
-        {
-            if (eeprom.ramcopy.AccelPreset_1 == 0) DebugSerial->print(F("None"));
-            else DebugSerial->print(eeprom.ramcopy.AccelPreset_1, DEC);
-        }
-        else
-        {
-            if (eeprom.ramcopy.AccelPreset_2 == 0) DebugSerial->print(F("None"));
-            else DebugSerial->print(eeprom.ramcopy.AccelPreset_2, DEC);
-        }
-        DebugSerial->print(F(")"));
+    switch (n)
+    {
+        case 0:  PrintSectionBreak(); break;
+        case 1:  DebugSerial->println(F("DRIVE SETTINGS")); break;
+        case 2:  PrintDashes(); break;
+        case 3:  DebugSerial->print(F("Vehicle Type:           ")); DebugSerial->println(printDriveType(eeprom.ramcopy.DriveType)); break;
+        case 4:  DebugSerial->print(F("Active Driving Profile: ")); DebugSerial->println(DrivingProfile); break;
+        case 5:  DebugSerial->print(F("Accel Ramp Enabled:     ")); 
+                 PrintRampLevel(AccelRampEnabled, Profile_1 ? eeprom.ramcopy.AccelSkipNum_1 : eeprom.ramcopy.AccelSkipNum_2, Driver.getAccelRampFrequency()); 
+                 break;
+        case 6:  PrintRampPreset(AccelRampEnabled, Profile_1 ? eeprom.ramcopy.AccelPreset_1 : eeprom.ramcopy.AccelPreset_2); break;
+        case 7:  DebugSerial->print(F("Decel Ramp Enabled:     ")); 
+                 PrintRampLevel(DecelRampEnabled, Profile_1 ? eeprom.ramcopy.DecelSkipNum_1 : eeprom.ramcopy.DecelSkipNum_2, Driver.getDecelRampFrequency()); 
+                 break;
+        case 8:  PrintRampPreset(DecelRampEnabled, Profile_1 ? eeprom.ramcopy.DecelPreset_1 : eeprom.ramcopy.DecelPreset_2); break;
+        case 9:  
+            DebugSerial->print(F("Motor Nudge Enabled:    ")); 
+            if (EEPROM_VAR(MotorNudgePct) == 0) PrintLnYesNo(false);
+            else
+            {   PrintYesNo(true);
+                DebugSerial->print(F(" (")); 
+                DebugSerial->print(EEPROM_VAR(MotorNudgePct)); 
+                DebugSerial->print(F("% throttle for ")); 
+                DebugSerial->print(eeprom.ramcopy.NudgeTime_mS);
+                DebugSerial->println(F(" ms)"));
+            }
+            break;
+        case 10: 
+            DebugSerial->print(F("Forward Speed Limited:  ")); 
+            if (eeprom.ramcopy.MaxForwardSpeedPct < 100) { DebugSerial->print(F("Yes - ")); DebugSerial->print(eeprom.ramcopy.MaxForwardSpeedPct); DebugSerial->println(F("%")); }
+            else PrintLnYesNo(false);
+            break;
+        case 11: 
+            DebugSerial->print(F("Reverse Speed Limited:  ")); 
+            if (eeprom.ramcopy.MaxReverseSpeedPct < 100) { DebugSerial->print(F("Yes - ")); DebugSerial->print(eeprom.ramcopy.MaxReverseSpeedPct); DebugSerial->println(F("%")); }
+            else PrintLnYesNo(false);
+            break;
+        case 12: DebugSerial->print(F("Shift time:             ")); DebugSerial->print(Convert_mS_to_Sec(eeprom.ramcopy.TimeToShift_mS),1); DebugSerial->println(F(" sec")); break;
+        case 13: DebugSerial->print(F("Engine pause time:      ")); DebugSerial->print(Convert_mS_to_Sec(EEPROM_VAR(EnginePauseTime_mS)),1); DebugSerial->println(F(" sec")); break;
+        case 14: DebugSerial->print(F("Transmission delay:     ")); DebugSerial->print(Convert_mS_to_Sec(eeprom.ramcopy.TransmissionDelay_mS),1); DebugSerial->println(F(" sec")); break;
+        case 15: 
+            DebugSerial->print(F("Neutral turn allowed:   "));  // Neutral turns only make sense with tanks
+            if (eeprom.ramcopy.DriveType == DT_TANK || eeprom.ramcopy.DriveType == DT_DKLM) 
+            {   
+                PrintYesNo(EEPROM_VAR(NeutralTurnAllowed));
+                if (EEPROM_VAR(NeutralTurnAllowed)) { DebugSerial->print(F(" - ")); DebugSerial->print(EEPROM_VAR(NeutralTurnPct)); DebugSerial->print(F("%")); }
+            }
+            else DebugSerial->print(F("N/A for vehicle type"));
+            DebugSerial->println();        
+            break;
+        case 16: 
+            DebugSerial->print(F("Turn mode:              "));  // Turn modes only apply to conventional tank drives (not clutch type) and halftracks
+            if (eeprom.ramcopy.DriveType == DT_TANK || eeprom.ramcopy.DriveType == DT_HALFTRACK) DebugSerial->println(Driver.getTurnMode());
+            else DebugSerial->println(F("N/A for vehicle type"));
+            break;
+        case 17: 
+            DebugSerial->print(F("Track speed loop:       "));  // Only if both IO ports are set to encoder inputs
+            if (TrackSpeed.isActive())
+            {
+                PrintYesNo(true);
+                DebugSerial->print(F(" (Kp ")); DebugSerial->print(TrackSpeed.getKp()); 
+                DebugSerial->print(F("/32, Ki ")); DebugSerial->print(TrackSpeed.getKi()); 
+            }
+            else PrintLnYesNo(false);
+            break;
+        // The rest only if the track speed loop is active
+        case 18: 
+            if (!TrackSpeed.isActive()) return false;
+            DebugSerial->print(F("/32, full speed ")); DebugSerial->print(TrackSpeed.fullSpeedCPS()); DebugSerial->println(F(" counts/sec)"));
+            break;
+        case 19: DebugSerial->print(F("Measured track speed:   Left ")); PrintTrackSpeed(TRACK_LEFT); break;
+        case 20: DebugSerial->print(F("  Right ")); PrintTrackSpeed(TRACK_RIGHT); DebugSerial->println(); break;
+        default: return false;
     }
-    DebugSerial->println();
-    DebugSerial->print(F("Decel Ramp Enabled:     ")); PrintYesNo(DecelRampEnabled); 
-    if (DecelRampEnabled) 
+    return true;
+}
+
+void PrintRampLevel(boolean enabled, uint8_t level, uint8_t adjustedLevel)
+{   // First half of the accel or decel ramp line
+    PrintYesNo(enabled); 
+    if (enabled) 
     { 
         DebugSerial->print(F(" (Level: ")); 
-        Profile_1 ? DebugSerial->print(eeprom.ramcopy.DecelSkipNum_1) : DebugSerial->print(eeprom.ramcopy.DecelSkipNum_2); 
-        if ((Profile_1 == true && eeprom.ramcopy.DecelSkipNum_1 != Driver.getDecelRampFrequency()) || (Profile_1 == false && eeprom.ramcopy.DecelSkipNum_2 != Driver.getDecelRampFrequency()))
+        DebugSerial->print(level); 
+        if (level != adjustedLevel)
         {
             DebugSerial->print(F(" (Adjusted to "));
-            DebugSerial->print(Driver.getDecelRampFrequency());
+            DebugSerial->print(adjustedLevel);
             DebugSerial->print(F(")")); 
         }
+    }
+}
+
+void PrintRampPreset(boolean enabled, uint8_t preset)
+{   // And the second half
+    if (enabled)
+    {
         DebugSerial->print(F(", Preset: ")); 
-        if (Profile_1)
-        {
-            if   (eeprom.ramcopy.DecelPreset_1 == 0) DebugSerial->print(F("None"));
-            else DebugSerial->print(eeprom.ramcopy.DecelPreset_1, DEC);
-        }
-        else
-        {
-            if   (eeprom.ramcopy.DecelPreset_2 == 0) DebugSerial->print(F("None"));
-            else DebugSerial->print(eeprom.ramcopy.DecelPreset_2, DEC);    
-        }
-        
+        if (preset == 0) DebugSerial->print(F("None"));
+        else DebugSerial->print(preset, DEC);
         DebugSerial->print(F(")"));
     }
     DebugSerial->println();
-    DebugSerial->print(F("Motor Nudge Enabled:    ")); 
-    if (eeprom.ramcopy.MotorNudgePct == 0) PrintLnYesNo(false);
-    else
-    {   PrintYesNo(true);
-        DebugSerial->print(F(" (")); 
-        DebugSerial->print(eeprom.ramcopy.MotorNudgePct); 
-        DebugSerial->print(F("% throttle for ")); 
-        DebugSerial->print(eeprom.ramcopy.NudgeTime_mS);
-        DebugSerial->println(F(" ms)"));
-    }
-    DebugSerial->print(F("Forward Speed Limited:  ")); 
-    if (eeprom.ramcopy.MaxForwardSpeedPct < 100) { DebugSerial->print(F("Yes - ")); DebugSerial->print(eeprom.ramcopy.MaxForwardSpeedPct); DebugSerial->println(F("%")); }
-    else PrintLnYesNo(false);
-    DebugSerial->print(F("Reverse Speed Limited:  ")); 
-    if (eeprom.ramcopy.MaxReverseSpeedPct < 100) { DebugSerial->print(F("Yes - ")); DebugSerial->print(eeprom.ramcopy.MaxReverseSpeedPct); DebugSerial->println(F("%")); }
-    else PrintLnYesNo(false);
-    DebugSerial->print(F("Shift time:             ")); DebugSerial->print(Convert_mS_to_Sec(eeprom.ramcopy.TimeToShift_mS),1); DebugSerial->println(F(" sec"));
-    DebugSerial->print(F("Engine pause time:      ")); DebugSerial->print(Convert_mS_to_Sec(eeprom.ramcopy.EnginePauseTime_mS),1); DebugSerial->println(F(" sec"));
-    DebugSerial->print(F("Transmission delay:     ")); DebugSerial->print(Convert_mS_to_Sec(eeprom.ramcopy.TransmissionDelay_mS),1); DebugSerial->println(F(" sec"));
-    DebugSerial->print(F("Neutral turn allowed:   "));  // Neutral turns only make sense with tanks
-    if (eeprom.ramcopy.DriveType == DT_TANK || eeprom.ramcopy.DriveType == DT_DKLM) 
-    {   
-        PrintYesNo(eeprom.ramcopy.NeutralTurnAllowed);
-        if (eeprom.ramcopy.NeutralTurnAllowed) { DebugSerial->print(F(" - ")); DebugSerial->print(eeprom.ramcopy.NeutralTurnPct); DebugSerial->print(F("%")); }
-    }
-    else DebugSerial->print(F("N/A for vehicle type"));
-    DebugSerial->println();        
-    DebugSerial->print(F("Turn mode:              "));  // Turn modes only apply to conventional tank drives (not clutch type) and halftracks
-    if (eeprom.ramcopy.DriveType == DT_TANK || eeprom.ramcopy.DriveType == DT_HALFTRACK) DebugSerial->println(Driver.getTurnMode());
-    else DebugSerial->println(F("N/A for vehicle type"));
 }
 
-void DumpTurretInfo()
+void PrintTrackSpeed(uint8_t track)
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("TURRET SETTINGS"));
-    PrintDebugLine();    
-    DebugSerial->print(F("Turret Rotation Speed Limited:  ")); 
-    if (eeprom.ramcopy.TurretRotation_MaxSpeedPct < 100) { DebugSerial->print(F("Yes - ")); DebugSerial->print(eeprom.ramcopy.TurretRotation_MaxSpeedPct); DebugSerial->println(F("%")); }
-    else PrintLnYesNo(false);
-    DebugSerial->print(F("Barrel Elevation Speed Limited: ")); 
-    if (eeprom.ramcopy.TurretElevation_MaxSpeedPct < 100) { DebugSerial->print(F("Yes - ")); DebugSerial->print(eeprom.ramcopy.TurretElevation_MaxSpeedPct); DebugSerial->println(F("%")); }
-    else PrintLnYesNo(false);
-    DebugSerial->print(F("Recoil delay:                   ")); 
-    if (eeprom.ramcopy.RecoilDelay > 0)
-    {
-        DebugSerial->println(Convert_mS_to_Sec(eeprom.ramcopy.RecoilDelay),2); DebugSerial->println(F(" sec"));
-    }
-    else { PrintLnYesNo(0); }    
-    
+    DebugSerial->print(TrackSpeed.measuredCPS(track)); 
+    DebugSerial->print(F(" counts/sec ("));
+    DebugSerial->print(((int32_t)TrackSpeed.measuredSpeed(track) * 100) / MOTOR_MAX_FWDSPEED);
+    DebugSerial->print(F("%)"));
 }
 
-void DumpSoundInfo()
+boolean DumpTurretInfo(uint8_t n)
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("SOUND CARD"));
-    PrintDebugLine();    
-    DebugSerial->print(F("Sound card: ")); 
-    DebugSerial->println(printSoundDevice(eeprom.ramcopy.SoundDevice));
+    switch (n)
+    {
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->println(F("TURRET SETTINGS")); break;
+        case 2: PrintDashes(); break;
+        case 3: 
+            DebugSerial->print(F("Turret Rotation Speed Limited:  ")); 
+            if (EEPROM_VAR(TurretRotation_MaxSpeedPct) < 100) { DebugSerial->print(F("Yes - ")); DebugSerial->print(EEPROM_VAR(TurretRotation_MaxSpeedPct)); DebugSerial->println(F("%")); }
+            else PrintLnYesNo(false);
+            break;
+        case 4: 
+            DebugSerial->print(F("Barrel Elevation Speed Limited: ")); 
+            if (EEPROM_VAR(TurretElevation_MaxSpeedPct) < 100) { DebugSerial->print(F("Yes - ")); DebugSerial->print(EEPROM_VAR(TurretElevation_MaxSpeedPct)); DebugSerial->println(F("%")); }
+            else PrintLnYesNo(false);
+            break;
+        case 5: 
+            DebugSerial->print(F("Recoil delay:                   ")); 
+            if (EEPROM_VAR(RecoilDelay) > 0)
+            {
+                DebugSerial->print(Convert_mS_to_Sec(EEPROM_VAR(RecoilDelay)),2); DebugSerial->println(F(" sec"));
+            }
+            else { PrintLnYesNo(0); }    
+            break;
+        default: return false;
+    }
+    return true;
 }
 
-void DumpIMUInfo()
+boolean DumpSoundInfo(uint8_t n)
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("INERTIAL MEASUREMENT UNIT"));
-    PrintDebugLine();
-    if (IMU_Present)
+    switch (n)
     {
-        DebugSerial->print(F("Sensor detected:              Yes")); DebugSerial->println();
-        DebugSerial->print(F("Barrel Stabilization Enabled: ")); PrintYesNo(eeprom.ramcopy.EnableBarrelStabilize);
-        if (eeprom.ramcopy.EnableBarrelStabilize) PrintBarrelSensitivity(); 
-        DebugSerial->println();
-        DebugSerial->print(F("Hill Physics Enabled:         ")); PrintYesNo(eeprom.ramcopy.EnableHillPhysics);
-        if (eeprom.ramcopy.EnableHillPhysics) PrintHillSensitivity();
-        DebugSerial->println();
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->println(F("SOUND CARD")); break;
+        case 2: PrintDashes(); break;
+        case 3: 
+            DebugSerial->print(F("Sound card: ")); 
+            DebugSerial->println(printSoundDevice(EEPROM_VAR(SoundDevice)));
+            break;
+        case 4: 
+            DebugSerial->print(F("Engine speed updates sent: ")); 
+            DebugSerial->print(TankSound->EngineSpeedUpdatesSent());
+            DebugSerial->print(F(", suppressed: ")); 
+            DebugSerial->println(TankSound->EngineSpeedUpdatesSuppressed());
+            break;
+        default: return false;
     }
-    else
+    return true;
+}
+
+boolean DumpIMUInfo(uint8_t n)
+{
+    switch (n)
     {
-        DebugSerial->println(F("Sensor not detected!")); 
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->println(F("INERTIAL MEASUREMENT UNIT")); break;
+        case 2: PrintDashes(); break;
+        case 3: 
+            if (IMU_Present) { DebugSerial->print(F("Sensor detected:              Yes")); DebugSerial->println(); }
+            else             { DebugSerial->println(F("Sensor not detected!")); }
+            break;
+        // The rest only if the sensor is present. The enabled lines are printed in two pieces, the sensitivity makes them too long for one pass. 
+        case 4: 
+            if (!IMU_Present) return false;
+            DebugSerial->print(F("Barrel Stabilization Enabled: ")); PrintYesNo(eeprom.ramcopy.EnableBarrelStabilize);
+            break;
+        case 5: 
+            if (eeprom.ramcopy.EnableBarrelStabilize) PrintBarrelSensitivity(); 
+            DebugSerial->println();
+            break;
+        case 6: DebugSerial->print(F("Hill Physics Enabled:         ")); PrintYesNo(eeprom.ramcopy.EnableHillPhysics); break;
+        case 7: 
+            if (eeprom.ramcopy.EnableHillPhysics) PrintHillSensitivity();
+            DebugSerial->println();
+            break;
+        case 8: DebugSerial->print(F("I2C errors / bus resets:      ")); DebugSerial->print(OP_I2C::errorCount()); DebugSerial->print(F(" / ")); DebugSerial->println(OP_I2C::recoveryCount()); break;
+        default: return false;
     }
+    return true;
 }
 
 void PrintBarrelSensitivity()
@@ -412,82 +680,139 @@ void PrintHillSensitivity()
     DebugSerial->print(F(")"));        
 }
 
-void DumpBattleInfo()
+boolean DumpBattleInfo(uint8_t n)
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("BATTLE INFO"));
-    PrintDebugLine();
-    if (Tank.BattleSettings.IR_FireProtocol != IR_UNKNOWN)
+    switch (n)
     {
-    DebugSerial->print(F("Is Repair Tank?   ")); PrintLnYesNo(Tank.isRepairTank());
-    if (Tank.isRepairTank()) { DebugSerial->print(F("Fire Protocol:    ")); DebugSerial->println(ptrIRName(Tank.BattleSettings.IR_RepairProtocol)); }
-    else
-    {
-        DebugSerial->print(F("Fire Protocol:    ")); DebugSerial->print(ptrIRName(Tank.BattleSettings.IR_FireProtocol));
-        if (Tank.BattleSettings.IR_Team != IR_TEAM_NONE) { DebugSerial->print(F(" (Team ")); DebugSerial->print(ptrIRTeam(Tank.BattleSettings.IR_Team)); DebugSerial->print(F(")")); } DebugSerial->println();
-    }
-    DebugSerial->print(F("Hit Protocol 2:   ")); 
-    if (Tank.BattleSettings.IR_HitProtocol_2 != IR_UNKNOWN ) { DebugSerial->println(ptrIRName(Tank.BattleSettings.IR_HitProtocol_2)); } else { DebugSerial->println(F("N/A")); }
-    DebugSerial->print(F("Repaired by:      ")); 
-    if (Tank.BattleSettings.IR_RepairProtocol != IR_UNKNOWN) { DebugSerial->println(ptrIRName(Tank.BattleSettings.IR_RepairProtocol)); } else { DebugSerial->println(F("N/A")); }
-    DebugSerial->print(F("Send MG IR Code:  ")); 
-    if (Tank.BattleSettings.Use_MG_Protocol) { DebugSerial->print(F("Yes (")); DebugSerial->print(ptrIRName(Tank.BattleSettings.IR_MGProtocol)); DebugSerial->println(")"); }
-    else PrintLnYesNo(false);
-    DebugSerial->print(F("Accept MG Damage: ")); 
-    if (Tank.BattleSettings.Accept_MG_Damage) { DebugSerial->print(F("Yes (")); DebugSerial->print(ptrIRName(Tank.BattleSettings.IR_MGProtocol)); DebugSerial->println(")"); }
-    else PrintLnYesNo(false);
-    
-    DebugSerial->print(F("Damage Profile:   ")); DebugSerial->println(ptrDamageProfile(Tank.BattleSettings.DamageProfile));
-    DebugSerial->print(F("Weight Class:     ")); DebugSerial->println(ptrWeightClassName(Tank.BattleSettings.WeightClass)); 
-    DebugSerial->print(F("(")); DebugSerial->print(Tank.BattleSettings.ClassSettings.maxHits); DebugSerial->print(F(" cannon hits, ")); if (Tank.BattleSettings.WeightClass == WC_CUSTOM) { DebugSerial->print(Tank.BattleSettings.ClassSettings.maxMGHits); DebugSerial->print(F(" MG hits, ")); } DebugSerial->print(Convert_mS_to_Sec(Tank.BattleSettings.ClassSettings.reloadTime),1); DebugSerial->print(F(" sec reload, ")); DebugSerial->print(Convert_mS_to_Sec(Tank.BattleSettings.ClassSettings.recoveryTime),1); DebugSerial->println(F(" sec recovery)"));    
-    }
-    else
-    {
-    DebugSerial->println(F("IR & Tank Battling Disabled"));
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->println(F("BATTLE INFO")); break;
+        case 2: PrintDashes(); break;
+        case 3: 
+            if (Tank.BattleSettings.IR_FireProtocol == IR_UNKNOWN) { DebugSerial->println(F("IR & Tank Battling Disabled")); }
+            else { DebugSerial->print(F("Is Repair Tank?   ")); PrintLnYesNo(Tank.isRepairTank()); }
+            break;
+        // The rest only if battling is enabled
+        case 4: 
+            if (Tank.BattleSettings.IR_FireProtocol == IR_UNKNOWN) return false;
+            if (Tank.isRepairTank()) { DebugSerial->print(F("Fire Protocol:    ")); DebugSerial->println(ptrIRName(Tank.BattleSettings.IR_RepairProtocol)); }
+            else
+            {
+                DebugSerial->print(F("Fire Protocol:    ")); DebugSerial->print(ptrIRName(Tank.BattleSettings.IR_FireProtocol));
+                if (Tank.BattleSettings.IR_Team != IR_TEAM_NONE) { DebugSerial->print(F(" (Team ")); DebugSerial->print(ptrIRTeam(Tank.BattleSettings.IR_Team)); DebugSerial->print(F(")")); } DebugSerial->println();
+            }
+            break;
+        case 5: 
+            DebugSerial->print(F("Hit Protocol 2:   ")); 
+            if (Tank.BattleSettings.IR_HitProtocol_2 != IR_UNKNOWN ) { DebugSerial->println(ptrIRName(Tank.BattleSettings.IR_HitProtocol_2)); } else { DebugSerial->println(F("N/A")); }
+            break;
+        case 6: 
+            DebugSerial->print(F("Repaired by:      ")); 
+            if (Tank.BattleSettings.IR_RepairProtocol != IR_UNKNOWN) { DebugSerial->println(ptrIRName(Tank.BattleSettings.IR_RepairProtocol)); } else { DebugSerial->println(F("N/A")); }
+            break;
+        case 7: 
+            DebugSerial->print(F("Send MG IR Code:  ")); 
+            if (Tank.BattleSettings.Use_MG_Protocol) { DebugSerial->print(F("Yes (")); DebugSerial->print(ptrIRName(Tank.BattleSettings.IR_MGProtocol)); DebugSerial->println(")"); }
+            else PrintLnYesNo(false);
+            break;
+        case 8: 
+            DebugSerial->print(F("Accept MG Damage: ")); 
+            if (Tank.BattleSettings.Accept_MG_Damage) { DebugSerial->print(F("Yes (")); DebugSerial->print(ptrIRName(Tank.BattleSettings.IR_MGProtocol)); DebugSerial->println(")"); }
+            else PrintLnYesNo(false);
+            break;
+        case 9:  DebugSerial->print(F("Damage Profile:   ")); DebugSerial->println(ptrDamageProfile(Tank.BattleSettings.DamageProfile)); break;
+        case 10: DebugSerial->print(F("Weight Class:     ")); DebugSerial->println(ptrWeightClassName(Tank.BattleSettings.WeightClass)); break;
+        case 11: // The weight class details are too long for one pass
+            DebugSerial->print(F("(")); DebugSerial->print(Tank.BattleSettings.ClassSettings.maxHits); DebugSerial->print(F(" cannon hits, ")); if (Tank.BattleSettings.WeightClass == WC_CUSTOM) { DebugSerial->print(Tank.BattleSettings.ClassSettings.maxMGHits); DebugSerial->print(F(" MG hits, ")); } 
+            break;
+        case 12: 
+            DebugSerial->print(Convert_mS_to_Sec(Tank.BattleSettings.ClassSettings.reloadTime),1); DebugSerial->print(F(" sec reload, ")); DebugSerial->print(Convert_mS_to_Sec(Tank.BattleSettings.ClassSettings.recoveryTime),1); DebugSerial->println(F(" sec recovery)"));    
+            break;
+        default: return false;
     }
+    return true;
 }
 
 
-void DumpBaudRates()
+boolean DumpBaudRates(uint8_t n)
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("BAUD RATES"));
-    PrintDebugLine();
-    DebugSerial->print(F("USB Serial Baud:   ")); DebugSerial->println(eeprom.ramcopy.USBSerialBaud);
-    DebugSerial->print(F("Motor Serial Baud: ")); DebugSerial->println(eeprom.ramcopy.MotorSerialBaud);
-    DebugSerial->print(F("Aux Serial Baud:   ")); DebugSerial->println(eeprom.ramcopy.AuxSerialBaud);
-    DebugSerial->print(F("Serial 3 Tx Baud:  ")); DebugSerial->println(eeprom.ramcopy.Serial3TxBaud);
+    switch (n)
+    {
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->println(F("BAUD RATES")); break;
+        case 2: PrintDashes(); break;
+        case 3: DebugSerial->print(F("USB Serial Baud:   ")); DebugSerial->println(EEPROM_VAR(USBSerialBaud)); break;
+        case 4: DebugSerial->print(F("Motor Serial Baud: ")); DebugSerial->println(eeprom.ramcopy.MotorSerialBaud); break;
+        case 5: DebugSerial->print(F("Aux Serial Baud:   ")); DebugSerial->println(EEPROM_VAR(AuxSerialBaud)); break;
+        case 6: DebugSerial->print(F("Serial 3 Tx Baud:  ")); DebugSerial->println(EEPROM_VAR(Serial3TxBaud)); break;
+        default: return false;
+    }
+    return true;
 }
 
-void DumpVoltage()
+boolean DumpMemoryInfo(uint8_t n)
 {
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("BATTERY"));
-    PrintDebugLine();
-    DebugSerial->print(F("Battery Detected: "));
-    if (IsBatteryUnplugged())
+    switch (n)
     {
-        DebugSerial->println(F("No"));
+        case 0:  PrintSectionBreak(); break;
+        case 1:  DebugSerial->println(F("MEMORY (bytes)")); break;
+        case 2:  PrintDashes(); break;
+        case 3:  DebugSerial->print(F("SRAM:              ")); DebugSerial->println(OP_Memory::totalRAM()); break;
+        case 4:  DebugSerial->print(F("Globals:           ")); DebugSerial->print(OP_Memory::dataSize() + OP_Memory::bssSize()); 
+                 DebugSerial->print(F(" (data ")); DebugSerial->print(OP_Memory::dataSize()); DebugSerial->print(F(", bss ")); DebugSerial->print(OP_Memory::bssSize()); DebugSerial->println(F(")"));
+                 break;
+        case 5:  DebugSerial->print(F("Heap:              ")); DebugSerial->println(OP_Memory::heapSize()); break;
+        case 6:  DebugSerial->print(F("Stack now:         ")); DebugSerial->println(OP_Memory::stackSize()); break;
+        case 7:  DebugSerial->print(F("Stack high-water:  ")); DebugSerial->println(OP_Memory::stackHighWater()); break;
+        case 8:  DebugSerial->print(F("Free now:          ")); DebugSerial->println(OP_Memory::freeNow()); break;
+        case 9:  DebugSerial->print(F("Least free ever:   ")); DebugSerial->println(OP_Memory::minFree()); break;
+        // Some of the larger static users. These are only the parts we can measure from here, the full list can be had from avr-nm (see OP_Memory.h)
+        case 10: DebugSerial->print(F("  EEPROM ramcopy:  ")); DebugSerial->println(sizeof(_eeprom_hot)); break;
+        case 11: DebugSerial->print(F("  Timers:          ")); DebugSerial->println(sizeof(OP_SimpleTimer)); break;
+        case 12: DebugSerial->print(F("  Radio channels:  ")); DebugSerial->println(sizeof(OP_Radio::AuxChannel)); break;
+        case 13: DebugSerial->print(F("  IR buffers:      ")); DebugSerial->println(sizeof(IR_ReceiveParams) + sizeof(IR_SendParams)); break;
+        case 14: DebugSerial->print(F("  Serial buffers:  ")); DebugSerial->println(4 * (SERIAL_RX_BUFFER_SIZE + SERIAL_TX_BUFFER_SIZE)); break;
+        case 15: DebugSerial->print(F("  Object arena:    ")); DebugSerial->println(ObjectArena.reserved()); break;
+        case 16: DebugSerial->print(F("  Debug log:       ")); DebugSerial->println(LOG_BUFFER_SIZE * sizeof(log_record) + LOG_LINE_CHARS); break;
+        default: return false;
     }
-    else
-    {
-        DebugSerial->println(F("Yes"));
-        DebugSerial->print(F("Voltage:          "));
-        DebugSerial->print(ReadVoltage(),2);
-        DebugSerial->println(F("v"));
-    }
-    DebugSerial->print(F("LVC Enabled:      "));
-    PrintYesNo(eeprom.ramcopy.LVC_Enabled);
-    if (eeprom.ramcopy.LVC_Enabled)
+    return true;
+}
+
+boolean DumpVoltage(uint8_t n)
+{
+    switch (n)
     {
-        DebugSerial->print(F(" ("));
-        DumpLVC_Voltage();
-        DebugSerial->println(F("v cutoff)"));
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->println(F("BATTERY")); break;
+        case 2: PrintDashes(); break;
+        case 3: 
+            DebugSerial->print(F("Battery Detected: "));
+            if (IsBatteryUnplugged())
+            {
+                DebugSerial->println(F("No"));
+            }
+            else
+            {
+                DebugSerial->println(F("Yes"));
+                DebugSerial->print(F("Voltage:          "));
+                DebugSerial->print(ReadVoltage(),2);
+                DebugSerial->println(F("v"));
+            }
+            break;
+        case 4: 
+            DebugSerial->print(F("LVC Enabled:      "));
+            PrintYesNo(EEPROM_VAR(LVC_Enabled));
+            if (EEPROM_VAR(LVC_Enabled))
+            {
+                DebugSerial->print(F(" ("));
+                DumpLVC_Voltage();
+                DebugSerial->println(F("v cutoff)"));
+            }
+            else DebugSerial->println();
+            break;
+        default: return false;
     }
-    else DebugSerial->println();
+    return true;
 }
 
 void DumpLVC_Voltage()
@@ -496,48 +821,72 @@ void DumpLVC_Voltage()
     DebugSerial->print(cutoff, 1);  // Print with one decimal precision
 }
 
-void DumpFunctionTriggers()
+boolean DumpFunctionTriggersHeader(uint8_t n)
+{
+    switch (n)
+    {
+        case 0: PrintSectionBreak(); break;
+        case 1: DebugSerial->println(F("FUNCTION TRIGGERS")); break;
+        case 2: PrintDashes(); break;
+        case 3: 
+            // Let the user know if there are any functions assigned to turret stick triggers
+            DebugSerial->print(F("Turret stick functions: ")); if (Radio.UsingSpecialPositions) { DebugSerial->println(F("Yes")); } else { DebugSerial->println(F("None")); }
+            break;
+        case 4: 
+            if (Radio.UsingSpecialPositions)
+            {
+                DebugSerial->print(F("Turret movement delay:  ")); DebugSerial->print(Convert_mS_to_Sec(eeprom.ramcopy.IgnoreTurretDelay_mS),2); DebugSerial->println(F(" sec"));    
+            } 
+            else if (MAX_FUNCTION_TRIGGERS == 0) DebugSerial->println(F("No function triggers defined"));
+            else return false;
+            break;
+        case 5: 
+            if (Radio.UsingSpecialPositions && MAX_FUNCTION_TRIGGERS == 0) DebugSerial->println(F("No function triggers defined"));
+            else return false;
+            break;
+        default: return false;
+    }
+    return true;
+}
+
+// A valid function-trigger will have a function number and a TriggerID > 0
+boolean FunctionTriggerValid(uint8_t i)
+{
+    return (eeprom.ramcopy.SF_Trigger[i].specialFunction != SF_NULL_FUNCTION && eeprom.ramcopy.SF_Trigger[i].TriggerID > 0);
+}
+
+// Two passes for each function-trigger, the trigger and then the name of the function, which together are too long for one. 
+boolean DumpFunctionTriggers(uint8_t &n)
+{
+    // Skip over empty trigger slots so we don't waste a pass on each one. n is the dump's cursor, so moving it along here means the next pass carries on from there. 
+    while ((n >> 1) < MAX_FUNCTION_TRIGGERS && !FunctionTriggerValid(n >> 1)) n += 2;
+    if ((n >> 1) >= MAX_FUNCTION_TRIGGERS) return false;
+    DumpFunctionTrigger(n >> 1, n & 1);
+    return true;
+}
+
+// Print the first or second half of function-trigger i
+void DumpFunctionTrigger(uint8_t i, boolean secondHalf)
 {
     char buffer[50];
     uint32_t fnameTableAddress = pgm_get_far_address(_FunctionNames_);  // This is the starting address of our function name table in far progmem. 
-    
-    DebugSerial->println();
-    PrintDebugLine();
-    DebugSerial->println(F("FUNCTION TRIGGERS"));
-    PrintDebugLine();
 
-    // Let the user know if there are any functions assigned to turret stick triggers
-    DebugSerial->print(F("Turret stick functions: ")); if (Radio.UsingSpecialPositions) { DebugSerial->println(F("Yes")); } else { DebugSerial->println(F("None")); }
-    if (Radio.UsingSpecialPositions)
+    if (!secondHalf)
     {
-        DebugSerial->print(F("Turret movement delay:  ")); DebugSerial->print(Convert_mS_to_Sec(eeprom.ramcopy.IgnoreTurretDelay_mS),2); DebugSerial->println(F(" sec"));    
-    } 
-
-    // Now list all functions and their triggers
-    if (MAX_FUNCTION_TRIGGERS > 0)
-    {
-        for (uint8_t i = 0; i <MAX_FUNCTION_TRIGGERS; i++)
-        {   // A valid function-trigger will have a function number and a TriggerID > 0
-            if (eeprom.ramcopy.SF_Trigger[i].specialFunction != SF_NULL_FUNCTION && eeprom.ramcopy.SF_Trigger[i].TriggerID > 0)
-            {   
-                PrintTriggerDescription(eeprom.ramcopy.SF_Trigger[i].specialFunction, eeprom.ramcopy.SF_Trigger[i].TriggerID);
-                DebugSerial->print(F(" -> "));
-                DebugSerial->print(F("Function #"));
-                DebugSerial->print(eeprom.ramcopy.SF_Trigger[i].specialFunction);
-                if (eeprom.ramcopy.SF_Trigger[i].specialFunction < 10) PrintSpace();
-                PrintSpaceDash();
-                // This worked back in those innocent days when we didn't have progmem in far memory. 
-                //strcpy_P(buffer, (char*)pgm_read_byte_far(&(function_name_table[eeprom.ramcopy.SF_Trigger[i].specialFunction])));
-                // This line cost me a week of my life. The custom strcpy_PFAR is in OP_Settings.h. The function names are set in OP_FunctionsTriggers.h 
-                strcpy_PFAR(buffer, fnameTableAddress, eeprom.ramcopy.SF_Trigger[i].specialFunction*FUNCNAME_CHARS);
-                DebugSerial->println(buffer);
-                DebugSerial->flush();  
-            }
-        }
+        PrintTriggerDescription(eeprom.ramcopy.SF_Trigger[i].specialFunction, eeprom.ramcopy.SF_Trigger[i].TriggerID);
+        DebugSerial->print(F(" -> "));
+        DebugSerial->print(F("Function #"));
+        DebugSerial->print(eeprom.ramcopy.SF_Trigger[i].specialFunction);
+        if (eeprom.ramcopy.SF_Trigger[i].specialFunction < 10) PrintSpace();
+        PrintSpaceDash();
     }
     else
     {
-        DebugSerial->println(F("No function triggers defined"));
+        // This worked back in those innocent days when we didn't have progmem in far memory. 
+        //strcpy_P(buffer, (char*)pgm_read_byte_far(&(function_name_table[eeprom.ramcopy.SF_Trigger[i].specialFunction])));
+        // This line cost me a week of my life. The custom strcpy_PFAR is in OP_Settings.h. The function names are set in OP_FunctionsTriggers.h 
+        strcpy_PFAR(buffer, fnameTableAddress, eeprom.ramcopy.SF_Trigger[i].specialFunction*FUNCNAME_CHARS);
+        DebugSerial->println(buffer);
     }
 }
 
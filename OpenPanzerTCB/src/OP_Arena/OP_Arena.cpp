@@ -0,0 +1,43 @@
+/* OP_Arena.cpp     Open Panzer Arena - static storage for objects that are created once at startup
+ * Source:          openpanzer.org              
+ * Authors:         Luke Middleton
+ *   
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */ 
+
+#include "OP_Arena.h"
+
+
+void * OP_Arena::allocate(size_t size)
+{
+    size = ARENA_ROUNDUP(size);
+    
+    if (size > (size_t)(_size - _used))
+    {   // Out of room. The arena was sized for the worst case, so this means the sizing in the sketch is out of date. 
+        // We can't return nothing (the constructor would run on address 0) and we don't want to quietly use the heap, so let the sketch 
+        // tell the user if it can, and stop here. The handler isn't expected to return, but if it does we still go no further. 
+        if (_fullHandler) _fullHandler(size);
+        while (true) { }
+    }
+    
+    void * p = _buffer + _used;
+    _used += size;
+    return p;
+}
+
+void * operator new(size_t size, OP_Arena &arena)
+{
+    return arena.allocate(size);
+}
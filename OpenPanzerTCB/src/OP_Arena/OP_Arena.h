@@ -0,0 +1,78 @@
+/* OP_Arena.h       Open Panzer Arena - static storage for objects that are created once at startup
+ * Source:          openpanzer.org              
+ * Authors:         Luke Middleton
+ *   
+ * The sketch doesn't know which motor and sound classes it needs until it has read the user's settings from EEPROM, so those objects used to be 
+ * created with new. They are never deleted, so the heap buys us nothing except its own bookkeeping (two bytes per block) and a RAM footprint we 
+ * can't see until runtime. 
+ * 
+ * Instead the sketch reserves a fixed array, sized at compile time for the worst case (the largest class that could fill each role), and the 
+ * objects are constructed inside it with "new (arena) Class(...)". Because the array is a regular global it shows up in the RAM figure the 
+ * compiler reports at the end of every build. used() and reserved() tell us at runtime how much of it the current settings actually needed. 
+ * 
+ * If the arena ever does run out (someone adds a role to the sketch without adding it to the size) there is no good way to carry on: placement new 
+ * can't return nothing, and a heap fallback would hand out memory that release() can never take back. So allocate() calls the sketch's full 
+ * handler, if it has set one, to tell the user, and then halts. The sketch also checks its sizing at compile time with ARENA_FITS, so this should 
+ * only ever be seen by someone who has changed the object setup code without updating the arena. 
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */ 
+
+#ifndef OP_ARENA_H
+#define OP_ARENA_H
+
+#include <Arduino.h>
+
+
+// Every allocation is rounded up to this, so each object starts on a boundary the compiler is happy with. On the AVR this is 1 (no padding at all). 
+#define ARENA_ALIGN                 __BIGGEST_ALIGNMENT__
+#define ARENA_ROUNDUP(size)         ((((size) + ARENA_ALIGN - 1) / ARENA_ALIGN) * ARENA_ALIGN)
+
+// Helpers for sizing an arena at compile time. ARENA_MAX gives the larger of two sizes, ARENA_SLOT the space one object of a class will take. 
+#define ARENA_MAX(a, b)             ((a) > (b) ? (a) : (b))
+#define ARENA_SLOT(cls)             ARENA_ROUNDUP(sizeof(cls))
+
+// Compile-time check that a class fits the slot reserved for its role. The build stops with the class name if it doesn't. 
+#define ARENA_FITS(cls, slot)       static_assert(ARENA_SLOT(cls) <= (slot), #cls " is larger than its slot in the object arena")
+
+// The sketch can give us a function to call if an object doesn't fit, it is passed the number of bytes that were asked for
+typedef void (*arena_full_callback)(uint16_t);
+
+
+class OP_Arena
+{
+public:
+    OP_Arena(uint8_t *buffer, uint16_t size) : _buffer(buffer), _size(size), _used(0), _fullHandler(NULL) {}
+    
+    void *   allocate(size_t size);                     // Returns space for an object of this many bytes. If the arena is full it calls the full handler and halts, it never returns.
+    void     setFullHandler(arena_full_callback f)  { _fullHandler = f; }
+    uint16_t mark(void)             { return _used; }   // Objects created after a mark can be discarded all at once by passing the mark to release()
+    void     release(uint16_t m)    { if (m < _used) _used = m; }
+
+    uint16_t used(void)             { return _used; }
+    uint16_t reserved(void)         { return _size; }
+    
+private:
+    uint8_t * const _buffer;
+    const uint16_t  _size;
+    uint16_t        _used;
+    arena_full_callback _fullHandler;
+};
+
+// This lets us write "new (arena) Class(...)" to construct an object in an arena
+void * operator new(size_t size, OP_Arena &arena);
+
+
+#endif
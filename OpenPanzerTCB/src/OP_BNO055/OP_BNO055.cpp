@@ -0,0 +1,137 @@
+/* OP_BNO055.cpp    Open Panzer BNO055 - reads orientation from a Bosch BNO055 9-DOF IMU without ever blocking the main loop
+ * Source:          openpanzer.org
+ * Authors:         Luke Middleton
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "OP_BNO055.h"
+
+
+// Static variables must be declared outside the class
+bno055_vector       OP_BNO055::orientation;
+bno055_vector       OP_BNO055::gyro;
+bno055_calibration  OP_BNO055::calibration;
+boolean             OP_BNO055::Present = false;
+boolean             OP_BNO055::Pending = false;
+boolean             OP_BNO055::Successful = false;
+int8_t              OP_BNO055::DataHandle = I2C_NO_HANDLE;
+int8_t              OP_BNO055::CalibHandle = I2C_NO_HANDLE;
+uint8_t             OP_BNO055::DataBuf[BNO055_SAMPLE_BYTES];
+uint8_t             OP_BNO055::CalibBuf;
+
+
+void OP_BNO055::begin(void)
+{
+    OP_I2C::begin();
+    Present = Pending = Successful = false;
+}
+
+boolean OP_BNO055::checkIfPresent(boolean waitForStartup)
+{
+    uint8_t id = 0;
+
+    // If we've only just been powered up the sensor may not be answering yet, so if asked keep trying until it has had time to start
+    do
+    {
+        Present = (readRegister(BNO055_CHIP_ID_ADDR, id) && id == BNO055_ID);
+        if (!Present && waitForStartup) delay(10);
+    } while (!Present && waitForStartup && millis() < BNO055_STARTUP_mS);
+
+    return Present;
+}
+
+boolean OP_BNO055::setup(boolean useExtCrystal, opmode_t mode)
+{
+    boolean ok;
+
+    if (!Present) return false;
+
+    // Settings can only be changed in config mode
+    ok = writeRegister(BNO055_OPR_MODE_ADDR, OPERATION_MODE_CONFIG);
+    delay(BNO055_MODE_SWITCH_mS);
+    ok &= writeRegister(BNO055_PWR_MODE_ADDR, BNO055_POWER_MODE_NORMAL);
+    ok &= writeRegister(BNO055_PAGE_ID_ADDR, 0);
+    ok &= writeRegister(BNO055_SYS_TRIGGER_ADDR, useExtCrystal ? BNO055_SYS_TRIGGER_EXT_CLK : 0);   // The Adafruit board has a 32 kHz crystal
+    delay(10);
+
+    // The default units are what we want: degrees, and degrees per second
+    ok &= writeRegister(BNO055_OPR_MODE_ADDR, mode);
+    delay(BNO055_MODE_SWITCH_mS);
+
+    return ok;
+}
+
+boolean OP_BNO055::requestSample(void)
+{
+    if (!Present || Pending) return false;
+
+    DataHandle = OP_I2C::read(BNO055_ADDRESS, BNO055_GYRO_DATA_ADDR, DataBuf, BNO055_SAMPLE_BYTES);
+    CalibHandle = OP_I2C::read(BNO055_ADDRESS, BNO055_CALIB_STAT_ADDR, &CalibBuf, 1);
+    if (DataHandle == I2C_NO_HANDLE || CalibHandle == I2C_NO_HANDLE)
+    {   // Queue full, which means something else is using the bus. Give back whichever one we did get (once it's done) and try again next time.
+        Pending = (DataHandle != I2C_NO_HANDLE || CalibHandle != I2C_NO_HANDLE);
+        Successful = false;
+        return false;
+    }
+
+    Pending = true;
+    return true;
+}
+
+boolean OP_BNO055::process(void)
+{
+    OP_I2C::update();           // Catches a hung bus
+
+    if (!Pending) return false;
+    if ((DataHandle != I2C_NO_HANDLE && !OP_I2C::done(DataHandle)) || (CalibHandle != I2C_NO_HANDLE && !OP_I2C::done(CalibHandle))) return false;
+
+    Successful = OP_I2C::successful(DataHandle) && OP_I2C::successful(CalibHandle);
+    if (Successful)
+    {
+        gyro.x =        (int16_t)(((uint16_t)DataBuf[1]  << 8) | DataBuf[0]);
+        gyro.y =        (int16_t)(((uint16_t)DataBuf[3]  << 8) | DataBuf[2]);
+        gyro.z =        (int16_t)(((uint16_t)DataBuf[5]  << 8) | DataBuf[4]);
+        orientation.x = (int16_t)(((uint16_t)DataBuf[7]  << 8) | DataBuf[6]);
+        orientation.y = (int16_t)(((uint16_t)DataBuf[9]  << 8) | DataBuf[8]);
+        orientation.z = (int16_t)(((uint16_t)DataBuf[11] << 8) | DataBuf[10]);
+        calibration.system = (CalibBuf >> 6) & 0x03;
+        calibration.gyro =   (CalibBuf >> 4) & 0x03;
+        calibration.accel =  (CalibBuf >> 2) & 0x03;
+        calibration.mag =     CalibBuf       & 0x03;
+    }
+
+    OP_I2C::release(DataHandle);
+    OP_I2C::release(CalibHandle);
+    DataHandle = CalibHandle = I2C_NO_HANDLE;
+    Pending = false;
+    return true;
+}
+
+boolean OP_BNO055::writeRegister(uint8_t reg, uint8_t value)
+{
+    int8_t handle = OP_I2C::write(BNO055_ADDRESS, reg, value);
+    boolean ok = (OP_I2C::wait(handle) == I2C_DONE);
+    OP_I2C::release(handle);
+    return ok;
+}
+
+boolean OP_BNO055::readRegister(uint8_t reg, uint8_t &value)
+{
+    int8_t handle = OP_I2C::read(BNO055_ADDRESS, reg, &value, 1);
+    boolean ok = (OP_I2C::wait(handle) == I2C_DONE);
+    OP_I2C::release(handle);
+    return ok;
+}
@@ -0,0 +1,130 @@
+/* OP_BNO055.h      Open Panzer BNO055 - reads orientation from a Bosch BNO055 9-DOF IMU without ever blocking the main loop
+ * Source:          openpanzer.org
+ * Authors:         Luke Middleton
+ *
+ * The BNO055 fuses its own accelerometer, gyro and magnetometer readings and gives us Euler angles directly. We use it on the Adafruit breakout board
+ * (https://www.adafruit.com/products/2472), connected to the I2C port.
+ *
+ * checkIfPresent() and setup() are only for use in setup(): they wait for each transaction to finish, and setup() also has to wait for the sensor to
+ * change modes. After that, requestSample() queues a read of the gyro and Euler angle registers (which are next to each other, so that is one 12 byte
+ * read) and the calibration status, and returns straight away. OP_I2C does the rest in the background. process() should be called every time through
+ * the main loop, it returns true once the sample has come back. At 400 kHz the whole thing takes about 400 uS of bus time, during which the main loop
+ * carries on as usual.
+ *
+ * The readings are left as the integers the sensor sends, in 1/16ths of a degree (Euler) and 1/16ths of a degree per second (gyro).
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OP_BNO055_H
+#define OP_BNO055_H
+
+#include <Arduino.h>
+#include "../OP_I2C/OP_I2C.h"
+
+
+#define BNO055_ADDRESS_A            0x28        // ADR pin low, the Adafruit default
+#define BNO055_ADDRESS_B            0x29        // ADR pin high
+#define BNO055_ADDRESS              BNO055_ADDRESS_A
+#define BNO055_ID                   0xA0        // What the chip ID register should read
+
+#define BNO055_STARTUP_mS           850         // From power on until the sensor answers on the bus (650 mS typical per the datasheet)
+#define BNO055_MODE_SWITCH_mS       20          // Time to switch operating modes (7 mS out of config mode, 19 mS into it)
+#define BNO055_LSB_PER_DEGREE       16          // Euler angles and gyro rates are both in 1/16ths
+
+// Registers (page 0)
+#define BNO055_CHIP_ID_ADDR         0x00
+#define BNO055_PAGE_ID_ADDR         0x07
+#define BNO055_GYRO_DATA_ADDR       0x14        // X, Y, Z, each LSB then MSB
+#define BNO055_EULER_DATA_ADDR      0x1A        // Heading, roll, pitch, each LSB then MSB. Straight after the gyro registers.
+#define BNO055_CALIB_STAT_ADDR      0x35        // System, gyro, accel, mag calibration, 2 bits each from the top down
+#define BNO055_OPR_MODE_ADDR        0x3D
+#define BNO055_PWR_MODE_ADDR        0x3E
+#define BNO055_SYS_TRIGGER_ADDR     0x3F
+
+#define BNO055_POWER_MODE_NORMAL    0x00
+#define BNO055_SYS_TRIGGER_EXT_CLK  0x80
+
+#define BNO055_SAMPLE_BYTES         12          // Gyro and Euler registers read in one go
+
+
+typedef struct {
+    int16_t x;
+    int16_t y;
+    int16_t z;
+} bno055_vector;
+
+typedef struct {
+    uint8_t system;
+    uint8_t gyro;
+    uint8_t accel;
+    uint8_t mag;
+} bno055_calibration;                           // Each 0 (not calibrated) to 3 (fully calibrated)
+
+
+class OP_BNO055
+{
+    public:
+        typedef enum
+        {
+            OPERATION_MODE_CONFIG       = 0x00,
+            OPERATION_MODE_ACCONLY      = 0x01,
+            OPERATION_MODE_MAGONLY      = 0x02,
+            OPERATION_MODE_GYRONLY      = 0x03,
+            OPERATION_MODE_ACCMAG       = 0x04,
+            OPERATION_MODE_ACCGYRO      = 0x05,
+            OPERATION_MODE_MAGGYRO      = 0x06,
+            OPERATION_MODE_AMG          = 0x07,
+            OPERATION_MODE_IMUPLUS      = 0x08,     // Fusion of accel and gyro only
+            OPERATION_MODE_COMPASS      = 0x09,
+            OPERATION_MODE_M4G          = 0x0A,
+            OPERATION_MODE_NDOF_FMC_OFF = 0x0B,
+            OPERATION_MODE_NDOF         = 0x0C      // Fusion of all three sensors
+        } opmode_t;
+
+        OP_BNO055(void) {}
+        static void     begin(void);                                    // Starts the I2C bus
+
+        // Setup only - these wait for the bus
+        static boolean  checkIfPresent(boolean waitForStartup = true);  // Looks for the sensor, and optionally gives it time to start up if it doesn't answer
+        static boolean  isPresent(void)                 { return Present; }
+        static boolean  setup(boolean useExtCrystal, opmode_t mode);    // Puts the sensor into the given fusion mode
+
+        // Main loop - these never wait
+        static boolean  requestSample(void);                            // Queue a read of the latest readings. False if one is already under way.
+        static boolean  sampling(void)                  { return Pending; }
+        static boolean  process(void);                                  // Call every loop. Returns true once, when the requested sample has come back.
+        static boolean  transactionSuccessful(void)     { return Successful; }  // Was the last sample read without errors
+
+        // The latest readings
+        static bno055_vector        orientation;        // Euler angles: x is heading (0 to 360), y roll (-90 to 90), z pitch (-180 to 180). In 1/16 degree.
+        static bno055_vector        gyro;               // Rotation rates, 1/16 degree per second
+        static bno055_calibration   calibration;
+
+    private:
+        static boolean  writeRegister(uint8_t reg, uint8_t value);      // These two wait, setup only
+        static boolean  readRegister(uint8_t reg, uint8_t &value);
+
+        static boolean  Present;
+        static boolean  Pending;
+        static boolean  Successful;
+        static int8_t   DataHandle;                                     // I2C transactions of the sample under way
+        static int8_t   CalibHandle;
+        static uint8_t  DataBuf[BNO055_SAMPLE_BYTES];                   // Where the I2C interrupt puts the readings
+        static uint8_t  CalibBuf;
+};
+
+
+#endif
@@ -49,6 +49,8 @@ OP_Button::OP_Button(uint8_t pin, uint8_t puEnable, uint8_t invert, uint32_t dbT
     _puEnable = puEnable;
     _invert = invert;
     _dbTime = dbTime;
+    _inputReg = portInputRegister(digitalPinToPort(_pin));
+    _bitMask = digitalPinToBitMask(_pin);
     pinMode(_pin, INPUT);
     if (_puEnable != 0)
         digitalWrite(_pin, HIGH);       //enable pullup resistor
@@ -70,7 +72,7 @@ uint8_t OP_Button::read(void)
     static uint8_t pinVal;
 
     ms = millis();
-    pinVal = digitalRead(_pin);
+    pinVal = (*_inputReg & _bitMask) ? HIGH : LOW;
     if (_invert != 0) pinVal = !pinVal;
     if (ms - _lastChange < _dbTime) {
         _time = ms;
@@ -44,6 +44,8 @@ class OP_Button
     
     private:
         uint8_t _pin;           //arduino pin number
+        volatile uint8_t *_inputReg;    //input register of the pin's port, looked up once so read() doesn't need digitalRead()
+        uint8_t _bitMask;       //bit of the pin in that register
         uint8_t _puEnable;      //internal pullup resistor enabled
         uint8_t _invert;        //if 0, interpret high state as pressed, else interpret low state as pressed
         uint8_t _state;         //current button state
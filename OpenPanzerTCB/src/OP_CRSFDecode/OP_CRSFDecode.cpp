@@ -0,0 +1,329 @@
+/* OP_CRSFDecode.cpp    Open Panzer CRSF Decoder - a library for decoding TBS Crossfire / ExpressLRS (CRSF) serial radio data
+ * Source:              openpanzer.org
+ * Authors:             Luke Middleton
+ *
+ * This library reads the CRSF serial protocol used by TBS Crossfire and ExpressLRS receivers and converts the RC channels frame into 16 analog channels.
+ * It also reads the link statistics frame, so we can tell when the receiver has lost the transmitter even if it keeps sending us channel data.
+ * See OP_CRSFDecode.h for notes on the frame format and baud rate.
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "OP_CRSFDecode.h"
+
+HardwareSerial        * CRSFDecode::_serial;                            // Hardware serial port
+uint8_t                 CRSFDecode::CRSFData[CRSF_MAX_FRAME_BYTES];     // Up to 64 bytes in a CRSF frame
+uint8_t                 CRSFDecode::crsf_pointer;                       // Pointer to CRSFData array
+uint8_t                 CRSFDecode::crc;                                // Running CRC8 of the frame being received
+uint16_t                CRSFDecode::Pulses[CRSF_CHANNELS];              // 16 channel pulse widths
+uint8_t                 CRSFDecode::stateCount;                         // counts the number of times this state has been repeated
+decodeState_t           CRSFDecode::State;                              // The current state
+boolean                 CRSFDecode::NewFrame;                           // Boolean variable to indicate a new complete frame has arrived or been read.
+boolean                 CRSFDecode::LinkDown;                           // Has the receiver reported 0% link quality
+uint8_t                 CRSFDecode::LinkQuality;                        // Uplink link quality in percent
+uint8_t                 CRSFDecode::RSSI;                               // Uplink RSSI in -dBm
+uint16_t                CRSFDecode::CRCErrors;                          // Frames thrown out for a bad CRC
+uint8_t                 CRSFDecode::minFrame_mS;                        // Pass on frames no more often than this
+uint32_t                CRSFDecode::LastPassedTime;                     // millis() when we last passed on a frame
+uint32_t                CRSFDecode::LastFrameTime;                      // millis() when the last valid RC frame arrived
+
+// CRC8 lookup table for polynomial 0xD5 (DVB-S2). One table read per byte instead of 8 shift-and-xor steps.
+const uint8_t CRSF_CRC8_Table[256] PROGMEM = {
+    0x00, 0xD5, 0x7F, 0xAA, 0xFE, 0x2B, 0x81, 0x54, 0x29, 0xFC, 0x56, 0x83, 0xD7, 0x02, 0xA8, 0x7D,
+    0x52, 0x87, 0x2D, 0xF8, 0xAC, 0x79, 0xD3, 0x06, 0x7B, 0xAE, 0x04, 0xD1, 0x85, 0x50, 0xFA, 0x2F,
+    0xA4, 0x71, 0xDB, 0x0E, 0x5A, 0x8F, 0x25, 0xF0, 0x8D, 0x58, 0xF2, 0x27, 0x73, 0xA6, 0x0C, 0xD9,
+    0xF6, 0x23, 0x89, 0x5C, 0x08, 0xDD, 0x77, 0xA2, 0xDF, 0x0A, 0xA0, 0x75, 0x21, 0xF4, 0x5E, 0x8B,
+    0x9D, 0x48, 0xE2, 0x37, 0x63, 0xB6, 0x1C, 0xC9, 0xB4, 0x61, 0xCB, 0x1E, 0x4A, 0x9F, 0x35, 0xE0,
+    0xCF, 0x1A, 0xB0, 0x65, 0x31, 0xE4, 0x4E, 0x9B, 0xE6, 0x33, 0x99, 0x4C, 0x18, 0xCD, 0x67, 0xB2,
+    0x39, 0xEC, 0x46, 0x93, 0xC7, 0x12, 0xB8, 0x6D, 0x10, 0xC5, 0x6F, 0xBA, 0xEE, 0x3B, 0x91, 0x44,
+    0x6B, 0xBE, 0x14, 0xC1, 0x95, 0x40, 0xEA, 0x3F, 0x42, 0x97, 0x3D, 0xE8, 0xBC, 0x69, 0xC3, 0x16,
+    0xEF, 0x3A, 0x90, 0x45, 0x11, 0xC4, 0x6E, 0xBB, 0xC6, 0x13, 0xB9, 0x6C, 0x38, 0xED, 0x47, 0x92,
+    0xBD, 0x68, 0xC2, 0x17, 0x43, 0x96, 0x3C, 0xE9, 0x94, 0x41, 0xEB, 0x3E, 0x6A, 0xBF, 0x15, 0xC0,
+    0x4B, 0x9E, 0x34, 0xE1, 0xB5, 0x60, 0xCA, 0x1F, 0x62, 0xB7, 0x1D, 0xC8, 0x9C, 0x49, 0xE3, 0x36,
+    0x19, 0xCC, 0x66, 0xB3, 0xE7, 0x32, 0x98, 0x4D, 0x30, 0xE5, 0x4F, 0x9A, 0xCE, 0x1B, 0xB1, 0x64,
+    0x72, 0xA7, 0x0D, 0xD8, 0x8C, 0x59, 0xF3, 0x26, 0x5B, 0x8E, 0x24, 0xF1, 0xA5, 0x70, 0xDA, 0x0F,
+    0x20, 0xF5, 0x5F, 0x8A, 0xDE, 0x0B, 0xA1, 0x74, 0x09, 0xDC, 0x76, 0xA3, 0xF7, 0x22, 0x88, 0x5D,
+    0xD6, 0x03, 0xA9, 0x7C, 0x28, 0xFD, 0x57, 0x82, 0xFF, 0x2A, 0x80, 0x55, 0x01, 0xD4, 0x7E, 0xAB,
+    0x84, 0x51, 0xFB, 0x2E, 0x7A, 0xAF, 0x05, 0xD0, 0xAD, 0x78, 0xD2, 0x07, 0x53, 0x86, 0x2C, 0xF9
+};
+
+// Constructor
+CRSFDecode::CRSFDecode(){}
+
+void CRSFDecode::begin()
+{
+    // Set Rx pin to input
+    CRSF_DDR &= ~(1 << CRSF_RXPIN);         // Input is selected when Data DiRection bit is cleared
+    // Set pullup
+    CRSF_PORT |= (1 << CRSF_RXPIN);         // Pullups selected when port pin bit set
+
+    // Initialize Arduino Serial port
+    _serial = &CRSF_SERIAL;
+    _serial->begin(CRSF_BAUD, SERIAL_8N1);  // 400k baud, 8 data bits, no parity, 1 stop bit
+
+    // But because we also like to do things manually for educational purposes, here is the explicit setup:
+
+    // Make sure power reduction hasn't turned off this serial port
+    PRR1 &= ~(1 << CRSF_PRUSART);
+    //Set baud rate
+    CRSF_UBRRH = (unsigned char)(UBRR_CRSF>>8);
+    CRSF_UBRRL = (unsigned char)UBRR_CRSF;
+    // Set frame format
+    CRSF_UCSRC = 0x06;                  // mode normal (asynchronous USART), no parity , 1 stop bit, 8 bits data, no polarity for asynchronous
+
+    // Clear flags, set double speed mode, disable multi-processor mode
+    CRSF_UCSRA = 0xFE;                  // Flags are cleared by writing 1. We also set U2Xn for double USART speed, which lets us hit 400k exactly (see UBRR_CRSF)
+                                        // MPCMn - multiprocessor communication mode, we want this off (0)
+    // Enable receiver only
+    CRSF_UCSRB = 0x90;                  // Rx interrupt enabled, Rx enabled, TX disabled, only 8 bits
+
+    LastFrameTime = millis();           // Start the frame age from now, so the radio class doesn't see a stale signal before we've had a chance to acquire
+    LastPassedTime = LastFrameTime;
+
+    // Other initializations
+    State = NOT_SYNCHED_state;          // Decoder not yet synched
+    stateCount = 0;                     // Repeated a state 0 times
+    NewFrame = false;                   // We haven't received a frame yet, so it hasn't been read either
+    LinkDown = false;                   // We don't know anything about the link yet, assume it's fine until told otherwise
+    LinkQuality = 0;
+    RSSI = 0;
+    CRCErrors = 0;
+
+    // Initialize pulses to Center for safety
+    for(uint8_t i = 0; i<CRSF_CHANNELS; i++)
+    {
+        Pulses[i] = DEFAULT_PULSE_CENTER;
+    }
+
+    // Start frame at zero
+    crsf_pointer = 0;
+
+    // Pass on every frame
+    defaultSpeed();
+}
+
+void CRSFDecode::shutdown()
+{   // If we end up using PPM input instead, we will want to disable the serial function of this pin
+    // otherwise the PPM could be setting it off
+    _serial->end();
+    CRSF_UCSRB &= ~(1 << CRSF_RXCIE);   // Disable receive interrupts
+    CRSF_UCSRB &= ~(1 << CRSF_RXEN);    // Disable receiver
+    CRSF_UCSRA = 0x00;                  // Clear all interrupt flags
+}
+
+
+// Read all received data and calculate channel data
+void CRSFDecode::update()
+{
+    // Unlike SBus and iBus we don't check the USART error flags here. Those flags belong to the byte presently in the USART, not the one we are
+    // taking out of Arduino's buffer, and every CRSF frame carries a CRC which catches a corrupted byte anyway.
+    while (_serial->available())
+    {
+        parseByte(_serial->read());
+    }
+}
+
+void CRSFDecode::parseByte(uint8_t b)
+{
+    if (addByte(b) == false) resync();  // Nearly every byte is simply accepted. If this one shows we synched to something that wasn't really a frame, go back and look again.
+}
+
+boolean CRSFDecode::addByte(uint8_t b)
+{
+    // Returns false if this byte shows the frame we have been collecting isn't a real frame (bad length or CRC).
+    // Every byte taken after the address is saved, including the one that failed, so resync() can look through them again.
+    switch (crsf_pointer)
+    {
+        case 0:
+            // Waiting for the address byte that starts a frame. Anything else is ignored.
+            if (b == CRSF_ADDRESS_FLIGHT_CONTROLLER) { CRSFData[crsf_pointer++] = b; }
+            return true;
+
+        case 1:
+            // Length byte. If it's out of range this wasn't really the start of a frame.
+            CRSFData[crsf_pointer++] = b;
+            crc = 0;
+            return (b >= CRSF_MIN_LENGTH && b <= CRSF_MAX_LENGTH);
+
+        default:
+            CRSFData[crsf_pointer++] = b;
+            if (crsf_pointer < CRSFData[1] + 2)
+            {   // Type and payload bytes. Keep a running CRC, so there's nothing left to do when the last byte comes in.
+                crc = pgm_read_byte(&CRSF_CRC8_Table[crc ^ b]);
+                return true;
+            }
+            // This is the CRC byte, the frame is complete
+            if (b == crc)
+            {
+                crsf_pointer = 0;
+                processFrame();
+                return true;
+            }
+            CRCErrors++;
+            return false;
+    }
+}
+
+void CRSFDecode::resync()
+{
+    // The address byte we synched to turned out to be a 0xC8 in the middle of some other data. The real start of a frame may be among the bytes we have
+    // already taken, and we can't just carry on from the next byte: with the sticks still, ExpressLRS sends the same frame over and over, and we could keep
+    // landing on the same false start every time without ever seeing the real one. So we go back to the byte after the false start and look again from there.
+    // This only happens after a dropped byte or when first connecting, and costs at most a few hundred bytes worth of work.
+    uint8_t replay[CRSF_MAX_FRAME_BYTES];
+    uint8_t count = crsf_pointer;
+    uint8_t start = 0;                      // Where the frame we are presently collecting began in replay[]
+    uint8_t i = 1;                          // replay[0] was the false start, so begin after it
+
+    memcpy(replay, CRSFData, count);
+    crsf_pointer = 0;
+    while (i < count)
+    {
+        if (crsf_pointer == 0) start = i;
+        if (addByte(replay[i++]) == false)
+        {   // Another false start, try again from the byte after it
+            i = start + 1;
+            crsf_pointer = 0;
+        }
+    }
+}
+
+void CRSFDecode::processFrame()
+{
+uint32_t now;
+
+    switch (CRSFData[2])
+    {
+        case CRSF_FRAMETYPE_RC_CHANNELS_PACKED:
+            if (CRSFData[1] != CRSF_RC_PAYLOAD_BYTES + 2) break;    // Wrong size, ignore it
+
+            // Some receivers keep sending channel data after they lose the transmitter (with the channels held or at failsafe positions).
+            // If the last link statistics said the link was down we don't use it, and we don't stamp it either, so the radio class will go to failsafe.
+            if (LinkDown) break;
+
+            now = millis();
+            LastFrameTime = now;                // Stamp every valid frame, even the ones we don't pass on below. The radio class uses the age of this to decide when the signal has been lost
+
+            if (State == NOT_SYNCHED_state)
+            {   // This is our first valid frame. Set state to ACQUIRING and start counting.
+                State = ACQUIRING_state;
+                stateCount = 0;
+            }
+            if (State == ACQUIRING_state)
+            {   // We keep acquiring until we have ACQUISITION count of frames under our belt.
+                if (++stateCount >= CRSF_ACQUISITION_COUNT)
+                {
+                    State = READY_state;        // Ok, we have enough complete frames, we think we know what we're doing now, so let's roll!
+                }
+            }
+            else
+            {
+                State = READY_state;            // Valid frame, keep at Ready
+            }
+
+            if ((now - LastPassedTime) >= minFrame_mS)
+            {
+                ConvertCRSF_to_PWM();           // Convert CRSF data to individual channel pulse-widths
+                NewFrame = true;                // Set the new frame flag
+                LastPassedTime = now;
+            }
+            break;
+
+        case CRSF_FRAMETYPE_LINK_STATISTICS:
+            if (CRSFData[1] != CRSF_LINKSTATS_PAYLOAD_BYTES + 2) break;
+
+            // Payload starts at byte 3: uplink RSSI antenna 1, uplink RSSI antenna 2, uplink link quality, uplink SNR, active antenna, ...
+            RSSI = CRSFData[7] ? CRSFData[4] : CRSFData[3];
+            LinkQuality = CRSFData[5];
+            if (LinkQuality == 0)
+            {   // The receiver has lost the transmitter
+                LinkDown = true;
+                State = FAILSAFE_state;
+            }
+            else
+            {
+                LinkDown = false;
+            }
+            break;
+
+        default:
+            // Other frame types (device info, telemetry, etc.) are of no interest to us
+            break;
+    }
+}
+
+void CRSFDecode::ConvertCRSF_to_PWM()
+{
+    // Convert CRSF channel data to 16 channel pulse-widths.
+    // The channels are packed exactly like SBus, see ConvertSBus_to_PWM() in OP_SBusDecode.cpp for where this comes from.
+    uint8_t inputbitsavailable = 0;
+    uint32_t inputbits = 0;
+    uint8_t *crsf = &CRSFData[3];   // Skip address, length and type
+    for ( uint8_t i = 0 ; i < CRSF_CHANNELS ; i += 1 )
+    {
+        uint16_t temp;
+        while ( inputbitsavailable < 11 )
+        {
+            inputbits |= (uint32_t)*crsf++ << inputbitsavailable;
+            inputbitsavailable += 8;
+        }
+
+        // Convert the CRSF data (172-1811 at full travel) to PWM pulse widths (988-2012 uS). The scaling is the same as SBus.
+        temp = ( (int16_t)( inputbits & 0x7FF ) - 0x3E0 ) * 5 / 8 + 1500;
+
+        // If the pulse is valid, save it. Otherwise the result is that we keep the last value. See OP_RadioDefines.h for min and max pulsewidths.
+        if (( temp > MIN_POSSIBLE_PULSE) && (temp < MAX_POSSIBLE_PULSE)) { Pulses[i] = temp; }
+
+        inputbitsavailable -= 11 ;
+        inputbits >>= 11 ;
+    }
+}
+
+void CRSFDecode::GetCRSF_Frame( int16_t pulseArray[], int16_t chanCount)
+{
+    // This copies as many channels as are requested from a CRSF frame to the array that is passed as a parameter
+    byte sregRestore = SREG;        // Save interrupt register
+    cli();                          // Disable interrupts
+    for (uint8_t i=0; i<chanCount; i++)
+    {
+        pulseArray[i] = Pulses[i];
+    }
+    SREG = sregRestore;             // Restore interrupt register
+
+    NewFrame = false;               // We've read this frame, so it's no longer new
+}
+
+decodeState_t CRSFDecode::getState()
+{
+    return State;
+}
+
+uint8_t CRSFDecode::getChanCount()
+{
+    return CRSF_CHANNELS;
+}
+
+void CRSFDecode::slowDownForPCComm(void)
+{
+    // Pass on fewer frames so that streaming data to the PC doesn't bog down
+    minFrame_mS = CRSF_PCCOMM_MIN_FRAME_mS;
+}
+
+void CRSFDecode::defaultSpeed(void)
+{
+    // Revert to the default, this gives us maximum responsiveness when in normal operation
+    minFrame_mS = CRSF_DEFAULT_MIN_FRAME_mS;
+}
@@ -0,0 +1,192 @@
+/* OP_CRSFDecode.h  Open Panzer CRSF Decoder - a library for decoding TBS Crossfire / ExpressLRS (CRSF) serial radio data
+ * Source:          openpanzer.org
+ * Authors:         Luke Middleton
+ *
+ * This library reads the CRSF serial protocol used by TBS Crossfire and ExpressLRS receivers and converts the RC channels frame into 16 analog channels.
+ * It also reads the link statistics frame, so we can tell when the receiver has lost the transmitter even if it keeps sending us channel data.
+ *
+ * A CRSF frame looks like this:
+ * byte 0           Address. Receivers send to the flight controller address, 0xC8
+ * byte 1           Length of the rest of the frame (type + payload + CRC), 2 to 62
+ * byte 2           Frame type
+ * byte 3...        Payload
+ * last byte        CRC8 (polynomial 0xD5, DVB-S2) of the type and payload bytes
+ * There is no idle gap between frames that we could sync to (at high packet rates frames are sent nearly back to back), so we sync on the address byte
+ * and rely on the length check and CRC to throw out false starts.
+ *
+ * The CRSF standard baud rate is 420,000, but that can't be generated from a 16 MHz clock: the nearest is 400,000, which is 4.8% slow and beyond what the
+ * USART can reliably receive. ExpressLRS receivers let you set the serial baud rate, so set the receiver to 400,000 (see CRSF_BAUD below).
+ * Like iBus the signal is not inverted, so no hardware is needed, just connect to the same Serial 3 input used by SBus and iBus.
+ *
+ * Like the SBus and iBus decoders, Arduino appropriates the hardware serial interrupt ISR(USART3_RX_vect), so this library needs to be polled. Each
+ * byte is passed to parseByte(), which does a small amount of work per byte and never allocates anything, so it could just as well be called
+ * from our own receive interrupt if we ever take that over from Arduino. The one exception is after a false start (a 0xC8 in the middle of other data
+ * that we took for an address byte), where it looks back through the bytes it has already taken - see resync().
+ * At 400k baud the 64 byte Arduino receive buffer holds about 2.5 RC frames. At a 150 Hz packet rate that is ~16 mS, which the main loop easily keeps up with.
+ * At 500 Hz it is only ~5 mS, so for a tank there is little point setting the packet rate above 150 or 250 Hz.
+ *
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OP_CRSFDecode_H
+#define OP_CRSFDecode_H
+
+#include <Arduino.h>
+#include "../OP_Settings/OP_Settings.h"
+#include "../OP_Radio/OP_RadioDefines.h"
+
+
+// Uncomment only ONE of the below, to indicate which hardware serial the CRSF will receive data on.
+//#define CRSF_SERIAL_0     0
+//#define CRSF_SERIAL_1     1
+//#define CRSF_SERIAL_2     2
+#define CRSF_SERIAL_3       3       // For the TCB, we want Serial 3
+
+// Now we will save the appropriate registers for the selected serial port
+// THIS IS ONLY GUARANTEED TO WORK FOR THE ATmega2560!
+#if defined (CRSF_SERIAL_0)
+    #define CRSF_UBRRH      UBRR0H
+    #define CRSF_UBRRL      UBRR0L
+    #define CRSF_UCSRA      UCSR0A
+    #define CRSF_UCSRB      UCSR0B
+    #define CRSF_UCSRC      UCSR0C
+    #define CRSF_UDR        UDR0
+    #define CRSF_SERIAL     Serial0
+    #define CRSF_PRUSART    PRUSART0
+    #define CRSF_RXEN       RXEN0
+    #define CRSF_RXC        RXC0
+    #define CRSF_RXCIE      RXCIE0
+    #define CRSF_PORT       PORTE
+    #define CRSF_DDR        DDRE
+    #define CRSF_RXPIN      PE0
+#elif defined (CRSF_SERIAL_1)
+    #define CRSF_UBRRH      UBRR1H
+    #define CRSF_UBRRL      UBRR1L
+    #define CRSF_UCSRA      UCSR1A
+    #define CRSF_UCSRB      UCSR1B
+    #define CRSF_UCSRC      UCSR1C
+    #define CRSF_UDR        UDR1
+    #define CRSF_SERIAL     Serial1
+    #define CRSF_PRUSART    PRUSART1
+    #define CRSF_RXEN       RXEN1
+    #define CRSF_RXC        RXC1
+    #define CRSF_RXCIE      RXCIE1
+    #define CRSF_PORT       PORTD
+    #define CRSF_DDR        DDRD
+    #define CRSF_RXPIN      PD2
+#elif defined (CRSF_SERIAL_2)
+    #define CRSF_UBRRH      UBRR2H
+    #define CRSF_UBRRL      UBRR2L
+    #define CRSF_UCSRA      UCSR2A
+    #define CRSF_UCSRB      UCSR2B
+    #define CRSF_UCSRC      UCSR2C
+    #define CRSF_UDR        UDR2
+    #define CRSF_SERIAL     Serial2
+    #define CRSF_PRUSART    PRUSART2
+    #define CRSF_RXEN       RXEN2
+    #define CRSF_RXC        RXC2
+    #define CRSF_RXCIE      RXCIE2
+    #define CRSF_PORT       PORTH
+    #define CRSF_DDR        DDRH
+    #define CRSF_RXPIN      PH0
+#else defined (CRSF_SERIAL_3)
+    #define CRSF_UBRRH      UBRR3H
+    #define CRSF_UBRRL      UBRR3L
+    #define CRSF_UCSRA      UCSR3A
+    #define CRSF_UCSRB      UCSR3B
+    #define CRSF_UCSRC      UCSR3C
+    #define CRSF_UDR        UDR3
+    #define CRSF_SERIAL     Serial3
+    #define CRSF_PRUSART    PRUSART3
+    #define CRSF_RXEN       RXEN3
+    #define CRSF_RXC        RXC3
+    #define CRSF_RXCIE      RXCIE3
+    #define CRSF_PORT       PORTJ
+    #define CRSF_DDR        DDRJ
+    #define CRSF_RXPIN      PJ0
+#endif
+
+// CRSF is specified at 420k baud, which we can't generate from 16 MHz (see the notes at the top of this file). We run at 400k instead, which we can match exactly.
+#define CRSF_BAUD                   400000
+#define UBRR_CRSF                   4           // In double speed mode: (F_CPU / (8 * BAUD) ) -1 = (16,000,000 / (8 * 400,000) ) - 1 = 4 exactly
+                                                // We need to make sure we select double speed mode by setting U2Xn = 1, see begin() in OP_CRSFDecode.cpp.
+                                                // For comparison, data sent at 420k would arrive 5% fast. The datasheet puts the limit of what the USART can receive in double speed
+                                                // mode at about 3.8% fast, and recommends staying within 1.5%.
+
+#define CRSF_ADDRESS_FLIGHT_CONTROLLER      0xC8    // Receivers address their frames to the flight controller, which is us
+#define CRSF_FRAMETYPE_LINK_STATISTICS      0x14    // Link statistics - RSSI, link quality, SNR, etc.
+#define CRSF_FRAMETYPE_RC_CHANNELS_PACKED   0x16    // 16 channels of 11 bits each, packed LSB first (the same packing as SBus)
+
+#define CRSF_CHANNELS               16          // Number of CRSF channels
+#define CRSF_MAX_FRAME_BYTES        64          // Maximum total frame size including address, length and CRC bytes
+#define CRSF_MIN_LENGTH             2           // Smallest valid value of the length byte (type + CRC, no payload)
+#define CRSF_MAX_LENGTH             (CRSF_MAX_FRAME_BYTES - 2)  // Largest valid value of the length byte
+#define CRSF_RC_PAYLOAD_BYTES       22          // 16 channels x 11 bits = 176 bits = 22 bytes
+#define CRSF_LINKSTATS_PAYLOAD_BYTES 10         // Uplink RSSI 1, uplink RSSI 2, uplink link quality, uplink SNR, active antenna, RF mode, uplink Tx power, downlink RSSI, downlink LQ, downlink SNR
+#define CRSF_CRC8_POLY              0xD5        // DVB-S2 polynomial, used for the CRC8 at the end of every frame
+
+#define CRSF_ACQUISITION_COUNT      4           // Must have this many consecutive valid RC frames to transition to the ready state.
+
+#define CRSF_DEFAULT_MIN_FRAME_mS   0           // Unlike SBus and iBus, the CRSF packet rate is set by the user (ExpressLRS from 25 to 500 Hz), so rather than discard a fixed number of
+#define CRSF_PCCOMM_MIN_FRAME_mS    18          // frames we pass on no more than one frame per this many mS. In normal operation we keep every frame. The PCComm setting is an optionally
+                                                // slower rate for streaming to the PC during the Radio Setup routine, see the notes for SBUS_PCCOMM_DISCARD_FRAMES in OP_SBusDecode.h.
+                                                // 18 mS matches SBus at its PCComm setting (every other 9 mS frame).
+
+class CRSFDecode
+{
+    public:
+        CRSFDecode(); //Constructor
+        void                    begin();
+        void                    shutdown(void);                 // Turn the receiver off
+        decodeState_t           getState(void);
+        uint8_t                 getChanCount(void);             // Channel count - will always return CRSF_CHANNELS
+        void                    GetCRSF_Frame(int16_t pulseArray[], int16_t chanCount);  // Copy a complete frame of pulses
+        static boolean          NewFrame;                       // Has an unread frame of data arrived?
+        uint32_t                getLastFrameTime(void) { return LastFrameTime; }    // millis() time when the last valid RC frame arrived (passed on or not)
+        void                    update(void);                   // Read everything waiting in the serial buffer
+        static void             parseByte(uint8_t b);           // Process a single received byte. Does a small amount of work and allocates nothing.
+        void                    slowDownForPCComm(void);        // Pass on frames no more often than CRSF_PCCOMM_MIN_FRAME_mS
+        void                    defaultSpeed(void);             // Revert to CRSF_DEFAULT_MIN_FRAME_mS
+        uint8_t                 getLinkQuality(void)  { return LinkQuality; }   // Uplink link quality in percent, from the last link statistics frame
+        uint8_t                 getRSSI(void)         { return RSSI; }          // Uplink RSSI of the active antenna in -dBm (a bigger number is a weaker signal)
+        uint16_t                getCRCErrors(void)    { return CRCErrors; }     // Count of frames thrown out because the CRC didn't match
+
+    private:
+        static boolean          addByte(uint8_t b);             // Add a byte to the frame being received. Returns false if it turns out not to be a frame.
+        static void             resync(void);                   // Look for a frame start among the bytes of a false start
+        static void             processFrame(void);             // Act on a complete frame whose CRC has been checked
+        static void             ConvertCRSF_to_PWM(void);       // Convert a frame of CRSF channel data to pulse-widths
+
+        static HardwareSerial   *_serial;                       // Hardware serial pointer
+        static uint8_t          CRSFData[CRSF_MAX_FRAME_BYTES]; // Array to hold CRSF frame bytes
+        static uint8_t          crsf_pointer;                   // Pointer to current position of array
+        static uint8_t          crc;                            // Running CRC8 of the frame being received
+        static uint16_t         Pulses[CRSF_CHANNELS];          // Array to hold pulse widths for all channels
+
+        static uint8_t          stateCount;                     // counts the number of times this state has been repeated
+        static decodeState_t    State;                          // The current state
+        static boolean          LinkDown;                       // The last link statistics frame reported 0% link quality. We ignore channel data until the link is back.
+        static uint8_t          LinkQuality;                    // From the last link statistics frame
+        static uint8_t          RSSI;                           // From the last link statistics frame
+        static uint16_t         CRCErrors;                      // Frames with a bad CRC
+        static uint8_t          minFrame_mS;                    // Pass on frames no more often than this
+        static uint32_t         LastPassedTime;                 // millis() time when we last passed on a frame
+        static uint32_t         LastFrameTime;                  // millis() time when the last valid RC frame was received
+};
+
+
+#endif
+
@@ -25,16 +25,19 @@
 uint8_t             OP_Driver::DriveType;
 // Drive speed ramping
 boolean             OP_Driver::DriveRampEnabled;
-volatile uint16_t   OP_Driver::RampedDriveSpeed;
-volatile int8_t     OP_Driver::DriveRampStep;
-volatile int8_t     OP_Driver::DriveSkipNum;
-volatile int8_t     OP_Driver::DriveSkipCount;
+uint16_t            OP_Driver::RampedDriveSpeed;
+int8_t              OP_Driver::DriveRampStep;
+int8_t              OP_Driver::DriveSkipNum;
+int8_t              OP_Driver::DriveSkipCount;
 // Throttle speed ramping
 boolean             OP_Driver::ThrottleRampEnabled;
-volatile int16_t    OP_Driver::RampedThrottleSpeed; 
-volatile int8_t     OP_Driver::ThrottleRampStep;    
-volatile int8_t     OP_Driver::ThrottleSkipNum;
-volatile int8_t     OP_Driver::ThrottleSkipCount;
+int16_t             OP_Driver::RampedThrottleSpeed; 
+int8_t              OP_Driver::ThrottleRampStep;    
+int8_t              OP_Driver::ThrottleSkipNum;
+int8_t              OP_Driver::ThrottleSkipCount;
+// Ramp updates
+uint32_t            OP_Driver::LastRampTime;
+boolean             OP_Driver::RampsActive;
 // User settings
 boolean             OP_Driver::AccelRampEnabled;
 boolean             OP_Driver::DecelRampEnabled;
@@ -104,89 +107,26 @@ void OP_Driver::begin(DRIVETYPE dt, uint8_t tm, boolean nta)
     NeutralTurnAllowed = nta;                       // Are neutral turns allowed
     
 
-    // SET INTERRUPT FREQUENCY
+    // RAMP UPDATES
     // -------------------------------------------------------------------------------------------------------------------------------------------------->    
-    // Theory of operation: We create an interrupt that triggers 256 times a second. There are 256 steps possible between complete stop and full throttle. 
+    // Theory of operation: We update ramped speeds 256 times a second. There are 256 steps possible between complete stop and full throttle. 
     // If we want to implement acceleration or deceleration constraints, we can disconnect drive speed from the user's thumb, and instead, only increase (or decrease) 
-    // the speed by some small amount each time (or some number of times) that the interrupt triggers. If we increase the speed by 2 (our default "step") and we do so every time the 
-    // interrupt hits, that means we would accelerate from a complete stop to full speed in 1/2 second. If we were to only increase the speed by 2 every *other* time the 
-    // interrupt hits, we would take 1 full second to accelerate to full speed. In fact, at a default step increase of 2, for each number of interrupts that we skip, we increase
+    // the speed by some small amount each time (or some number of times) that an update comes due. If we increase the speed by 2 (our default "step") and we do so on every 
+    // update, that means we would accelerate from a complete stop to full speed in 1/2 second. If we were to only increase the speed by 2 every *other* update, 
+    // we would take 1 full second to accelerate to full speed. In fact, at a default step increase of 2, for each number of updates that we skip, we increase
     // the amount of time it takes to accelerate to full speed by 1/2 second. That is why we chose a frequency of 256 hertz and a default step of 2. 
     // In the OP Config program, we give the user a choice of acceleration/deceleration constraint "levels" from 1 - 14, but these translate directly to the number of
-    // interrupts to skip. At Level 1 the tank will accelerate in 1/2 second, at level 14 it will take 7 seconds. We don't go beyond 14 because even 7 seconds is probably 
+    // updates to skip. At Level 1 the tank will accelerate in 1/2 second, at level 14 it will take 7 seconds. We don't go beyond 14 because even 7 seconds is probably 
     // slower than anyone wants to go. And we don't go less than 1, because faster than 1/2 second and you might as well turn off the acceleration constraint completely (which the user can do). 
     
     // We can get even more fancy if we want. We can programmatically tweak the increment "step", it doesn't always have to be 2. Higher steps mean faster acceleration (speed
-    // increments more each interrupt), lower steps mean slower. And we can also programmatically modify the number of interrupts to skip, which as described will speed up or 
+    // increments more each update), lower steps mean slower. And we can also programmatically modify the number of updates to skip, which as described will speed up or 
     // slow down the acceleration. 
     
-    // Here is the code to setup an interrupt to occur 256 times a second:  
-        // See the Atmega2560 datasheet, chapter 17 (16 bit timers)
-        // See also The Secrets of Arduino PWM by Ken Shirriff: http://www.righto.com/2009/07/secrets-of-arduino-pwm.html
-        
-        // We are going to setup a recurring interrupt by using Timer 3 in CTC mode (Clear Timer on Compare match mode)
-        // We will be using WGM mode 4 where the TOP value (compare match value) is OCR3A, which we can set to whatever we want (page 148)
-        
-        // We want a 256hz update rate (interrupt every 4mS = 0.004 seconds)
-        
-        // Rate will be equal to: 16 MHz (clock) / prescaler / OCR3A value
-        
-        // We will use a prescaler of 256, and set OCR3A to 244
-        // 16mhz / 256 / 244 = 256 hz
-
-        // Prescaler settings:
-        // - On the Mega, for 16 bit timers only 1, 3, 4, and 5 (not timers 0 or 2), 
-        // - using 16mHz system clock, 
-        /*  
-            If TCCRnB = xxxxx000, no clock, timer stopped
-            If TCCRnB = xxxxx001, prescaler 1
-            If TCCRnB = xxxxx010, prescaler 8 (clock/8)
-            If TCCRnB = xxxxx011, prescaler 64 (Arduino default initialization)
-            If TCCRnB = xxxxx100, prescaler 256
-            If TCCRnB = xxxxx101, prescaler 1024
-            If TCCRnB = xxxxx11x, external clock source, we don't care about. 
-        */
-        
-        // Several settings need to be made 
-        // Waveform Generation Mode bigs (WGM): split across TCCRnA and TCCRnB. We want Mode 4 CTC (0100)
-        // Clock Select: three bits which control the control the prescaler, these are the last three bits of 
-        //      TCCRnB (CSn2, CSn1, CSn0)
-        // Compare Match Output A,B, C Mode bits (COMnA,B,C): these enable/disable/invert outputs A,B,C
-        // We aren't outputing anything related to this timer to the pins so we set these all to zero (pins disconnected from timer, normal pin operation)
-        //      Two bits each, in TCCRnA register
-        
-        // To set the compare match value (TOP), we write to OCR3A
-        
-        // Where "n" is Timer Number
-        //TCCRnA    7   6       5   4       3   2       1   0
-        //       COMnA1:0    COMnB1:0    COMnC1:0     WGMn1:0
-        //TCCRnB    7       6   5     4   3     2  1 0
-        //      ICNCn   ICESn   -   WGMn3:2     CSn2:0
-        // We don't need to worry about ICNC (input capture noise canceller) or ICES (Input Capture Edge Select)
-
-        // Looking at the above, we need to set TCCR3A = 0 (disconnect pins, last two bits of WGM = 0)
-        // Then we need to set TCCR3B = 0x00 0 01 100   bit 3 of WGM = 1, CS3 = 100 (prescaler 256)
-        
-        // So for Timer 3, here is what we need
-        // CTC Mode 4, TOP = OCR3A: WGM33:0 = 0100
-        // Prescaler = 256: CS32:0 = 100
-        // COM5A1:0, COM5B1:0, COM5C1:0 = 00 disconnected
-
-
-        TCNT3 = 0;                      // clear the timer count  
-
-        // Initilialise Timer3
-        TCCR3A = 0;
-        TCCR3B = _BV(WGM32) | _BV(CS32);
-        OCR3A = 244;        // 16,000,000 / 256 prescaler / 256 hertz = 244 TOP value
-
-        // Timer interrupts
-        TIFR3 = 1;                      // clear all interrupt flags. Oddly they are manually cleared by writing them with a logic one. 
-        TIMSK3 = _BV(OCIE3A);           // Enable the compare interrupt A. The Timer 3 Compare A interrupt vector is called when OCF3A flag is set (pg 166)
-                                        // OCF3A flag is set whenever TCNT3 values matches OCR3A
-                                        // Flag is automatically cleared when ISR executed. 
-                                        // We've disabled the other Timer3 interrupts including the overflow. We shall want to reset TCNT3 each time the ISR is called. 
-        //OP_Driver::DisableRampInterrupt();    // Start with the interrupt turned off
+    // These updates used to be done by a Timer 3 interrupt. But nothing needs the ramped speeds except GetDriveSpeed and GetThrottleSpeed, so now those functions 
+    // simply work out how many updates have come due since they were last called (see UpdateRamps). The result is the same, without an interrupt. 
+    LastRampTime = micros();
+    RampsActive = true;                             // The interrupt used to start out enabled, so we do the same
 }
 
 void OP_Driver::setDrivingProfileSettings(boolean are, boolean dre, ACCEL_DRIVE_PRESET adp, DECEL_DRIVE_PRESET ddp, uint8_t asn, uint8_t dsn)
@@ -198,24 +138,8 @@ void OP_Driver::setDrivingProfileSettings(boolean are, boolean dre, ACCEL_DRIVE_
     DecelRampEnabled = dre;                         //     UseDriveRamp will be the flag that indicates whether it is presently active. 
     AccelPreset = adp;                              // Accel/decel presets 
     DecelPreset = ddp;
-    AccelSkipNum = asn;                             // These are the number of interrupts to skip before incrementing the drive speed, when drive ramping is enabled.
-    DecelSkipNum = dsn;                             // The interrupt occurs 256 times a second, but we don't have to increment the speed each time. 
-}
-
-void OP_Driver::SetRampInterrupt()
-{
-    // If either drive or throttle ramping is enabled, keep the interrupt going
-    if (DriveRampEnabled || ThrottleRampEnabled) EnableRampInterrupt();
-    // Otherwise, turn it off. No need to waste cycles. 
-    else DisableRampInterrupt();
-}
-void OP_Driver::DisableRampInterrupt()
-{   
-    TIMSK3 &= ~_BV(OCIE3A);
-}
-void OP_Driver::EnableRampInterrupt()
-{   
-    TIMSK3 |= _BV(OCIE3A);
+    AccelSkipNum = asn;                             // These are the number of updates to skip before incrementing the drive speed, when drive ramping is enabled.
+    DecelSkipNum = dsn;                             // Updates occur 256 times a second, but we don't have to increment the speed each time. 
 }
 
 // The user sets these values in OP Config. But we may want to change them on the fly too.
@@ -239,32 +163,53 @@ uint8_t OP_Driver::getDecelRampFrequency(void)
     return DecelSkipNum;
 }
 
-// Timer3 Output Compare A interrupt service routine
-ISR(TIMER3_COMPA_vect)
+// Apply any ramp updates that have come due since the last time we were called. Each update, each ramp's skip count is incremented, and if it reaches 
+// the skip number the ramped speed is changed by the ramp step and the skip count starts over. The step and skip number in effect are whatever the 
+// last call to GetDriveSpeed/GetThrottleSpeed set them to, exactly as if an interrupt had been doing this in the background the whole time. 
+void OP_Driver::UpdateRamps(void)
 {
-    // If we have private member variables they will not be visible to this ISR,
-    // instead we need to call a member function of OP_Driver
-    OP_Driver::OCR3A_ISR();
+    uint32_t Elapsed = micros() - LastRampTime;
+    uint16_t Updates; 
+    
+    if (Elapsed < RAMP_UPDATE_uS) return;
+
+    if (Elapsed >= ((uint32_t)RAMP_MAX_UPDATES * RAMP_UPDATE_uS)) 
+    {   
+        Updates = RAMP_MAX_UPDATES;
+        LastRampTime = micros();
+    }
+    else
+    {
+        Updates = Elapsed / RAMP_UPDATE_uS;
+        LastRampTime += (uint32_t)Updates * RAMP_UPDATE_uS;     // Keep the remainder so no time is lost between calls
+    }
+    
+    // If neither ramp was enabled no updates happen (the interrupt used to be turned off in this case)
+    if (!RampsActive) return;
+    
+    RampedDriveSpeed += CountSteps(DriveSkipNum, DriveSkipCount, Updates) * DriveRampStep;
+    RampedThrottleSpeed += CountSteps(ThrottleSkipNum, ThrottleSkipCount, Updates) * ThrottleRampStep;
 }
 
-// This is the routine that gets called 256 times a second. We keep it as short as possible.
-void OP_Driver::OCR3A_ISR()
+// Work out how many times a ramp would step in the given number of updates, and leave the skip count where it would have ended up
+uint16_t OP_Driver::CountSteps(int8_t SkipNum, int8_t &SkipCount, uint16_t Updates)
 {
-    // Reset the timer, start counting again
-    TCNT3 = 0;
-
-    // We keep skipping until we reach DriveSkipNum number of skips. 
-    if (++DriveSkipCount >= DriveSkipNum)
-    {   // Then reset the skip count, and increment our ramped drive speed
-        DriveSkipCount = 0;
-        RampedDriveSpeed += DriveRampStep;
-    }
+    uint16_t First;     // Updates until the next step
+    uint16_t Steps;
     
-    if (++ThrottleSkipCount >= ThrottleSkipNum)
-    {
-        ThrottleSkipCount = 0;
-        RampedThrottleSpeed += ThrottleRampStep;
+    if (SkipNum < 1) SkipNum = 1;                               // A skip num of 0 steps on every update, same as 1
+    
+    First = ((SkipCount + 1) >= SkipNum) ? 1 : (SkipNum - SkipCount);
+    if (Updates < First) 
+    {   // Not enough updates to reach the next step
+        SkipCount += Updates;
+        return 0;
     }
+    
+    Updates -= First;
+    Steps = 1 + (Updates / SkipNum);
+    SkipCount = Updates % SkipNum;
+    return Steps;
 }
 
 // GetDriveSpeed - this is where we pass a user drive command, and return a drive speed. If acceleration/deceleration constraints are disabled, the drive speed will 
@@ -272,8 +217,8 @@ void OP_Driver::OCR3A_ISR()
 // OP Config. On top of that, we can optionally implement refinements to these constraints through the use of presets. Presets represent a discrete set of 
 // rules. For example, one preset might default to the user's acceleration constraint, but if the drive command is very far away from the current drive speed, we 
 // accelerate a bit faster - and then, when the actual drive speed approaches the command, we accelerate a bit slower than default. As discussed above, acceleration/deceleration
-// speed can be maninpulated by changing either the number of interrupts to skip between drive speed updates (interrupts occur 256 times a second but you don't have to update on each one),
-// or by changing the amount or "step" change that occurs on an interrupt. 
+// speed can be maninpulated by changing either the number of updates to skip between drive speed changes (updates occur 256 times a second but you don't have to change speed on each one),
+// or by changing the amount or "step" change that occurs on an update. 
 
 // Hopefully the community will develop some interesting presets within this framework.  
 
@@ -297,7 +242,8 @@ boolean neg;
     // Second, we start off by setting final DriveSpeed to DriveCMD to begin with. It may be modified through the process below. 
     t_DriveSpeed = DriveCMD;        
 
-    // Third, we start off with drive ramping disabled. It will be enabled below if appropriate
+    // Third, bring the ramped speeds up to date, then start off with drive ramping disabled. It will be enabled below if appropriate
+    UpdateRamps();
     DriveRampEnabled = false;
 
     // Now, calculate actual drive speed: 
@@ -351,7 +297,7 @@ boolean neg;
                 DriveRampEnabled = true;                            // Enable drive speed ramping 
                 RampDir = 1;                                        // Tells us we are accelerating
                 t_DriveRampStep = DRIVE_RAMP_STEP_DEFAULT;          // Set step to default
-                t_DriveSkipNum = AccelSkipNum;                      // Set interrupts-to-skip number to the user setting 
+                t_DriveSkipNum = AccelSkipNum;                      // Set updates-to-skip number to the user setting 
                 
                 // Now apply any additional drive speed enhancements
                 switch (AccelPreset)
@@ -366,7 +312,7 @@ boolean neg;
                         
                         if (LastDriveSpeed < 20)                    // If we are at extremely low throttle, make more sensitive
                         {
-                            t_DriveRampStep += 2;                   // Rather than change the SkipNum, we could also increase the step taken at each interrupt to increase acceleration,
+                            t_DriveRampStep += 2;                   // Rather than change the SkipNum, we could also increase the step taken at each update to increase acceleration,
                         }                                           // shown here.
                         break;
                     
@@ -392,7 +338,7 @@ boolean neg;
                 DriveRampEnabled = true;                            // Enabled drive speed ramping
                 RampDir = -1;                                       // Tells us we are decelerating
                 t_DriveRampStep = DRIVE_RAMP_STEP_DEFAULT;          // Set step to default to start
-                t_DriveSkipNum = DecelSkipNum;                      // Set interrupts-to-skip number to the user setting 
+                t_DriveSkipNum = DecelSkipNum;                      // Set updates-to-skip number to the user setting 
                 
                 switch (DecelPreset)
                 {
@@ -432,30 +378,24 @@ boolean neg;
     // Save ramp step and frequency
     if (DriveRampEnabled)
     {
-        uint8_t sreg = SREG;                            // Save interrupt register
-        cli();                                          // Disable interrupts
-            DriveRampStep = t_DriveRampStep * RampDir;  // Multiply by RampDir which is 1 or -1 depending on the direction
-            DriveSkipNum = t_DriveSkipNum;              // Number of interrupts to skip before incrementing by DriveRampStep
-            // This next piece may look confusing. If ramping is enabled, we of course want to set t_DriveSpeed equal to 
-            // RampedDriveSpeed. If ramping is enabled, t_DriveSpeed will right now equal ThrottleCMD. If it is some non-zero number that means we 
-            // want to move, but if we are just now starting from a stop, RampedDriveSpeed will still be zero until the next time the interrupt hits. 
-            // Since we do not want to return zero, in this case we set RampedDriveSpeed = to the first DriveRampStep. 
-            // Afterwards, RampedDriveSpeed will be > 0 so this "if" statement will get skipped. 
-            if (t_DriveSpeed > 0 && RampedDriveSpeed == 0) RampedDriveSpeed = DriveRampStep;
-            t_DriveSpeed = RampedDriveSpeed;    
-        SREG = sreg;                                    // Restore register
+        DriveRampStep = t_DriveRampStep * RampDir;      // Multiply by RampDir which is 1 or -1 depending on the direction
+        DriveSkipNum = t_DriveSkipNum;                  // Number of updates to skip before incrementing by DriveRampStep
+        // This next piece may look confusing. If ramping is enabled, we of course want to set t_DriveSpeed equal to 
+        // RampedDriveSpeed. If ramping is enabled, t_DriveSpeed will right now equal ThrottleCMD. If it is some non-zero number that means we 
+        // want to move, but if we are just now starting from a stop, RampedDriveSpeed will still be zero until the next update. 
+        // Since we do not want to return zero, in this case we set RampedDriveSpeed = to the first DriveRampStep. 
+        // Afterwards, RampedDriveSpeed will be > 0 so this "if" statement will get skipped. 
+        if (t_DriveSpeed > 0 && RampedDriveSpeed == 0) RampedDriveSpeed = DriveRampStep;
+        t_DriveSpeed = RampedDriveSpeed;    
     }
     else
     {
         // No ramping - output will be direct DriveCMD
-        uint8_t sreg = SREG;                            // Save interrupt register
-        cli();                                          // Disable interrupts
-            DriveRampStep = 0;                          // No incremental changes
-            RampedDriveSpeed = t_DriveSpeed;            // We also keep RampedDriveSpeed equal to drive speed so when ramping is turned back on, the Ramped value will already be correct to start 
-        SREG = sreg;                                    // Restore register     (^ Remember t_DriveSpeed was set to DriveCMD earlier, but may have been changed to zero if braking or stopped).
-    }
+        DriveRampStep = 0;                              // No incremental changes
+        RampedDriveSpeed = t_DriveSpeed;                // We also keep RampedDriveSpeed equal to drive speed so when ramping is turned back on, the Ramped value will already be correct to start 
+    }                                                   // (^ Remember t_DriveSpeed was set to DriveCMD earlier, but may have been changed to zero if braking or stopped).
 
-    SetRampInterrupt();                                 // This function will make sure the ramp interrupt is enabled if needed, but if not, will turn it off
+    RampsActive = (DriveRampEnabled || ThrottleRampEnabled);    // Ramp updates will only be applied if one of the two is enabled
     
     // Do a sanity check on t_DriveSpeed. 
     // Recall t_DriveSpeed is either DriveCMD (set at the beginning), or RampedDriveSpeed, or possibly 0 if we are braking
@@ -501,14 +441,14 @@ boolean neg;
 // By divorcing the "engine" speed from actual drive speed, we can do simple things like rev the engine without moving the tank, or play a special sound on high acceleration, or 
 // even potentially more sophisticated effects. 
 
-// As with drive speed, we have the option of "ramping" throttle speed using similar parameters. The same 256 Hz interrupt is used, and we can set the amount the throttle speed
-// changes each time (ThrottleRampStep), or how many interrupts most occur before an increment is allowed (ThrottleSkipNum). Of course, throttle speed could also be set directly
+// As with drive speed, we have the option of "ramping" throttle speed using similar parameters. The same 256 Hz updates are used, and we can set the amount the throttle speed
+// changes each time (ThrottleRampStep), or how many updates must occur before an increment is allowed (ThrottleSkipNum). Of course, throttle speed could also be set directly
 // instead of ramped. 
 
 // For now, all we do here is try to prevent the throttle sound from stopping suddenly. 
 int OP_Driver::GetThrottleSpeed(int ThrottleCMD, int LastThrottleSpeed, int DriveSpeed, _driveModes DriveMode, boolean Brake)
 {
-    int8_t t_ThrottleSkipNum = 0;           // Temporary number of interrupts to skip before incrementing throttle speed. Initialize to zero, but it needs to be set to something else below (if ramping is used). 
+    int8_t t_ThrottleSkipNum = 0;           // Temporary number of updates to skip before incrementing throttle speed. Initialize to zero, but it needs to be set to something else below (if ramping is used). 
     int8_t t_ThrottleRampStep = 0;          // Temporary ThrottleRampStep value
     int8_t RampDir = 1;                     // Is the ramping going up or down
     int16_t t_ThrottleSpeed = 0;            // Temp throttle speed
@@ -522,7 +462,8 @@ int OP_Driver::GetThrottleSpeed(int ThrottleCMD, int LastThrottleSpeed, int Driv
     // Second, we start by initializing final throttle speed to the throttle command speed (essentially the throttle stick position), but this may change by the end of the routine
     t_ThrottleSpeed = ThrottleCMD;          
 
-    // Third, we start off with throttle ramping disabled. It will be enabled below if appropriate
+    // Third, bring the ramped speeds up to date, then start off with throttle ramping disabled. It will be enabled below if appropriate
+    UpdateRamps();
     ThrottleRampEnabled = false;
 
     // Now, calculate actual throttle speed: 
@@ -548,7 +489,7 @@ int OP_Driver::GetThrottleSpeed(int ThrottleCMD, int LastThrottleSpeed, int Driv
         // To ease it back to idle, we use ramping. 
         ThrottleRampEnabled = true;                         // Enable throttle ramping
         RampDir = -1;                                       // Tells us we are decelerating
-        t_ThrottleRampStep = DRIVE_RAMP_STEP_DEFAULT;       // Set step to default (2 steps per active interrupt)
+        t_ThrottleRampStep = DRIVE_RAMP_STEP_DEFAULT;       // Set step to default (2 steps per active update)
         
         // This is just hard-coded for now. 
         // Combined these two statements result in an engine that takes ~1.2 seconds to return to idle from full speed
@@ -592,24 +533,18 @@ int OP_Driver::GetThrottleSpeed(int ThrottleCMD, int LastThrottleSpeed, int Driv
     // Save ramp step 
     if (ThrottleRampEnabled) 
     {   
-        uint8_t sreg = SREG;                        // Save interrupt register
-        cli();                                      // Disable interrupts
-            ThrottleRampStep = t_ThrottleRampStep * RampDir;    // Multiply by RampDir which is 1 or -1 depending on the direction
-            ThrottleSkipNum = t_ThrottleSkipNum;    // Number of interrupts to skip before incrementing by ThrottleRampStep
-            t_ThrottleSpeed = RampedThrottleSpeed;  // We take the ramped value, actually from last update. 
-        SREG = sreg;                                // Restore register
+        ThrottleRampStep = t_ThrottleRampStep * RampDir;    // Multiply by RampDir which is 1 or -1 depending on the direction
+        ThrottleSkipNum = t_ThrottleSkipNum;        // Number of updates to skip before incrementing by ThrottleRampStep
+        t_ThrottleSpeed = RampedThrottleSpeed;      // We take the ramped value, actually from last update. 
     }
     else
     {
         // No ramping - output will be direct ThrottleCMD
-        uint8_t sreg = SREG;                        // Save interrupt register
-        cli();                                      // Disable interrupts
-            ThrottleRampStep = 0;                   // No incremental changes
-            RampedThrottleSpeed = t_ThrottleSpeed;  // We also keep RampedThrottleSpeed equal to throttle so when ramping is turned back on, the Ramped value will already be correct to start 
-        SREG = sreg;                                // Restore register     
+        ThrottleRampStep = 0;                       // No incremental changes
+        RampedThrottleSpeed = t_ThrottleSpeed;      // We also keep RampedThrottleSpeed equal to throttle so when ramping is turned back on, the Ramped value will already be correct to start 
     }
 
-    SetRampInterrupt();                             // This function will make sure the ramp interrupt is enabled if needed, but if not, will turn it off
+    RampsActive = (DriveRampEnabled || ThrottleRampEnabled);    // Ramp updates will only be applied if one of the two is enabled
 
     // Do a sanity check on t_ThrottleSpeed. 
     // Recall t_ThrottleSpeed is either ThrottleCMD (set at the beginning), or RampedThrottleSpeed, or possibly 0 if we are braking
@@ -887,15 +822,13 @@ void OP_Driver::MixSteering(int DriveSpeed, int TurnAmount, int *RightSpeed, int
 uint16_t        OP_Engine::EnginePauseTime;         // How long to wait before engine can change state, in milliseconds (1000 mS = 1 second)
 boolean         OP_Engine::EngineRunning;
 boolean         OP_Engine::_debug;
-HardwareSerial *OP_Engine::_debugSerial;
 uint32_t        OP_Engine::EngineTimerStartTime;
 boolean         OP_Engine::EngineTimerComplete;
 
-void OP_Engine::begin(uint16_t howLong, boolean debug, HardwareSerial * debugSerial)
+void OP_Engine::begin(uint16_t howLong, boolean debug)
 {
     OP_Engine::EnginePauseTime = howLong;       
     OP_Engine::_debug = debug;
-    OP_Engine::_debugSerial = debugSerial;
     EngineRunning = false;          // Initialize to engine off
     EngineTimerComplete = true;     // Initialize timer complete
 }
@@ -932,7 +865,7 @@ boolean OP_Engine::StartEngine()
         EngineRunning = true;                   // Change state to running
         EngineTimerComplete = false;            // Reset engine timer
         StartEngineTimer();
-        if (_debug) { _debugSerial->println(F("Turn Engine On")); }
+        if (_debug) { OP_Log::write(LOG_ENGINE_ON); }
         return true;
     }
     else
@@ -949,7 +882,7 @@ void OP_Engine::StopEngine()
         EngineRunning = false;                  // Change state to stopped
         EngineTimerComplete = false;            // Reset engine timer
         StartEngineTimer();
-        if (_debug) { _debugSerial->println(F("Turn Engine Off")); }
+        if (_debug) { OP_Log::write(LOG_ENGINE_OFF); }
     }
 }
 
@@ -974,15 +907,13 @@ void OP_Engine::UpdateTimer()
 uint16_t        OP_Transmission::TransmissionPauseTime;         // How long to wait before transmission can change state, in milliseconds (1000 mS = 1 second)
 boolean         OP_Transmission::TransmissionEngaged;
 boolean         OP_Transmission::_debug;
-HardwareSerial *OP_Transmission::_debugSerial;
 uint32_t        OP_Transmission::TransmissionTimerStartTime;
 boolean         OP_Transmission::TransmissionTimerComplete;     
 
-void OP_Transmission::begin(boolean debug, HardwareSerial *debugSerial)
+void OP_Transmission::begin(boolean debug)
 {
     OP_Transmission::TransmissionPauseTime = 100;       // HARD-CODED TO 1/10th of a SECOND. This is the minimum amount of time that must transpire between transmission state changes.
     OP_Transmission::_debug = debug;                    // ^ This delay is probably unnecessary and it would save code & RAM space to get rid of the TransmissionTimer entirely.
-    OP_Transmission::_debugSerial = debugSerial;
     TransmissionEngaged = false;                        // Initialize to transmission disengaged off
     TransmissionTimerComplete = true;                   // Initialize timer complete
 }
@@ -1020,7 +951,7 @@ void OP_Transmission::PutInGear()
         TransmissionEngaged = true;                         // Change state to engaged
         TransmissionTimerComplete = false;                  // Reset transmission timer
         StartTransmissionTimer();
-        if (_debug) { _debugSerial->println(F("Engage Transmission")); }
+        if (_debug) { OP_Log::write(LOG_TRANSMISSION_ENGAGE); }
     }
 }
 
@@ -1032,7 +963,7 @@ void OP_Transmission::PutInNeutral()
         TransmissionEngaged = false;                        // Change state to disengaged
         TransmissionTimerComplete = false;                  // Reset transmission timer
         StartTransmissionTimer();
-        if (_debug) { _debugSerial->println(F("Disengage Transmission")); }
+        if (_debug) { OP_Log::write(LOG_TRANSMISSION_DISENGAGE); }
     }
 }
 
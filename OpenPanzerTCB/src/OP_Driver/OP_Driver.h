@@ -24,6 +24,7 @@
 #include <Arduino.h>
 #include "../OP_Settings/OP_Settings.h"
 #include "../OP_Motors/OP_Motors.h"
+#include "../OP_Log/OP_Log.h"
                                                    
 
 typedef char DRIVETYPE;
@@ -60,9 +61,13 @@ typedef char DECEL_DRIVE_PRESET;
 
 #define NUM_TURN_MODES          3   // How many turn modes are configured
 
-#define MAX_SKIP_NUM            14  // At our default ramp step of 2, and with 256 updates per second, if we only increment drive speed every 14th interrupt
+#define MAX_SKIP_NUM            14  // At our default ramp step of 2, and with 256 updates per second, if we only increment drive speed every 14th update
                                     // it will take 7 seconds to go from a complete stop to full speed (or vice versa). That is quite slow enough. 
 
+#define RAMP_UPDATE_uS          3920    // Length of one ramp update in microseconds (just over 1/256 of a second). This is the period the old Timer 3 
+                                        // interrupt ran at (245 counts of 16 uS), so ramps take the same time they always have. 
+#define RAMP_MAX_UPDATES        1000    // If we haven't been called in a long time (some blocking routine) don't make up more than ~4 seconds worth of updates
+
 #define DRIVE_RAMP_STEP_DEFAULT 2   // These are defaults, but they may be modified dynamically by the code or driving-preset algorithms. 
 #define ACCEL_RAMP_STEP_DEFAULT 2   // They are not user-configurable in the desktop program. Instead, the user sets the frequency 
 #define DECEL_RAMP_STEP_DEFAULT 2   // that drive speed increments are made. 
@@ -80,13 +85,9 @@ class OP_Driver
 public:
     OP_Driver(void);
 
-    // Also configures timer3
     static void begin(DRIVETYPE, uint8_t, boolean);         // Variables are: Drive type, Turn mode, Neutral turn allowed
     static void setDrivingProfileSettings(boolean, boolean, ACCEL_DRIVE_PRESET, DECEL_DRIVE_PRESET, uint8_t, uint8_t); // Variables are: accel ramp enabled, decel ramp enabled, accel preset, decel preset, accel skip num, decel skip num
     
-    // called by the timer interrupt service routine, see the cpp file for details.
-    static void OCR3A_ISR(void);                            // The ISR simply adjusts RampedDriveSpeed/RampedThrottleSpeed by +/- Step
-    
     static boolean GetBrakeFlag(_driveModes, _driveModes);  // Are we braking? Pass previous drive mode and current drive mode command
     static _driveModes GetDriveMode(int, int);              // Returns the drive mode from Throttle and Turn commands
     
@@ -109,32 +110,33 @@ public:
                                                             // (int DriveSpeed, int TurnAmount, int *RightSpeed, int *LeftSpeed)
 
 protected:  
-    // Interrupts
-    static void SetRampInterrupt(void);         // This determines if the interrupt can be turned off or needs to be left on
-    static void DisableRampInterrupt(void);     // Disables interrupt
-    static void EnableRampInterrupt(void);      // Enables interrupt
+    // Ramp updates
+    static void UpdateRamps(void);              // Applies however many ramp updates have come due since the last time we were called
+    static uint16_t CountSteps(int8_t, int8_t &, uint16_t);  // How many steps a ramp takes in some number of updates, given its skip number and skip count
+    static uint32_t LastRampTime;               // micros() time the last ramp update came due
+    static boolean RampsActive;                 // Was either ramp enabled after the last call to GetDriveSpeed/GetThrottleSpeed
 
     // Driving 
     static uint8_t DriveType;                   // Tank, halftrack, car
     
     // Drive speed ramping
     static boolean DriveRampEnabled;            // Is ramping enabled for drive speed
-    static volatile uint16_t RampedDriveSpeed;  // DRIVE speed constrained to ramping
-    static volatile int8_t DriveRampStep;       // How much is drive speed changing each interrupt (step)
-    static volatile int8_t DriveSkipNum;        // How many interrupts to skip before incrementing speed
-    static volatile int8_t DriveSkipCount;      // Running count of interrupts skipped
+    static uint16_t RampedDriveSpeed;           // DRIVE speed constrained to ramping
+    static int8_t DriveRampStep;                // How much is drive speed changing each update (step)
+    static int8_t DriveSkipNum;                 // How many updates to skip before incrementing speed
+    static int8_t DriveSkipCount;               // Running count of updates skipped
     
     // Throttle speed ramping
     static boolean ThrottleRampEnabled;         // Is ramping enabled for throttle speed
-    static volatile int16_t RampedThrottleSpeed;// THROTTLE speed constrained to ramping
-    static volatile int8_t ThrottleRampStep;    // How much is throttle speed changing each interrupt (step)
-    static volatile int8_t ThrottleSkipNum;     // How many interrupts to skip before incrementing speed
-    static volatile int8_t ThrottleSkipCount;   // Running count of interrupts skipped      
+    static int16_t RampedThrottleSpeed;         // THROTTLE speed constrained to ramping
+    static int8_t ThrottleRampStep;             // How much is throttle speed changing each update (step)
+    static int8_t ThrottleSkipNum;              // How many updates to skip before incrementing speed
+    static int8_t ThrottleSkipCount;            // Running count of updates skipped      
 
     // User settings
     static boolean AccelRampEnabled;            // Should we ramp drive speed on acceleration? (Enforce inertial constraints)
     static boolean DecelRampEnabled;            // Should we ramp drive speed on deceleration? (Enforce momentum constraints)
-    static uint8_t AccelSkipNum;                // What "level" should the constraint be - but this actually translates literally into the number of interrupts to skip
+    static uint8_t AccelSkipNum;                // What "level" should the constraint be - but this actually translates literally into the number of updates to skip
     static uint8_t DecelSkipNum;                // " "
     static ACCEL_DRIVE_PRESET AccelPreset;      // Has the user selected an acceleration preset algorithm
     static DECEL_DRIVE_PRESET DecelPreset;      // " "
@@ -153,7 +155,7 @@ protected:
 class OP_Engine
 {
 public:
-    static void    begin(uint16_t, boolean, HardwareSerial *);  // Pass the engine pause time to the object, and whether or not we want debugging messages along with the debug port
+    static void    begin(uint16_t, boolean);    // Pass the engine pause time to the object, and whether or not we want debugging messages
     static boolean Running(void);               // Returns engine running state
     static boolean StartEngine(void);           // Try to start the engine, returns true if engine started
     static void    StopEngine(void);
@@ -166,8 +168,7 @@ private:
     static boolean  EngineRunning;
     static void StartEngineTimer(void);         // If these are not declared static they can't be used without first creating an object
     static void ClearEngineTimer(void);         // But we want the class to use them internally, so set them to static. 
-    static boolean _debug;                      // If true, send debug messages out the serial port
-    static HardwareSerial *_debugSerial;        // The debugging serial port to use 
+    static boolean _debug;                      // If true, log debug messages
 };
 
 
@@ -175,7 +176,7 @@ private:
 class OP_Transmission
 {
 public:
-    static void    begin(boolean, HardwareSerial *); // Variables passed are the  debug flag and a pointer to the debug Serial port
+    static void    begin(boolean);              // Variable passed is the debug flag
     static boolean Engaged(void);               // Returns transmission state
     static void    PutInGear(void);             // Engage transmission
     static void    PutInNeutral(void);          // Disengage transmission
@@ -188,8 +189,7 @@ private:
     static boolean TransmissionEngaged;
     static void StartTransmissionTimer(void);   // If these are not declared static they can't be used without first creating an object
     static void ClearTransmissionTimer(void);   // But we want the class to use them internally, so set them to static. 
-    static boolean _debug;                      // If true, send debug messages out the serial port
-    static HardwareSerial *_debugSerial;        // The debugging serial port to use
+    static boolean _debug;                      // If true, log debug messages
 };
 
 #endif
@@ -22,7 +22,7 @@
 
 
 // Static variables must be declared outside the class
-    _eeprom_data OP_EEPROM::ramcopy;
+    _eeprom_hot OP_EEPROM::ramcopy;
 
 
 //------------------------------------------------------------------------------------------------------------------------>>
@@ -50,10 +50,21 @@ boolean OP_EEPROM::begin(void)
 
 }
 
-// This takes all variables from the eeprom struct, and puts them into the RAM copy struct
+// Where each ramcopy variable lives in EEPROM and in RAM
+#define EEPROM_HOT_MAP(var)     { offsetof(_eeprom_data, var), offsetof(_eeprom_hot, var), sizeof(((_eeprom_hot *)0)->var) },
+const _hot_var_map HotVarMap[] PROGMEM = { EEPROM_HOT_VARS(EEPROM_HOT_MAP) };
+#undef EEPROM_HOT_MAP
+
+// This takes the ramcopy variables from the eeprom struct, and puts them into the RAM copy struct
 void OP_EEPROM::loadRAMcopy(void)
 {
-    EEPROM.readBlock(EEPROM_START_ADDRESS, ramcopy);
+    _hot_var_map hvm;
+    
+    for (uint8_t i=0; i<(sizeof(HotVarMap) / sizeof(_hot_var_map)); i++)
+    {
+        memcpy_P(&hvm, &HotVarMap[i], sizeof(_hot_var_map));
+        eeprom_read_block((uint8_t *)&ramcopy + hvm.ramOffset, (const void *)(EEPROM_START_ADDRESS + hvm.eepromOffset), hvm.size);
+    }
 }
     
 
@@ -346,19 +357,23 @@ void OP_EEPROM::factoryReset(void)
 
 void OP_EEPROM::Initialize_EEPROM(void) 
 {   
-    // The way we do this is set the values in our ramcopy struct, then write the entire struct to EEPROM (actually "update" instead of "write")
-    Initialize_RAMcopy();                               // Set RAM variables to sensible defaults
-    ramcopy.InitStamp = EEPROM_INIT;                    // Set the InitStamp
-    EEPROM.updateBlock(EEPROM_START_ADDRESS, ramcopy);  // Now write it all to EEPROM. We use the "update" function so as not to 
+    // The way we do this is set the values in a temporary copy of the complete struct, then write the entire struct to EEPROM (actually "update" instead of "write").
+    // The temporary struct lives on the stack, this only happens at startup so there is plenty of room for it. 
+    _eeprom_data defaults;
+    memset(&defaults, 0, sizeof(_eeprom_data));         // Anything not given a default below will be zero
+    Initialize_Defaults(defaults);                      // Set variables to sensible defaults
+    defaults.InitStamp = EEPROM_INIT;                  // Set the InitStamp
+    EEPROM.updateBlock(EEPROM_START_ADDRESS, defaults); // Now write it all to EEPROM. We use the "update" function so as not to 
                                                         // unnecessarily writebytes that haven't changed. 
+    loadRAMcopy();                                      // And finally load the ramcopy from the freshly written EEPROM
 }
 
 // THIS IS WHERE EEPROM DEFAULT VALUES ARE SET
-void OP_EEPROM::Initialize_RAMcopy(void) 
+void OP_EEPROM::Initialize_Defaults(_eeprom_data &defaults) 
 {   // If EEPROM has not been used before, we initialize to some sensible, yet conservative, default values.
     
     // FirstVar
-        ramcopy.FirstVar = 0;                           // Don't mess with this one
+        defaults.FirstVar = 0;                          // Don't mess with this one
     
     // Write 4 channel settings. 
         stick_channel_settings DefaultChSettings;
@@ -367,194 +382,203 @@ void OP_EEPROM::Initialize_RAMcopy(void)
         DefaultChSettings.pulseCenter = 1500;
         DefaultChSettings.deadband = DEFAULT_DEADBAND;  // Setting in OP_Radio.h
         DefaultChSettings.reversed = false;             // Default to not reversed
+        DefaultChSettings.jitterBand = DEFAULT_JITTERBAND;  // Setting in OP_RadioDefines.h
+        DefaultChSettings.medianFilter = false;         // Median filter adds a frame of delay, so default to off for the sticks
         
         //We assume Radio has channel order RETA (2/4/3/1), but the user can change this in the menu
         DefaultChSettings.channelNum = 2;
-        ramcopy.ThrottleSettings = DefaultChSettings;
+        defaults.ThrottleSettings = DefaultChSettings;
         
         DefaultChSettings.channelNum = 4;
-        ramcopy.TurnSettings = DefaultChSettings;
+        defaults.TurnSettings = DefaultChSettings;
         
         DefaultChSettings.channelNum = 3;
-        ramcopy.ElevationSettings = DefaultChSettings;
+        defaults.ElevationSettings = DefaultChSettings;
         
         DefaultChSettings.channelNum = 1;
-        ramcopy.AzimuthSettings = DefaultChSettings;
+        defaults.AzimuthSettings = DefaultChSettings;
 
     // Write aux channel settings. Default to digital inputs, 2-position switch, not reversed. 
     // channel order in the PPM stream of 5,6,7,8,9,10,etc..
         uint8_t firstChanNum = 5;
         for (int a=0; a<AUXCHANNELS; a++)
         {
-            ramcopy.Aux_ChannelSettings[a].channelNum = firstChanNum + a;
-            ramcopy.Aux_ChannelSettings[a].pulseMin = 1000;
-            ramcopy.Aux_ChannelSettings[a].pulseMax = 2000;
-            ramcopy.Aux_ChannelSettings[a].pulseCenter = 1500;
-            ramcopy.Aux_ChannelSettings[a].Digital = true;
-            ramcopy.Aux_ChannelSettings[a].numPositions = 2;
-            ramcopy.Aux_ChannelSettings[a].reversed = false;
+            defaults.Aux_ChannelSettings[a].channelNum = firstChanNum + a;
+            defaults.Aux_ChannelSettings[a].pulseMin = 1000;
+            defaults.Aux_ChannelSettings[a].pulseMax = 2000;
+            defaults.Aux_ChannelSettings[a].pulseCenter = 1500;
+            defaults.Aux_ChannelSettings[a].Digital = true;
+            defaults.Aux_ChannelSettings[a].numPositions = 2;
+            defaults.Aux_ChannelSettings[a].reversed = false;
+            defaults.Aux_ChannelSettings[a].jitterBand = DEFAULT_JITTERBAND;
+            defaults.Aux_ChannelSettings[a].medianFilter = true;   // A frame of delay doesn't matter on a switch or knob
         }
     
     // External I/O ports
-        ramcopy.PortA_Settings.dataDirection = 0;   // input
-        ramcopy.PortA_Settings.dataType = 1;        // Assume digital input (on/off only)
-        ramcopy.PortB_Settings.dataDirection = 0;   // input
-        ramcopy.PortB_Settings.dataType = 1;        // Assume digital input (on/off only)
+        defaults.PortA_Settings.dataDirection = 0;  // input
+        defaults.PortA_Settings.dataType = 1;       // Assume digital input (on/off only)
+        defaults.PortB_Settings.dataDirection = 0;  // input
+        defaults.PortB_Settings.dataType = 1;       // Assume digital input (on/off only)
 
     // Special function triggers - We init a few common ones to the turret stick (nothing on aux channels)
     // The SF_ numbers are defined in OP_Radio.h
         // First, let's clear all 
         for (int i=0; i<MAX_FUNCTION_TRIGGERS; i++)
         {
-            ramcopy.SF_Trigger[i].TriggerID = 0;
-            ramcopy.SF_Trigger[i].specialFunction = SF_NULL_FUNCTION;
+            defaults.SF_Trigger[i].TriggerID = 0;
+            defaults.SF_Trigger[i].specialFunction = SF_NULL_FUNCTION;
         }   
         // Now, we just set the few we want to default to
-        ramcopy.SF_Trigger[0].TriggerID = TL;
-        ramcopy.SF_Trigger[0].specialFunction = SF_ENGINE_TOGGLE;
-        ramcopy.SF_Trigger[1].TriggerID = BL;
-        ramcopy.SF_Trigger[1].specialFunction = SF_TRANS_TOGGLE;
-        ramcopy.SF_Trigger[2].TriggerID = TR;
-        ramcopy.SF_Trigger[2].specialFunction = SF_CANNON_FIRE;
-        ramcopy.SF_Trigger[3].TriggerID = BR;
-        ramcopy.SF_Trigger[3].specialFunction = SF_LIGHT1_TOGGLE;
+        defaults.SF_Trigger[0].TriggerID = TL;
+        defaults.SF_Trigger[0].specialFunction = SF_ENGINE_TOGGLE;
+        defaults.SF_Trigger[1].TriggerID = BL;
+        defaults.SF_Trigger[1].specialFunction = SF_TRANS_TOGGLE;
+        defaults.SF_Trigger[2].TriggerID = TR;
+        defaults.SF_Trigger[2].specialFunction = SF_CANNON_FIRE;
+        defaults.SF_Trigger[3].TriggerID = BR;
+        defaults.SF_Trigger[3].specialFunction = SF_LIGHT1_TOGGLE;
         
     // 4 main motor drive types. We default motors to the OP Scout ESC and turret to onboard
-        ramcopy.DriveMotors = OP_SCOUT;
-        ramcopy.TurretRotationMotor = ONBOARD;
-        ramcopy.TurretElevationMotor = ONBOARD;
+        defaults.DriveMotors = OP_SCOUT;
+        defaults.TurretRotationMotor = ONBOARD;
+        defaults.TurretElevationMotor = ONBOARD;
+
+    // Closed-loop track speed. Nothing uses these unless the IO ports are set to encoder inputs. 
+        defaults.EncoderFullSpeedCPS = DEFAULT_ENCODER_FULLSPEED_CPS;
+        defaults.SpeedLoop_Kp = DEFAULT_SPEED_LOOP_KP;
+        defaults.SpeedLoop_Ki = DEFAULT_SPEED_LOOP_KI;
 
     // Elevation motor min/max/reversed
-        ramcopy.TurretElevation_EPMin = 1000;
-        ramcopy.TurretElevation_EPMax = 2000;
-        ramcopy.TurretElevation_Reversed = false;
-        ramcopy.TurretElevation_MaxSpeedPct = 100;
-        ramcopy.TurretRotation_MaxSpeedPct = 100;
-        ramcopy.TurretRotation_EPMin = 1000;
-        ramcopy.TurretRotation_EPMax = 2000;
-        ramcopy.TurretRotation_Reversed = false;
+        defaults.TurretElevation_EPMin = 1000;
+        defaults.TurretElevation_EPMax = 2000;
+        defaults.TurretElevation_Reversed = false;
+        defaults.TurretElevation_MaxSpeedPct = 100;
+        defaults.TurretRotation_MaxSpeedPct = 100;
+        defaults.TurretRotation_EPMin = 1000;
+        defaults.TurretRotation_EPMax = 2000;
+        defaults.TurretRotation_Reversed = false;
 
     // Mechanical Barrel and Recoil Servo settings
-        ramcopy.Airsoft = true;
-        ramcopy.MechanicalBarrelWithCannon = true;
-        ramcopy.RecoilDelay = 0;                // Default to no delay between recoil action, and flash/sound
-        ramcopy.RecoilReversed = true;          // We default to reversed because this works with the Taigen Tiger 1 combination airsoft/servo recoil unit
-        ramcopy.ServoRecoilWithCannon = true;
-        ramcopy.RecoilServo_Recoil_mS = 200;    // These default times work well with the Taigen Tiger 1 unit
-        ramcopy.RecoilServo_Return_mS = 800;
-        ramcopy.RecoilServo_EPMin = 1000;
-        ramcopy.RecoilServo_EPMax = 2000;
+        defaults.Airsoft = true;
+        defaults.MechanicalBarrelWithCannon = true;
+        defaults.RecoilDelay = 0;               // Default to no delay between recoil action, and flash/sound
+        defaults.RecoilReversed = true;         // We default to reversed because this works with the Taigen Tiger 1 combination airsoft/servo recoil unit
+        defaults.ServoRecoilWithCannon = true;
+        defaults.RecoilServo_Recoil_mS = 200;   // These default times work well with the Taigen Tiger 1 unit
+        defaults.RecoilServo_Return_mS = 800;
+        defaults.RecoilServo_EPMin = 1000;
+        defaults.RecoilServo_EPMax = 2000;
 
     // On board smoker output
-        ramcopy.SmokerControlAuto = true;
-        ramcopy.SmokerIdleSpeed = 89;           // 35 percent
-        ramcopy.SmokerFastIdleSpeed = 128;      // 50 percent
-        ramcopy.SmokerMaxSpeed = 255;           // 100 percent
-        ramcopy.SmokerDestroyedSpeed = 255;     // 100 percent
+        defaults.SmokerControlAuto = true;
+        defaults.SmokerIdleSpeed = 89;          // 35 percent
+        defaults.SmokerFastIdleSpeed = 128;     // 50 percent
+        defaults.SmokerMaxSpeed = 255;          // 100 percent
+        defaults.SmokerDestroyedSpeed = 255;    // 100 percent
 
     // Driving adjustments
-        ramcopy.AccelRampEnabled_1 = true;      // Profile 1 settings - mild
-        ramcopy.AccelSkipNum_1 = 4;
-        ramcopy.AccelPreset_1 = 0;
-        ramcopy.DecelRampEnabled_1 = true;
-        ramcopy.DecelSkipNum_1 = 4;
-        ramcopy.DecelPreset_1 = 0;
-        ramcopy.AccelRampEnabled_2 = false;     // Profile 2 settings - nothing
-        ramcopy.AccelSkipNum_2 = 1;
-        ramcopy.AccelPreset_2 = 0;
-        ramcopy.DecelRampEnabled_2 = false;
-        ramcopy.DecelSkipNum_2 = 1;
-        ramcopy.DecelPreset_2 = 0;          
-        ramcopy.BrakeSensitivityPct = 40;       // NOT PRESENTLY IMPLEMENTED
-        ramcopy.TimeToShift_mS = 1000;          // Default to 1 second
-        ramcopy.EnginePauseTime_mS = 1000;      // Default to 1 second
-        ramcopy.TransmissionDelay_mS =2000;     // Default to 2 seconds
-        ramcopy.NeutralTurnAllowed = true;
-        ramcopy.NeutralTurnPct = 50;            // Default to 50 percent of max forward speed for neutral turn max speed
-        ramcopy.TurnMode = 2;                   // Default Turn Mode = 2. See MixSteering function in OP_Driver.cpp for specific mode definitions. 
-        ramcopy.DriveType = DT_TANK;            // Default to Tank
-        ramcopy.MaxForwardSpeedPct = 100;       // Default to 100 percent
-        ramcopy.MaxReverseSpeedPct = 70;        // Default to 70 percent
-        ramcopy.HalftrackTreadTurnPct = 50;     // Default to 50 pct turn command applied to halftrack treads (in halftrack mode)
-        ramcopy.EngineAutoStart = false;        // Default to engine start with trigger instead of throttle. 
-        ramcopy.EngineAutoStopTime_mS = 0;      // Default to auto-stop disabled (time = 0)
-        ramcopy.MotorNudgePct = 0;              // Default to disabled (when 0, nudge effect disabled)
-        ramcopy.NudgeTime_mS = 250;             // Default to 1/4 second
-        ramcopy.DragInnerTrack = false;         // Default to false (off)
+        defaults.AccelRampEnabled_1 = true;     // Profile 1 settings - mild
+        defaults.AccelSkipNum_1 = 4;
+        defaults.AccelPreset_1 = 0;
+        defaults.DecelRampEnabled_1 = true;
+        defaults.DecelSkipNum_1 = 4;
+        defaults.DecelPreset_1 = 0;
+        defaults.AccelRampEnabled_2 = false;    // Profile 2 settings - nothing
+        defaults.AccelSkipNum_2 = 1;
+        defaults.AccelPreset_2 = 0;
+        defaults.DecelRampEnabled_2 = false;
+        defaults.DecelSkipNum_2 = 1;
+        defaults.DecelPreset_2 = 0;          
+        defaults.BrakeSensitivityPct = 40;      // NOT PRESENTLY IMPLEMENTED
+        defaults.TimeToShift_mS = 1000;         // Default to 1 second
+        defaults.EnginePauseTime_mS = 1000;     // Default to 1 second
+        defaults.TransmissionDelay_mS =2000;    // Default to 2 seconds
+        defaults.NeutralTurnAllowed = true;
+        defaults.NeutralTurnPct = 50;           // Default to 50 percent of max forward speed for neutral turn max speed
+        defaults.TurnMode = 2;                  // Default Turn Mode = 2. See MixSteering function in OP_Driver.cpp for specific mode definitions. 
+        defaults.DriveType = DT_TANK;           // Default to Tank
+        defaults.MaxForwardSpeedPct = 100;      // Default to 100 percent
+        defaults.MaxReverseSpeedPct = 70;       // Default to 70 percent
+        defaults.HalftrackTreadTurnPct = 50;    // Default to 50 pct turn command applied to halftrack treads (in halftrack mode)
+        defaults.EngineAutoStart = false;       // Default to engine start with trigger instead of throttle. 
+        defaults.EngineAutoStopTime_mS = 0;     // Default to auto-stop disabled (time = 0)
+        defaults.MotorNudgePct = 0;             // Default to disabled (when 0, nudge effect disabled)
+        defaults.NudgeTime_mS = 250;            // Default to 1/4 second
+        defaults.DragInnerTrack = false;        // Default to false (off)
 
     // "Physics"
-        ramcopy.EnableBarrelStabilize = false;  // If an accelerometer is present, and turret elevation motor is type SERVO_PAN, this will stabilize the barrel
-        ramcopy.BarrelSensitivity = 50;         // Sensitivity number from 1 - 100
-        ramcopy.EnableHillPhysics = false;      // If an accelerometer is present, this will cause the tank to slow down on uphill climbs, and speed up on downhill. 
-        ramcopy.HillSensitivity = 50;           // Sensitivity number from 1 - 100
+        defaults.EnableBarrelStabilize = false; // If an accelerometer is present, and turret elevation motor is type SERVO_PAN, this will stabilize the barrel
+        defaults.BarrelSensitivity = 50;        // Sensitivity number from 1 - 100
+        defaults.EnableHillPhysics = false;     // If an accelerometer is present, this will cause the tank to slow down on uphill climbs, and speed up on downhill. 
+        defaults.HillSensitivity = 50;          // Sensitivity number from 1 - 100
 
     // Turret stick adjustments
-        ramcopy.IgnoreTurretDelay_mS = 350;     // Turret stick delay defaults to 350ms
+        defaults.IgnoreTurretDelay_mS = 350;    // Turret stick delay defaults to 350ms
         
     // Sound settings
-        ramcopy.SoundDevice = SD_BENEDINI_TBSMINI;  
-        ramcopy.Squeak1_MinInterval_mS = 1500;
-        ramcopy.Squeak1_MaxInterval_mS = 4000;
-        ramcopy.Squeak2_MinInterval_mS = 2000;
-        ramcopy.Squeak2_MaxInterval_mS = 5000;
-        ramcopy.Squeak3_MinInterval_mS = 3000;
-        ramcopy.Squeak3_MaxInterval_mS = 8000;
-        ramcopy.Squeak1_Enabled = false;
-        ramcopy.Squeak2_Enabled = false;
-        ramcopy.Squeak3_Enabled = false;
-        ramcopy.MinSqueakSpeedPct = 25;                 // Percent of full movement before squeaks are activated (if squeaks are even enabled)
-        ramcopy.HeadlightSound_Enabled = true;
-        ramcopy.TurretSound_Enabled = true;
-        ramcopy.BarrelSound_Enabled = true;   
-        ramcopy.Squeak4_MinInterval_mS = 1000;
-        ramcopy.Squeak4_MaxInterval_mS = 2000;
-        ramcopy.Squeak5_MinInterval_mS = 3000;
-        ramcopy.Squeak5_MaxInterval_mS = 4000;
-        ramcopy.Squeak6_MinInterval_mS = 5000;
-        ramcopy.Squeak6_MaxInterval_mS = 6000;
-        ramcopy.Squeak4_Enabled = false;       
-        ramcopy.Squeak5_Enabled = false;       
-        ramcopy.Squeak6_Enabled = false;       
+        defaults.SoundDevice = SD_BENEDINI_TBSMINI;  
+        defaults.Squeak1_MinInterval_mS = 1500;
+        defaults.Squeak1_MaxInterval_mS = 4000;
+        defaults.Squeak2_MinInterval_mS = 2000;
+        defaults.Squeak2_MaxInterval_mS = 5000;
+        defaults.Squeak3_MinInterval_mS = 3000;
+        defaults.Squeak3_MaxInterval_mS = 8000;
+        defaults.Squeak1_Enabled = false;
+        defaults.Squeak2_Enabled = false;
+        defaults.Squeak3_Enabled = false;
+        defaults.MinSqueakSpeedPct = 25;                // Percent of full movement before squeaks are activated (if squeaks are even enabled)
+        defaults.HeadlightSound_Enabled = true;
+        defaults.TurretSound_Enabled = true;
+        defaults.BarrelSound_Enabled = true;   
+        defaults.Squeak4_MinInterval_mS = 1000;
+        defaults.Squeak4_MaxInterval_mS = 2000;
+        defaults.Squeak5_MinInterval_mS = 3000;
+        defaults.Squeak5_MaxInterval_mS = 4000;
+        defaults.Squeak6_MinInterval_mS = 5000;
+        defaults.Squeak6_MaxInterval_mS = 6000;
+        defaults.Squeak4_Enabled = false;       
+        defaults.Squeak5_Enabled = false;       
+        defaults.Squeak6_Enabled = false;       
         
     // Battle settings
-        ramcopy.IR_FireProtocol = IR_TAMIYA;            // Default to Tamiya IR battle protocol
-        ramcopy.IR_Team = IR_TEAM_NONE;                 // Default to NO team (default protocol of Tamiya doesn't have teams)
-        ramcopy.IR_HitProtocol_2 = IR_UNKNOWN;          // Default to no second protocol
-        ramcopy.IR_RepairProtocol = IR_RPR_CLARK;       // Default to Clark repair protocol
-        ramcopy.IR_MGProtocol = IR_UNKNOWN;             // Default to no machine gun protocol
-        ramcopy.Use_MG_Protocol = false;                // Default to false
-        ramcopy.Accept_MG_Damage = false;               // Default to false
-        ramcopy.DamageProfile = TAMIYA_DAMAGE;          // Default to stock Tamiya damage profile
-        ramcopy.CustomClassSettings.reloadTime = 1500;  // User custom weight class: Default to Ultralight (1.5 seconds reload time)
-        ramcopy.CustomClassSettings.recoveryTime  = 8000; // User custom weight class: Default to Ultralight (8 seconds invulnerability after recovery)
-        ramcopy.CustomClassSettings.maxHits = 1;        // User custom weight class: Default to Ultralight (1 hit and vehicle destroyed)
-        ramcopy.CustomClassSettings.maxMGHits = 10;     // User custom weight class: Default to 10 hits with MG and vehicle destroyed (only if Accept_MG_Damage = true)
-        ramcopy.SendTankID = false;                     // Default to not sending the tank ID
-        ramcopy.TankID = 1;                             // Tank ID number, default to 1
+        defaults.IR_FireProtocol = IR_TAMIYA;           // Default to Tamiya IR battle protocol
+        defaults.IR_Team = IR_TEAM_NONE;                // Default to NO team (default protocol of Tamiya doesn't have teams)
+        defaults.IR_HitProtocol_2 = IR_UNKNOWN;         // Default to no second protocol
+        defaults.IR_RepairProtocol = IR_RPR_CLARK;      // Default to Clark repair protocol
+        defaults.IR_MGProtocol = IR_UNKNOWN;            // Default to no machine gun protocol
+        defaults.Use_MG_Protocol = false;               // Default to false
+        defaults.Accept_MG_Damage = false;              // Default to false
+        defaults.DamageProfile = TAMIYA_DAMAGE;         // Default to stock Tamiya damage profile
+        defaults.CustomClassSettings.reloadTime = 1500; // User custom weight class: Default to Ultralight (1.5 seconds reload time)
+        defaults.CustomClassSettings.recoveryTime  = 8000; // User custom weight class: Default to Ultralight (8 seconds invulnerability after recovery)
+        defaults.CustomClassSettings.maxHits = 1;       // User custom weight class: Default to Ultralight (1 hit and vehicle destroyed)
+        defaults.CustomClassSettings.maxMGHits = 10;    // User custom weight class: Default to 10 hits with MG and vehicle destroyed (only if Accept_MG_Damage = true)
+        defaults.SendTankID = false;                    // Default to not sending the tank ID
+        defaults.TankID = 1;                            // Tank ID number, default to 1
 
     // Board settings
-        ramcopy.USBSerialBaud = USB_BAUD_RATE;
-        ramcopy.AuxSerialBaud = 115200;                 // Default Aux to 115200
-        ramcopy.MotorSerialBaud = DEFAULTBAUDRATE;
-        ramcopy.Serial3TxBaud = DEFAULTBAUDRATE;
-        ramcopy.LVC_Enabled = false;
-        ramcopy.LVC_Cutoff_mV = 6400;
+        defaults.USBSerialBaud = USB_BAUD_RATE;
+        defaults.AuxSerialBaud = 115200;                // Default Aux to 115200
+        defaults.MotorSerialBaud = DEFAULTBAUDRATE;
+        defaults.Serial3TxBaud = DEFAULTBAUDRATE;
+        defaults.LVC_Enabled = false;
+        defaults.LVC_Cutoff_mV = 6400;
 
     // Light settings
-        ramcopy.RunningLightsAlwaysOn = false;
-        ramcopy.RunningLightsDimLevelPct = 30;          // percent
-        ramcopy.BrakesAutoOnAtStop = false;
-        ramcopy.AuxLightFlashTime_mS = 30;              // 
-        ramcopy.AuxLightBlinkOnTime_mS = 30;            // milliseconds
-        ramcopy.AuxLightBlinkOffTime_mS = 30;           // milliseconds
-        ramcopy.AuxLightPresetDim = 30;                 // percent
-        ramcopy.MGLightBlink_mS = 30;                   // milliseconds
-        ramcopy.FlashLightsWhenSignalLost = true;   
-        ramcopy.HiFlashWithCannon = true;   
-        ramcopy.AuxFlashWithCannon = false;             
+        defaults.RunningLightsAlwaysOn = false;
+        defaults.RunningLightsDimLevelPct = 30;         // percent
+        defaults.BrakesAutoOnAtStop = false;
+        defaults.AuxLightFlashTime_mS = 30;             // 
+        defaults.AuxLightBlinkOnTime_mS = 30;           // milliseconds
+        defaults.AuxLightBlinkOffTime_mS = 30;          // milliseconds
+        defaults.AuxLightPresetDim = 30;                // percent
+        defaults.MGLightBlink_mS = 30;                  // milliseconds
+        defaults.FlashLightsWhenSignalLost = true;   
+        defaults.HiFlashWithCannon = true;   
+        defaults.AuxFlashWithCannon = false;             
 
     // Program settings
-        ramcopy.PrintDebug = true;                      // Default to debugging on
+        defaults.PrintDebug = true;                     // Default to debugging on
 }
 
 
@@ -32,6 +32,7 @@
 #include "../OP_Sound/OP_Sound.h"
 #include "../OP_Motors/OP_Motors.h"
 #include "../OP_Driver/OP_Driver.h"
+#include "../OP_TrackSpeed/OP_TrackSpeed.h"
 #include "../OP_Settings/OP_Settings.h"
 #include "../EEPROMex/EEPROMex.h"   // We use the extended version, not Arduino's built-in EEPROM library. 
 // This one is important. It has the definition of our eeprom struct
@@ -48,7 +49,7 @@
 // In that case EEPROM data corruption WILL occur and the sketch will exhibit unstable behavior!
 // 
 
-    #define EEPROM_INIT             0x41E3          // Modified with 00.92.07 on 7/18/2017
+    #define EEPROM_INIT             0x41E5          // Modified to add the encoder and speed loop settings for closed-loop track speed
 //
 //
 //=======================================================================================================================================>>
@@ -57,6 +58,17 @@
 
 #define EEPROM_START_ADDRESS    0
 
+// Variables that are not kept in the ramcopy (see EEPROM_HOT_VARS in OP_EEPROM_Struct.h) are read straight from EEPROM with this macro. 
+// It works for any member of _eeprom_data and returns a value of the same type, eg:  if (EEPROM_VAR(SoundDevice) == SD_OP_SOUND_CARD) ...
+// Each use is an EEPROM read (roughly 1 uS per byte), which is fine at startup or in a menu but don't use it for something checked every loop. 
+#define EEPROM_VAR(var)         (OP_EEPROM::readVar<__typeof__(((_eeprom_data *)0)->var)>(offsetof(_eeprom_data, var)))
+
+// Used by loadRAMcopy() to copy each ramcopy variable from its position in EEPROM
+struct _hot_var_map {
+    uint16_t eepromOffset;
+    uint16_t ramOffset;
+    uint8_t  size;
+};
 
 
 // Class OP_EEPROM
@@ -68,10 +80,12 @@ class OP_EEPROM
                                                     // next time we'll know it's been done. This prevents us from writing to the EEPROM over and over
                                                     // every time we turn on the Arduino. 
         // Vars
-        static _eeprom_data ramcopy;                // This is the complete eeprom struct that we will store in RAM
+        static _eeprom_hot ramcopy;                 // The subset of the eeprom struct that we keep in RAM
         
         // Functions
-        static void loadRAMcopy(void);              // This will load the eeprom data from eeprom into our ramcopy struct in RAM
+        static void loadRAMcopy(void);              // This will load the ramcopy variables from eeprom into our ramcopy struct in RAM
+        template <class T> static T readVar(uint16_t offset)    // Read any variable directly from EEPROM. Use the EEPROM_VAR() macro rather than calling this
+            { T value; EEPROM.readBlock(offset, value); return value; }
         
         static boolean readSerialEEPROM_byID(uint16_t ID, char * chrArray, uint8_t bufflen, uint8_t &stringlength);
         static boolean updateEEPROM_byID(uint16_t ID, uint32_t Value);      // This will update the variable of "ID" with "Value" in EEPROM
@@ -81,8 +95,8 @@ class OP_EEPROM
     protected:
 
         // Functions
-        static void Initialize_RAMcopy(void);       // Called by Initilize_EEPROM. It sets all the RAM variables to default values. 
-        static void Initialize_EEPROM(void);        // This copies all variables (at default values) from RAM into eeprom.
+        static void Initialize_Defaults(_eeprom_data &defaults);    // Called by Initilize_EEPROM. It sets every variable of the struct passed to its default value. 
+        static void Initialize_EEPROM(void);        // This writes all variables (at default values) to eeprom, then reloads the ramcopy.
         
         static uint16_t findStorageVarInfo(_storage_var_info &svi, uint16_t findID);    // When we know the var ID but not the position in the array it occupies
         static boolean getStorageVarInfo(_storage_var_info &svi, uint16_t arrayPos);    // For when we already know the array element we want
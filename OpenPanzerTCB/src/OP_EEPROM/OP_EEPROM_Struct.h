@@ -34,6 +34,11 @@ struct _eeprom_data {
     Drive_t TurretRotationMotor;
     Drive_t TurretElevationMotor;
 
+// Closed-loop track speed, only used if both IO ports are set to encoder inputs (see OP_TrackSpeed)
+    uint16_t EncoderFullSpeedCPS;              // Encoder edges per second with the tracks at full speed
+    uint8_t SpeedLoop_Kp;                      // Speed loop gains, in 1/32nds
+    uint8_t SpeedLoop_Ki;
+
 //  Elevation/Rotation servo min/max/reversed/speed
     int16_t TurretElevation_EPMin;             // If the elevation motor selection is of type servo, we allow customized endpoints
     int16_t TurretElevation_EPMax;
@@ -181,5 +186,39 @@ struct _eeprom_data {
     uint32_t InitStamp;                          
 };
 
+// RAM COPY
+//--------------------------------------------------------------------------------------------------------------------------------------->>
+// We don't keep the entire struct above in RAM, there isn't enough of it to spare. Only the variables listed here are copied to the ramcopy struct - those read 
+// by the main loop, those the user can adjust while driving, and those whose address is handed to some other object (the radio keeps pointers to the 
+// channel settings, the serial motor controllers keep a pointer to the baud rate). Everything else is only needed at startup or in the menus, and is read 
+// straight from EEPROM when needed with the EEPROM_VAR() macro (see OP_EEPROM.h). 
+
+// This list has no effect on the EEPROM layout, so changing it does NOT require a new EEPROM_INIT. If you move a variable out of the list, the compiler will 
+// point out every place that still uses eeprom.ramcopy.<var> - change those to EEPROM_VAR(<var>). 
+#define EEPROM_HOT_VARS(X)                                                                                                                      \
+    X(ThrottleSettings)         X(TurnSettings)             X(ElevationSettings)        X(AzimuthSettings)                                  \
+    X(Aux_ChannelSettings)                                                                                                                      \
+    X(SF_Trigger)                                                                                                                               \
+    X(TurretRotationMotor)      X(TurretElevationMotor)     X(TurretElevation_EPMin)    X(TurretElevation_EPMax)    X(TurretElevation_Reversed) \
+    X(Airsoft)                  X(SmokerControlAuto)        X(SmokerDestroyedSpeed)                                                         \
+    X(AccelRampEnabled_1)       X(AccelSkipNum_1)           X(AccelPreset_1)                                                                \
+    X(DecelRampEnabled_1)       X(DecelSkipNum_1)           X(DecelPreset_1)                                                                \
+    X(AccelRampEnabled_2)       X(AccelSkipNum_2)           X(AccelPreset_2)                                                                \
+    X(DecelRampEnabled_2)       X(DecelSkipNum_2)           X(DecelPreset_2)                                                                \
+    X(TimeToShift_mS)           X(TransmissionDelay_mS)     X(TurnMode)                 X(DriveType)                                        \
+    X(MaxForwardSpeedPct)       X(MaxReverseSpeedPct)       X(EngineAutoStart)          X(EngineAutoStopTime_mS)    X(NudgeTime_mS)         \
+    X(EnableBarrelStabilize)    X(BarrelSensitivity)        X(EnableHillPhysics)        X(HillSensitivity)          X(IgnoreTurretDelay_mS) \
+    X(TurretSound_Enabled)      X(BarrelSound_Enabled)                                                                                      \
+    X(MotorSerialBaud)          X(LVC_Cutoff_mV)                                                                                            \
+    X(BrakesAutoOnAtStop)       X(AuxLightFlashTime_mS)     X(AuxLightBlinkOnTime_mS)   X(AuxLightBlinkOffTime_mS)                          \
+    X(AuxLightPresetDim)        X(FlashLightsWhenSignalLost)
+
+// The ramcopy struct itself. Each member has the same name and type as its counterpart in _eeprom_data
+#define EEPROM_HOT_MEMBER(var)  __typeof__(((_eeprom_data *)0)->var) var;
+struct _eeprom_hot {
+    EEPROM_HOT_VARS(EEPROM_HOT_MEMBER)
+};
+#undef EEPROM_HOT_MEMBER
+
 
 #endif  // Define OP_EEPROM_STRUCT_H
\ No newline at end of file
@@ -7,7 +7,7 @@
 //=======================================================================================================================================>>
 // You must make sure this number equals the number of variables defined in the __eeprom_data struct (including the unused FirstVar)
 // 
-    #define NUM_STORED_VARS         307
+    #define NUM_STORED_VARS         342
 
 // THIS NUMBER CAN BE CALCULATED BY THE EXCEL REFERENCE SHEET - AS CAN THE ENTIRE PROGMEM STATEMENT BELOW
 // Don't bother trying to do it by hand!
@@ -56,306 +56,341 @@ const _storage_var_info STORAGEVARS[NUM_STORED_VARS] PROGMEM_FAR = {
     {1014, 6, varUINT16},        // ThrottleSettings.pulseCenter
     {1015, 8, varUINT8},        // ThrottleSettings.deadband
     {1016, 9, varBOOL},        // ThrottleSettings.reversed
-    {1017, 10, varUINT8},        // TurnSettings.channelNum
-    {1018, 11, varUINT16},        // TurnSettings.pulseMin
-    {1019, 13, varUINT16},        // TurnSettings.pulseMax
-    {1020, 15, varUINT16},        // TurnSettings.pulseCenter
-    {1021, 17, varUINT8},        // TurnSettings.deadband
-    {1022, 18, varBOOL},        // TurnSettings.reversed
-    {1023, 19, varUINT8},        // ElevationSettings.channelNum
-    {1024, 20, varUINT16},        // ElevationSettings.pulseMin
-    {1025, 22, varUINT16},        // ElevationSettings.pulseMax
-    {1026, 24, varUINT16},        // ElevationSettings.pulseCenter
-    {1027, 26, varUINT8},        // ElevationSettings.deadband
-    {1028, 27, varBOOL},        // ElevationSettings.reversed
-    {1029, 28, varUINT8},        // AzimuthSettings.channelNum
-    {1030, 29, varUINT16},        // AzimuthSettings.pulseMin
-    {1031, 31, varUINT16},        // AzimuthSettings.pulseMax
-    {1032, 33, varUINT16},        // AzimuthSettings.pulseCenter
-    {1033, 35, varUINT8},        // AzimuthSettings.deadband
-    {1034, 36, varBOOL},        // AzimuthSettings.reversed
-    {1211, 37, varUINT8},        // Aux1_ChannelSettings.channelNum
-    {1212, 38, varUINT16},        // Aux1_ChannelSettings.pulseMin
-    {1213, 40, varUINT16},        // Aux1_ChannelSettings.pulseMax
-    {1214, 42, varUINT16},        // Aux1_ChannelSettings.pulseCenter
-    {1215, 44, varBOOL},        // Aux1_ChannelSettings.Digital
-    {1216, 45, varUINT8},        // Aux1_ChannelSettings.NumPositions
-    {1217, 46, varBOOL},        // Aux1_ChannelSettings.reversed
-    {1218, 47, varUINT8},        // Aux2_ChannelSettings.channelNum
-    {1219, 48, varUINT16},        // Aux2_ChannelSettings.pulseMin
-    {1220, 50, varUINT16},        // Aux2_ChannelSettings.pulseMax
-    {1221, 52, varUINT16},        // Aux2_ChannelSettings.pulseCenter
-    {1222, 54, varBOOL},        // Aux2_ChannelSettings.Digital
-    {1223, 55, varUINT8},        // Aux2_ChannelSettings.NumPositions
-    {1224, 56, varBOOL},        // Aux2_ChannelSettings.reversed
-    {1225, 57, varUINT8},        // Aux3_ChannelSettings.channelNum
-    {1226, 58, varUINT16},        // Aux3_ChannelSettings.pulseMin
-    {1227, 60, varUINT16},        // Aux3_ChannelSettings.pulseMax
-    {1228, 62, varUINT16},        // Aux3_ChannelSettings.pulseCenter
-    {1229, 64, varBOOL},        // Aux3_ChannelSettings.Digital
-    {1230, 65, varUINT8},        // Aux3_ChannelSettings.NumPositions
-    {1231, 66, varBOOL},        // Aux3_ChannelSettings.reversed
-    {1232, 67, varUINT8},        // Aux4_ChannelSettings.channelNum
-    {1233, 68, varUINT16},        // Aux4_ChannelSettings.pulseMin
-    {1234, 70, varUINT16},        // Aux4_ChannelSettings.pulseMax
-    {1235, 72, varUINT16},        // Aux4_ChannelSettings.pulseCenter
-    {1236, 74, varBOOL},        // Aux4_ChannelSettings.Digital
-    {1237, 75, varUINT8},        // Aux4_ChannelSettings.NumPositions
-    {1238, 76, varBOOL},        // Aux4_ChannelSettings.reversed
-    {1239, 77, varUINT8},        // Aux5_ChannelSettings.channelNum
-    {1240, 78, varUINT16},        // Aux5_ChannelSettings.pulseMin
-    {1241, 80, varUINT16},        // Aux5_ChannelSettings.pulseMax
-    {1242, 82, varUINT16},        // Aux5_ChannelSettings.pulseCenter
-    {1243, 84, varBOOL},        // Aux5_ChannelSettings.Digital
-    {1244, 85, varUINT8},        // Aux5_ChannelSettings.NumPositions
-    {1245, 86, varBOOL},        // Aux5_ChannelSettings.reversed
-    {1246, 87, varUINT8},        // Aux6_ChannelSettings.channelNum
-    {1247, 88, varUINT16},        // Aux6_ChannelSettings.pulseMin
-    {1248, 90, varUINT16},        // Aux6_ChannelSettings.pulseMax
-    {1249, 92, varUINT16},        // Aux6_ChannelSettings.pulseCenter
-    {1250, 94, varBOOL},        // Aux6_ChannelSettings.Digital
-    {1251, 95, varUINT8},        // Aux6_ChannelSettings.NumPositions
-    {1252, 96, varBOOL},        // Aux6_ChannelSettings.reversed
-    {1253, 97, varUINT8},        // Aux7_ChannelSettings.channelNum
-    {1254, 98, varUINT16},        // Aux7_ChannelSettings.pulseMin
-    {1255, 100, varUINT16},        // Aux7_ChannelSettings.pulseMax
-    {1256, 102, varUINT16},        // Aux7_ChannelSettings.pulseCenter
-    {1257, 104, varBOOL},        // Aux7_ChannelSettings.Digital
-    {1258, 105, varUINT8},        // Aux7_ChannelSettings.NumPositions
-    {1259, 106, varBOOL},        // Aux7_ChannelSettings.reversed
-    {1260, 107, varUINT8},        // Aux8_ChannelSettings.channelNum
-    {1261, 108, varUINT16},        // Aux8_ChannelSettings.pulseMin
-    {1262, 110, varUINT16},        // Aux8_ChannelSettings.pulseMax
-    {1263, 112, varUINT16},        // Aux8_ChannelSettings.pulseCenter
-    {1264, 114, varBOOL},        // Aux8_ChannelSettings.Digital
-    {1265, 115, varUINT8},        // Aux8_ChannelSettings.NumPositions
-    {1266, 116, varBOOL},        // Aux8_ChannelSettings.reversed
-    {1267, 117, varUINT8},        // Aux9_ChannelSettings.channelNum
-    {1268, 118, varUINT16},        // Aux9_ChannelSettings.pulseMin
-    {1269, 120, varUINT16},        // Aux9_ChannelSettings.pulseMax
-    {1270, 122, varUINT16},        // Aux9_ChannelSettings.pulseCenter
-    {1271, 124, varBOOL},        // Aux9_ChannelSettings.Digital
-    {1272, 125, varUINT8},        // Aux9_ChannelSettings.NumPositions
-    {1273, 126, varBOOL},        // Aux9_ChannelSettings.reversed
-    {1274, 127, varUINT8},        // Aux10_ChannelSettings.channelNum
-    {1275, 128, varUINT16},        // Aux10_ChannelSettings.pulseMin
-    {1276, 130, varUINT16},        // Aux10_ChannelSettings.pulseMax
-    {1277, 132, varUINT16},        // Aux10_ChannelSettings.pulseCenter
-    {1278, 134, varBOOL},        // Aux10_ChannelSettings.Digital
-    {1279, 135, varUINT8},        // Aux10_ChannelSettings.NumPositions
-    {1280, 136, varBOOL},        // Aux10_ChannelSettings.reversed
-    {1281, 137, varUINT8},        // Aux11_ChannelSettings.channelNum
-    {1282, 138, varUINT16},        // Aux11_ChannelSettings.pulseMin
-    {1283, 140, varUINT16},        // Aux11_ChannelSettings.pulseMax
-    {1284, 142, varUINT16},        // Aux11_ChannelSettings.pulseCenter
-    {1285, 144, varBOOL},        // Aux11_ChannelSettings.Digital
-    {1286, 145, varUINT8},        // Aux11_ChannelSettings.NumPositions
-    {1287, 146, varBOOL},        // Aux11_ChannelSettings.reversed
-    {1288, 147, varUINT8},        // Aux12_ChannelSettings.channelNum
-    {1289, 148, varUINT16},        // Aux12_ChannelSettings.pulseMin
-    {1290, 150, varUINT16},        // Aux12_ChannelSettings.pulseMax
-    {1291, 152, varUINT16},        // Aux12_ChannelSettings.pulseCenter
-    {1292, 154, varBOOL},        // Aux12_ChannelSettings.Digital
-    {1293, 155, varUINT8},        // Aux12_ChannelSettings.NumPositions
-    {1294, 156, varBOOL},        // Aux12_ChannelSettings.reversed
-    {1311, 157, varUINT8},        // PortA_Settings.dataDirection
-    {1312, 158, varUINT8},        // PortA_Settings.dataType
-    {1313, 159, varUINT8},        // PortB_Settings.dataDirection
-    {1314, 160, varUINT8},        // PortB_Settings.dataType
-    {1411, 161, varUINT16},        // SF_Trigger[0].TriggerID
-    {1412, 163, varUINT8},        // SF_Trigger[0].specialFunction
-    {1413, 164, varUINT16},        // SF_Trigger[1].TriggerID
-    {1414, 166, varUINT8},        // SF_Trigger[1].specialFunction
-    {1415, 167, varUINT16},        // SF_Trigger[2].TriggerID
-    {1416, 169, varUINT8},        // SF_Trigger[2].specialFunction
-    {1417, 170, varUINT16},        // SF_Trigger[3].TriggerID
-    {1418, 172, varUINT8},        // SF_Trigger[3].specialFunction
-    {1419, 173, varUINT16},        // SF_Trigger[4].TriggerID
-    {1420, 175, varUINT8},        // SF_Trigger[4].specialFunction
-    {1421, 176, varUINT16},        // SF_Trigger[5].TriggerID
-    {1422, 178, varUINT8},        // SF_Trigger[5].specialFunction
-    {1423, 179, varUINT16},        // SF_Trigger[6].TriggerID
-    {1424, 181, varUINT8},        // SF_Trigger[6].specialFunction
-    {1425, 182, varUINT16},        // SF_Trigger[7].TriggerID
-    {1426, 184, varUINT8},        // SF_Trigger[7].specialFunction
-    {1427, 185, varUINT16},        // SF_Trigger[8].TriggerID
-    {1428, 187, varUINT8},        // SF_Trigger[8].specialFunction
-    {1429, 188, varUINT16},        // SF_Trigger[9].TriggerID
-    {1430, 190, varUINT8},        // SF_Trigger[9].specialFunction
-    {1431, 191, varUINT16},        // SF_Trigger[10].TriggerID
-    {1432, 193, varUINT8},        // SF_Trigger[10].specialFunction
-    {1433, 194, varUINT16},        // SF_Trigger[11].TriggerID
-    {1434, 196, varUINT8},        // SF_Trigger[11].specialFunction
-    {1435, 197, varUINT16},        // SF_Trigger[12].TriggerID
-    {1436, 199, varUINT8},        // SF_Trigger[12].specialFunction
-    {1437, 200, varUINT16},        // SF_Trigger[13].TriggerID
-    {1438, 202, varUINT8},        // SF_Trigger[13].specialFunction
-    {1439, 203, varUINT16},        // SF_Trigger[14].TriggerID
-    {1440, 205, varUINT8},        // SF_Trigger[14].specialFunction
-    {1441, 206, varUINT16},        // SF_Trigger[15].TriggerID
-    {1442, 208, varUINT8},        // SF_Trigger[15].specialFunction
-    {1443, 209, varUINT16},        // SF_Trigger[16].TriggerID
-    {1444, 211, varUINT8},        // SF_Trigger[16].specialFunction
-    {1445, 212, varUINT16},        // SF_Trigger[17].TriggerID
-    {1446, 214, varUINT8},        // SF_Trigger[17].specialFunction
-    {1447, 215, varUINT16},        // SF_Trigger[18].TriggerID
-    {1448, 217, varUINT8},        // SF_Trigger[18].specialFunction
-    {1449, 218, varUINT16},        // SF_Trigger[19].TriggerID
-    {1450, 220, varUINT8},        // SF_Trigger[19].specialFunction
-    {1451, 221, varUINT16},        // SF_Trigger[20].TriggerID
-    {1452, 223, varUINT8},        // SF_Trigger[20].specialFunction
-    {1453, 224, varUINT16},        // SF_Trigger[21].TriggerID
-    {1454, 226, varUINT8},        // SF_Trigger[21].specialFunction
-    {1455, 227, varUINT16},        // SF_Trigger[22].TriggerID
-    {1456, 229, varUINT8},        // SF_Trigger[22].specialFunction
-    {1457, 230, varUINT16},        // SF_Trigger[23].TriggerID
-    {1458, 232, varUINT8},        // SF_Trigger[23].specialFunction
-    {1459, 233, varUINT16},        // SF_Trigger[24].TriggerID
-    {1460, 235, varUINT8},        // SF_Trigger[24].specialFunction
-    {1461, 236, varUINT16},        // SF_Trigger[25].TriggerID
-    {1462, 238, varUINT8},        // SF_Trigger[25].specialFunction
-    {1463, 239, varUINT16},        // SF_Trigger[26].TriggerID
-    {1464, 241, varUINT8},        // SF_Trigger[26].specialFunction
-    {1465, 242, varUINT16},        // SF_Trigger[27].TriggerID
-    {1466, 244, varUINT8},        // SF_Trigger[27].specialFunction
-    {1467, 245, varUINT16},        // SF_Trigger[28].TriggerID
-    {1468, 247, varUINT8},        // SF_Trigger[28].specialFunction
-    {1469, 248, varUINT16},        // SF_Trigger[29].TriggerID
-    {1470, 250, varUINT8},        // SF_Trigger[29].specialFunction
-    {1471, 251, varUINT16},        // SF_Trigger[30].TriggerID
-    {1472, 253, varUINT8},        // SF_Trigger[30].specialFunction
-    {1473, 254, varUINT16},        // SF_Trigger[31].TriggerID
-    {1474, 256, varUINT8},        // SF_Trigger[31].specialFunction
-    {1475, 257, varUINT16},        // SF_Trigger[32].TriggerID
-    {1476, 259, varUINT8},        // SF_Trigger[32].specialFunction
-    {1477, 260, varUINT16},        // SF_Trigger[33].TriggerID
-    {1478, 262, varUINT8},        // SF_Trigger[33].specialFunction
-    {1479, 263, varUINT16},        // SF_Trigger[34].TriggerID
-    {1480, 265, varUINT8},        // SF_Trigger[34].specialFunction
-    {1481, 266, varUINT16},        // SF_Trigger[35].TriggerID
-    {1482, 268, varUINT8},        // SF_Trigger[35].specialFunction
-    {1483, 269, varUINT16},        // SF_Trigger[36].TriggerID
-    {1484, 271, varUINT8},        // SF_Trigger[36].specialFunction
-    {1485, 272, varUINT16},        // SF_Trigger[37].TriggerID
-    {1486, 274, varUINT8},        // SF_Trigger[37].specialFunction
-    {1487, 275, varUINT16},        // SF_Trigger[38].TriggerID
-    {1488, 277, varUINT8},        // SF_Trigger[38].specialFunction
-    {1489, 278, varUINT16},        // SF_Trigger[39].TriggerID
-    {1490, 280, varUINT8},        // SF_Trigger[39].specialFunction
-    {1611, 281, varUINT8},        // DriveMotors
-    {1612, 282, varUINT8},        // TurretRotationMotor
-    {1613, 283, varUINT8},        // TurretElevationMotor
-    {1811, 284, varINT16},        // TurretElevation_EPMin
-    {1812, 286, varINT16},        // TurretElevation_EPMax
-    {1813, 288, varBOOL},        // TurretElevation_Reversed
-    {1814, 289, varUINT8},        // TurretElevation_MaxSpeedPct
-    {1815, 290, varUINT8},        // TurretRotation_MaxSpeedPct
-    {1816, 291, varINT16},        // TurretRotation_EPMin
-    {1817, 293, varINT16},        // TurretRotation_EPMax
-    {1818, 295, varBOOL},        // TurretRotation_Reversed
-    {2011, 296, varBOOL},        // Airsoft
-    {2012, 297, varBOOL},        // MechanicalBarrelWithCannon
-    {2013, 298, varINT16},        // RecoilDelay
-    {2014, 300, varBOOL},        // RecoilReversed
-    {2015, 301, varBOOL},        // ServoRecoilWithCannon
-    {2016, 302, varINT16},        // RecoilServo_Recoil_mS
-    {2017, 304, varINT16},        // RecoilServo_Return_mS
-    {2018, 306, varINT16},        // RecoilServo_EPMin
-    {2019, 308, varINT16},        // RecoilServo_EPMax
-    {2211, 310, varBOOL},        // SmokerControlAuto
-    {2212, 311, varINT16},        // SmokerIdleSpeed
-    {2213, 313, varINT16},        // SmokerFastIdleSpeed
-    {2214, 315, varINT16},        // SmokerMaxSpeed
-    {2215, 317, varINT16},        // SmokerDestroyedSpeed
-    {2411, 319, varBOOL},        // AccelRampEnabled_1
-    {2412, 320, varUINT8},        // AccelSkipNum_1
-    {2413, 321, varUINT8},        // AccelPreset_1
-    {2414, 322, varBOOL},        // DecelRampEnabled_1
-    {2415, 323, varUINT8},        // DecelSkipNum_1
-    {2416, 324, varUINT8},        // DecelPreset_1
-    {2417, 325, varBOOL},        // AccelRampEnabled_2
-    {2418, 326, varUINT8},        // AccelSkipNum_2
-    {2419, 327, varUINT8},        // AccelPreset_2
-    {2420, 328, varBOOL},        // DecelRampEnabled_2
-    {2421, 329, varUINT8},        // DecelSkipNum_2
-    {2422, 330, varUINT8},        // DecelPreset_2
-    {2423, 331, varUINT8},        // BrakeSensitivityPct
-    {2424, 332, varUINT16},        // TimeToShift_mS
-    {2425, 334, varUINT16},        // EnginePauseTime_mS
-    {2426, 336, varUINT16},        // TransmissionDelay_mS
-    {2427, 338, varBOOL},        // NeutralTurnAllowed
-    {2428, 339, varUINT8},        // NeutralTurnPct
-    {2429, 340, varUINT8},        // TurnMode
-    {2430, 341, varUINT8},        // DriveType
-    {2431, 342, varUINT8},        // MaxForwardSpeedPct
-    {2432, 343, varUINT8},        // MaxReverseSpeedPct
-    {2433, 344, varUINT8},        // HalftrackTreadTurnPct
-    {2434, 345, varBOOL},        // EngineAutoStart
-    {2435, 346, varINT32},        // EngineAutoStopTime_mS
-    {2436, 350, varUINT8},        // MotorNudgePct
-    {2437, 351, varUINT16},        // NudgeTime_mS
-    {2438, 353, varBOOL},        // DragInnerTrack
-    {2511, 354, varBOOL},        // EnableBarrelStabilize
-    {2512, 355, varUINT8},        // BarrelSensitivity
-    {2513, 356, varBOOL},        // EnableHillPhysics
-    {2514, 357, varUINT8},        // HillSensitivity
-    {2711, 358, varINT16},        // IgnoreTurretDelay_mS
-    {2811, 360, varUINT8},        // SoundDevice
-    {2812, 361, varUINT16},        // Squeak1_MinInterval_mS
-    {2813, 363, varUINT16},        // Squeak1_MaxInterval_mS
-    {2814, 365, varUINT16},        // Squeak2_MinInterval_mS
-    {2815, 367, varUINT16},        // Squeak2_MaxInterval_mS
-    {2816, 369, varUINT16},        // Squeak3_MinInterval_mS
-    {2817, 371, varUINT16},        // Squeak3_MaxInterval_mS
-    {2818, 373, varBOOL},        // Squeak1_Enabled
-    {2819, 374, varBOOL},        // Squeak2_Enabled
-    {2820, 375, varBOOL},        // Squeak3_Enabled
-    {2821, 376, varUINT8},        // MinSqueakSpeed
-    {2822, 377, varBOOL},        // HeadlightSound_Enabled
-    {2823, 378, varBOOL},        // TurretSound_Enabled
-    {2824, 379, varBOOL},        // BarrelSound_Enabled
-    {2825, 380, varUINT16},        // Squeak4_MinInterval_mS
-    {2826, 382, varUINT16},        // Squeak4_MaxInterval_mS
-    {2827, 384, varUINT16},        // Squeak5_MinInterval_mS
-    {2828, 386, varUINT16},        // Squeak5_MaxInterval_mS
-    {2829, 388, varUINT16},        // Squeak6_MinInterval_mS
-    {2830, 390, varUINT16},        // Squeak6_MaxInterval_mS
-    {2831, 392, varBOOL},        // Squeak4_Enabled
-    {2832, 393, varBOOL},        // Squeak5_Enabled
-    {2833, 394, varBOOL},        // Squeak6_Enabled
-    {3011, 395, varUINT8},        // IR_FireProtocol
-    {3012, 396, varUINT8},        // IR_HitProtocol_2
-    {3013, 397, varUINT8},        // IR_RepairProtocol
-    {3014, 398, varUINT8},        // IR_MGProtocol
-    {3015, 399, varBOOL},        // Use_MG_Protocol
-    {3016, 400, varBOOL},        // Accept_MG_Damage
-    {3017, 401, varUINT8},        // DamageProfile
-    {3018, 402, varUINT16},        // CustomClassSettings.reloadTime
-    {3019, 404, varUINT16},        // CustomClassSettings.recoveryTime
-    {3020, 406, varUINT8},        // CustomClassSettings.maxHits
-    {3021, 407, varUINT8},        // CustomClassSettings.maxMGHits
-    {3022, 408, varBOOL},        // SendTankID
-    {3023, 409, varUINT16},        // TankID
-    {3024, 411, varUINT8},        // IR_Team
-    {3211, 412, varUINT32},        // USBSerialBaud
-    {3212, 416, varUINT32},        // AuxSerialBaud
-    {3213, 420, varUINT32},        // MotorSerialBaud
-    {3214, 424, varUINT32},        // Serial3TxBaud
-    {3215, 428, varBOOL},        // LVC_Enabled
-    {3216, 429, varUINT16},        // LVC_Cutoff_mV
-    {3411, 431, varBOOL},        // RunningLightsAlwaysOn
-    {3412, 432, varUINT8},        // RunningLightsDimLevelPct
-    {3413, 433, varBOOL},        // BrakesAutoOnAtStop
-    {3414, 434, varUINT16},        // AuxLightFlashTime_mS
-    {3415, 436, varUINT16},        // AuxLightBlinkOnTime_mS
-    {3416, 438, varUINT16},        // AuxLightBlinkOffTime_mS
-    {3417, 440, varUINT8},        // AuxLightPresetDim
-    {3418, 441, varUINT8},        // MGLightBlink_mS
-    {3419, 442, varBOOL},        // FlashLightsWhenSignalLost
-    {3420, 443, varBOOL},        // HiFlashWithCannon
-    {3421, 444, varBOOL},        // AuxFlashWithCannon
-    {9011, 445, varBOOL},        // PrintDebug
-    {9999, 446, varUINT32}        // InitStamp
+    {1111, 10, varUINT8},        // ThrottleSettings.jitterBand
+    {1112, 11, varBOOL},        // ThrottleSettings.medianFilter
+    {1017, 12, varUINT8},        // TurnSettings.channelNum
+    {1018, 13, varUINT16},        // TurnSettings.pulseMin
+    {1019, 15, varUINT16},        // TurnSettings.pulseMax
+    {1020, 17, varUINT16},        // TurnSettings.pulseCenter
+    {1021, 19, varUINT8},        // TurnSettings.deadband
+    {1022, 20, varBOOL},        // TurnSettings.reversed
+    {1113, 21, varUINT8},        // TurnSettings.jitterBand
+    {1114, 22, varBOOL},        // TurnSettings.medianFilter
+    {1023, 23, varUINT8},        // ElevationSettings.channelNum
+    {1024, 24, varUINT16},        // ElevationSettings.pulseMin
+    {1025, 26, varUINT16},        // ElevationSettings.pulseMax
+    {1026, 28, varUINT16},        // ElevationSettings.pulseCenter
+    {1027, 30, varUINT8},        // ElevationSettings.deadband
+    {1028, 31, varBOOL},        // ElevationSettings.reversed
+    {1115, 32, varUINT8},        // ElevationSettings.jitterBand
+    {1116, 33, varBOOL},        // ElevationSettings.medianFilter
+    {1029, 34, varUINT8},        // AzimuthSettings.channelNum
+    {1030, 35, varUINT16},        // AzimuthSettings.pulseMin
+    {1031, 37, varUINT16},        // AzimuthSettings.pulseMax
+    {1032, 39, varUINT16},        // AzimuthSettings.pulseCenter
+    {1033, 41, varUINT8},        // AzimuthSettings.deadband
+    {1034, 42, varBOOL},        // AzimuthSettings.reversed
+    {1117, 43, varUINT8},        // AzimuthSettings.jitterBand
+    {1118, 44, varBOOL},        // AzimuthSettings.medianFilter
+    {1211, 45, varUINT8},        // Aux1_ChannelSettings.channelNum
+    {1212, 46, varUINT16},        // Aux1_ChannelSettings.pulseMin
+    {1213, 48, varUINT16},        // Aux1_ChannelSettings.pulseMax
+    {1214, 50, varUINT16},        // Aux1_ChannelSettings.pulseCenter
+    {1215, 52, varBOOL},        // Aux1_ChannelSettings.Digital
+    {1216, 53, varUINT8},        // Aux1_ChannelSettings.NumPositions
+    {1217, 54, varBOOL},        // Aux1_ChannelSettings.reversed
+    {1119, 55, varUINT8},        // Aux1_ChannelSettings.jitterBand
+    {1120, 56, varBOOL},        // Aux1_ChannelSettings.medianFilter
+    {1218, 57, varUINT8},        // Aux2_ChannelSettings.channelNum
+    {1219, 58, varUINT16},        // Aux2_ChannelSettings.pulseMin
+    {1220, 60, varUINT16},        // Aux2_ChannelSettings.pulseMax
+    {1221, 62, varUINT16},        // Aux2_ChannelSettings.pulseCenter
+    {1222, 64, varBOOL},        // Aux2_ChannelSettings.Digital
+    {1223, 65, varUINT8},        // Aux2_ChannelSettings.NumPositions
+    {1224, 66, varBOOL},        // Aux2_ChannelSettings.reversed
+    {1121, 67, varUINT8},        // Aux2_ChannelSettings.jitterBand
+    {1122, 68, varBOOL},        // Aux2_ChannelSettings.medianFilter
+    {1225, 69, varUINT8},        // Aux3_ChannelSettings.channelNum
+    {1226, 70, varUINT16},        // Aux3_ChannelSettings.pulseMin
+    {1227, 72, varUINT16},        // Aux3_ChannelSettings.pulseMax
+    {1228, 74, varUINT16},        // Aux3_ChannelSettings.pulseCenter
+    {1229, 76, varBOOL},        // Aux3_ChannelSettings.Digital
+    {1230, 77, varUINT8},        // Aux3_ChannelSettings.NumPositions
+    {1231, 78, varBOOL},        // Aux3_ChannelSettings.reversed
+    {1123, 79, varUINT8},        // Aux3_ChannelSettings.jitterBand
+    {1124, 80, varBOOL},        // Aux3_ChannelSettings.medianFilter
+    {1232, 81, varUINT8},        // Aux4_ChannelSettings.channelNum
+    {1233, 82, varUINT16},        // Aux4_ChannelSettings.pulseMin
+    {1234, 84, varUINT16},        // Aux4_ChannelSettings.pulseMax
+    {1235, 86, varUINT16},        // Aux4_ChannelSettings.pulseCenter
+    {1236, 88, varBOOL},        // Aux4_ChannelSettings.Digital
+    {1237, 89, varUINT8},        // Aux4_ChannelSettings.NumPositions
+    {1238, 90, varBOOL},        // Aux4_ChannelSettings.reversed
+    {1125, 91, varUINT8},        // Aux4_ChannelSettings.jitterBand
+    {1126, 92, varBOOL},        // Aux4_ChannelSettings.medianFilter
+    {1239, 93, varUINT8},        // Aux5_ChannelSettings.channelNum
+    {1240, 94, varUINT16},        // Aux5_ChannelSettings.pulseMin
+    {1241, 96, varUINT16},        // Aux5_ChannelSettings.pulseMax
+    {1242, 98, varUINT16},        // Aux5_ChannelSettings.pulseCenter
+    {1243, 100, varBOOL},        // Aux5_ChannelSettings.Digital
+    {1244, 101, varUINT8},        // Aux5_ChannelSettings.NumPositions
+    {1245, 102, varBOOL},        // Aux5_ChannelSettings.reversed
+    {1127, 103, varUINT8},        // Aux5_ChannelSettings.jitterBand
+    {1128, 104, varBOOL},        // Aux5_ChannelSettings.medianFilter
+    {1246, 105, varUINT8},        // Aux6_ChannelSettings.channelNum
+    {1247, 106, varUINT16},        // Aux6_ChannelSettings.pulseMin
+    {1248, 108, varUINT16},        // Aux6_ChannelSettings.pulseMax
+    {1249, 110, varUINT16},        // Aux6_ChannelSettings.pulseCenter
+    {1250, 112, varBOOL},        // Aux6_ChannelSettings.Digital
+    {1251, 113, varUINT8},        // Aux6_ChannelSettings.NumPositions
+    {1252, 114, varBOOL},        // Aux6_ChannelSettings.reversed
+    {1129, 115, varUINT8},        // Aux6_ChannelSettings.jitterBand
+    {1130, 116, varBOOL},        // Aux6_ChannelSettings.medianFilter
+    {1253, 117, varUINT8},        // Aux7_ChannelSettings.channelNum
+    {1254, 118, varUINT16},        // Aux7_ChannelSettings.pulseMin
+    {1255, 120, varUINT16},        // Aux7_ChannelSettings.pulseMax
+    {1256, 122, varUINT16},        // Aux7_ChannelSettings.pulseCenter
+    {1257, 124, varBOOL},        // Aux7_ChannelSettings.Digital
+    {1258, 125, varUINT8},        // Aux7_ChannelSettings.NumPositions
+    {1259, 126, varBOOL},        // Aux7_ChannelSettings.reversed
+    {1131, 127, varUINT8},        // Aux7_ChannelSettings.jitterBand
+    {1132, 128, varBOOL},        // Aux7_ChannelSettings.medianFilter
+    {1260, 129, varUINT8},        // Aux8_ChannelSettings.channelNum
+    {1261, 130, varUINT16},        // Aux8_ChannelSettings.pulseMin
+    {1262, 132, varUINT16},        // Aux8_ChannelSettings.pulseMax
+    {1263, 134, varUINT16},        // Aux8_ChannelSettings.pulseCenter
+    {1264, 136, varBOOL},        // Aux8_ChannelSettings.Digital
+    {1265, 137, varUINT8},        // Aux8_ChannelSettings.NumPositions
+    {1266, 138, varBOOL},        // Aux8_ChannelSettings.reversed
+    {1133, 139, varUINT8},        // Aux8_ChannelSettings.jitterBand
+    {1134, 140, varBOOL},        // Aux8_ChannelSettings.medianFilter
+    {1267, 141, varUINT8},        // Aux9_ChannelSettings.channelNum
+    {1268, 142, varUINT16},        // Aux9_ChannelSettings.pulseMin
+    {1269, 144, varUINT16},        // Aux9_ChannelSettings.pulseMax
+    {1270, 146, varUINT16},        // Aux9_ChannelSettings.pulseCenter
+    {1271, 148, varBOOL},        // Aux9_ChannelSettings.Digital
+    {1272, 149, varUINT8},        // Aux9_ChannelSettings.NumPositions
+    {1273, 150, varBOOL},        // Aux9_ChannelSettings.reversed
+    {1135, 151, varUINT8},        // Aux9_ChannelSettings.jitterBand
+    {1136, 152, varBOOL},        // Aux9_ChannelSettings.medianFilter
+    {1274, 153, varUINT8},        // Aux10_ChannelSettings.channelNum
+    {1275, 154, varUINT16},        // Aux10_ChannelSettings.pulseMin
+    {1276, 156, varUINT16},        // Aux10_ChannelSettings.pulseMax
+    {1277, 158, varUINT16},        // Aux10_ChannelSettings.pulseCenter
+    {1278, 160, varBOOL},        // Aux10_ChannelSettings.Digital
+    {1279, 161, varUINT8},        // Aux10_ChannelSettings.NumPositions
+    {1280, 162, varBOOL},        // Aux10_ChannelSettings.reversed
+    {1137, 163, varUINT8},        // Aux10_ChannelSettings.jitterBand
+    {1138, 164, varBOOL},        // Aux10_ChannelSettings.medianFilter
+    {1281, 165, varUINT8},        // Aux11_ChannelSettings.channelNum
+    {1282, 166, varUINT16},        // Aux11_ChannelSettings.pulseMin
+    {1283, 168, varUINT16},        // Aux11_ChannelSettings.pulseMax
+    {1284, 170, varUINT16},        // Aux11_ChannelSettings.pulseCenter
+    {1285, 172, varBOOL},        // Aux11_ChannelSettings.Digital
+    {1286, 173, varUINT8},        // Aux11_ChannelSettings.NumPositions
+    {1287, 174, varBOOL},        // Aux11_ChannelSettings.reversed
+    {1139, 175, varUINT8},        // Aux11_ChannelSettings.jitterBand
+    {1140, 176, varBOOL},        // Aux11_ChannelSettings.medianFilter
+    {1288, 177, varUINT8},        // Aux12_ChannelSettings.channelNum
+    {1289, 178, varUINT16},        // Aux12_ChannelSettings.pulseMin
+    {1290, 180, varUINT16},        // Aux12_ChannelSettings.pulseMax
+    {1291, 182, varUINT16},        // Aux12_ChannelSettings.pulseCenter
+    {1292, 184, varBOOL},        // Aux12_ChannelSettings.Digital
+    {1293, 185, varUINT8},        // Aux12_ChannelSettings.NumPositions
+    {1294, 186, varBOOL},        // Aux12_ChannelSettings.reversed
+    {1141, 187, varUINT8},        // Aux12_ChannelSettings.jitterBand
+    {1142, 188, varBOOL},        // Aux12_ChannelSettings.medianFilter
+    {1311, 189, varUINT8},        // PortA_Settings.dataDirection
+    {1312, 190, varUINT8},        // PortA_Settings.dataType
+    {1313, 191, varUINT8},        // PortB_Settings.dataDirection
+    {1314, 192, varUINT8},        // PortB_Settings.dataType
+    {1411, 193, varUINT16},        // SF_Trigger[0].TriggerID
+    {1412, 195, varUINT8},        // SF_Trigger[0].specialFunction
+    {1413, 196, varUINT16},        // SF_Trigger[1].TriggerID
+    {1414, 198, varUINT8},        // SF_Trigger[1].specialFunction
+    {1415, 199, varUINT16},        // SF_Trigger[2].TriggerID
+    {1416, 201, varUINT8},        // SF_Trigger[2].specialFunction
+    {1417, 202, varUINT16},        // SF_Trigger[3].TriggerID
+    {1418, 204, varUINT8},        // SF_Trigger[3].specialFunction
+    {1419, 205, varUINT16},        // SF_Trigger[4].TriggerID
+    {1420, 207, varUINT8},        // SF_Trigger[4].specialFunction
+    {1421, 208, varUINT16},        // SF_Trigger[5].TriggerID
+    {1422, 210, varUINT8},        // SF_Trigger[5].specialFunction
+    {1423, 211, varUINT16},        // SF_Trigger[6].TriggerID
+    {1424, 213, varUINT8},        // SF_Trigger[6].specialFunction
+    {1425, 214, varUINT16},        // SF_Trigger[7].TriggerID
+    {1426, 216, varUINT8},        // SF_Trigger[7].specialFunction
+    {1427, 217, varUINT16},        // SF_Trigger[8].TriggerID
+    {1428, 219, varUINT8},        // SF_Trigger[8].specialFunction
+    {1429, 220, varUINT16},        // SF_Trigger[9].TriggerID
+    {1430, 222, varUINT8},        // SF_Trigger[9].specialFunction
+    {1431, 223, varUINT16},        // SF_Trigger[10].TriggerID
+    {1432, 225, varUINT8},        // SF_Trigger[10].specialFunction
+    {1433, 226, varUINT16},        // SF_Trigger[11].TriggerID
+    {1434, 228, varUINT8},        // SF_Trigger[11].specialFunction
+    {1435, 229, varUINT16},        // SF_Trigger[12].TriggerID
+    {1436, 231, varUINT8},        // SF_Trigger[12].specialFunction
+    {1437, 232, varUINT16},        // SF_Trigger[13].TriggerID
+    {1438, 234, varUINT8},        // SF_Trigger[13].specialFunction
+    {1439, 235, varUINT16},        // SF_Trigger[14].TriggerID
+    {1440, 237, varUINT8},        // SF_Trigger[14].specialFunction
+    {1441, 238, varUINT16},        // SF_Trigger[15].TriggerID
+    {1442, 240, varUINT8},        // SF_Trigger[15].specialFunction
+    {1443, 241, varUINT16},        // SF_Trigger[16].TriggerID
+    {1444, 243, varUINT8},        // SF_Trigger[16].specialFunction
+    {1445, 244, varUINT16},        // SF_Trigger[17].TriggerID
+    {1446, 246, varUINT8},        // SF_Trigger[17].specialFunction
+    {1447, 247, varUINT16},        // SF_Trigger[18].TriggerID
+    {1448, 249, varUINT8},        // SF_Trigger[18].specialFunction
+    {1449, 250, varUINT16},        // SF_Trigger[19].TriggerID
+    {1450, 252, varUINT8},        // SF_Trigger[19].specialFunction
+    {1451, 253, varUINT16},        // SF_Trigger[20].TriggerID
+    {1452, 255, varUINT8},        // SF_Trigger[20].specialFunction
+    {1453, 256, varUINT16},        // SF_Trigger[21].TriggerID
+    {1454, 258, varUINT8},        // SF_Trigger[21].specialFunction
+    {1455, 259, varUINT16},        // SF_Trigger[22].TriggerID
+    {1456, 261, varUINT8},        // SF_Trigger[22].specialFunction
+    {1457, 262, varUINT16},        // SF_Trigger[23].TriggerID
+    {1458, 264, varUINT8},        // SF_Trigger[23].specialFunction
+    {1459, 265, varUINT16},        // SF_Trigger[24].TriggerID
+    {1460, 267, varUINT8},        // SF_Trigger[24].specialFunction
+    {1461, 268, varUINT16},        // SF_Trigger[25].TriggerID
+    {1462, 270, varUINT8},        // SF_Trigger[25].specialFunction
+    {1463, 271, varUINT16},        // SF_Trigger[26].TriggerID
+    {1464, 273, varUINT8},        // SF_Trigger[26].specialFunction
+    {1465, 274, varUINT16},        // SF_Trigger[27].TriggerID
+    {1466, 276, varUINT8},        // SF_Trigger[27].specialFunction
+    {1467, 277, varUINT16},        // SF_Trigger[28].TriggerID
+    {1468, 279, varUINT8},        // SF_Trigger[28].specialFunction
+    {1469, 280, varUINT16},        // SF_Trigger[29].TriggerID
+    {1470, 282, varUINT8},        // SF_Trigger[29].specialFunction
+    {1471, 283, varUINT16},        // SF_Trigger[30].TriggerID
+    {1472, 285, varUINT8},        // SF_Trigger[30].specialFunction
+    {1473, 286, varUINT16},        // SF_Trigger[31].TriggerID
+    {1474, 288, varUINT8},        // SF_Trigger[31].specialFunction
+    {1475, 289, varUINT16},        // SF_Trigger[32].TriggerID
+    {1476, 291, varUINT8},        // SF_Trigger[32].specialFunction
+    {1477, 292, varUINT16},        // SF_Trigger[33].TriggerID
+    {1478, 294, varUINT8},        // SF_Trigger[33].specialFunction
+    {1479, 295, varUINT16},        // SF_Trigger[34].TriggerID
+    {1480, 297, varUINT8},        // SF_Trigger[34].specialFunction
+    {1481, 298, varUINT16},        // SF_Trigger[35].TriggerID
+    {1482, 300, varUINT8},        // SF_Trigger[35].specialFunction
+    {1483, 301, varUINT16},        // SF_Trigger[36].TriggerID
+    {1484, 303, varUINT8},        // SF_Trigger[36].specialFunction
+    {1485, 304, varUINT16},        // SF_Trigger[37].TriggerID
+    {1486, 306, varUINT8},        // SF_Trigger[37].specialFunction
+    {1487, 307, varUINT16},        // SF_Trigger[38].TriggerID
+    {1488, 309, varUINT8},        // SF_Trigger[38].specialFunction
+    {1489, 310, varUINT16},        // SF_Trigger[39].TriggerID
+    {1490, 312, varUINT8},        // SF_Trigger[39].specialFunction
+    {1611, 313, varUINT8},        // DriveMotors
+    {1612, 314, varUINT8},        // TurretRotationMotor
+    {1613, 315, varUINT8},        // TurretElevationMotor
+    {1614, 316, varUINT16},        // EncoderFullSpeedCPS
+    {1615, 318, varUINT8},        // SpeedLoop_Kp
+    {1616, 319, varUINT8},        // SpeedLoop_Ki
+    {1811, 320, varINT16},        // TurretElevation_EPMin
+    {1812, 322, varINT16},        // TurretElevation_EPMax
+    {1813, 324, varBOOL},        // TurretElevation_Reversed
+    {1814, 325, varUINT8},        // TurretElevation_MaxSpeedPct
+    {1815, 326, varUINT8},        // TurretRotation_MaxSpeedPct
+    {1816, 327, varINT16},        // TurretRotation_EPMin
+    {1817, 329, varINT16},        // TurretRotation_EPMax
+    {1818, 331, varBOOL},        // TurretRotation_Reversed
+    {2011, 332, varBOOL},        // Airsoft
+    {2012, 333, varBOOL},        // MechanicalBarrelWithCannon
+    {2013, 334, varINT16},        // RecoilDelay
+    {2014, 336, varBOOL},        // RecoilReversed
+    {2015, 337, varBOOL},        // ServoRecoilWithCannon
+    {2016, 338, varINT16},        // RecoilServo_Recoil_mS
+    {2017, 340, varINT16},        // RecoilServo_Return_mS
+    {2018, 342, varINT16},        // RecoilServo_EPMin
+    {2019, 344, varINT16},        // RecoilServo_EPMax
+    {2211, 346, varBOOL},        // SmokerControlAuto
+    {2212, 347, varINT16},        // SmokerIdleSpeed
+    {2213, 349, varINT16},        // SmokerFastIdleSpeed
+    {2214, 351, varINT16},        // SmokerMaxSpeed
+    {2215, 353, varINT16},        // SmokerDestroyedSpeed
+    {2411, 355, varBOOL},        // AccelRampEnabled_1
+    {2412, 356, varUINT8},        // AccelSkipNum_1
+    {2413, 357, varUINT8},        // AccelPreset_1
+    {2414, 358, varBOOL},        // DecelRampEnabled_1
+    {2415, 359, varUINT8},        // DecelSkipNum_1
+    {2416, 360, varUINT8},        // DecelPreset_1
+    {2417, 361, varBOOL},        // AccelRampEnabled_2
+    {2418, 362, varUINT8},        // AccelSkipNum_2
+    {2419, 363, varUINT8},        // AccelPreset_2
+    {2420, 364, varBOOL},        // DecelRampEnabled_2
+    {2421, 365, varUINT8},        // DecelSkipNum_2
+    {2422, 366, varUINT8},        // DecelPreset_2
+    {2423, 367, varUINT8},        // BrakeSensitivityPct
+    {2424, 368, varUINT16},        // TimeToShift_mS
+    {2425, 370, varUINT16},        // EnginePauseTime_mS
+    {2426, 372, varUINT16},        // TransmissionDelay_mS
+    {2427, 374, varBOOL},        // NeutralTurnAllowed
+    {2428, 375, varUINT8},        // NeutralTurnPct
+    {2429, 376, varUINT8},        // TurnMode
+    {2430, 377, varUINT8},        // DriveType
+    {2431, 378, varUINT8},        // MaxForwardSpeedPct
+    {2432, 379, varUINT8},        // MaxReverseSpeedPct
+    {2433, 380, varUINT8},        // HalftrackTreadTurnPct
+    {2434, 381, varBOOL},        // EngineAutoStart
+    {2435, 382, varINT32},        // EngineAutoStopTime_mS
+    {2436, 386, varUINT8},        // MotorNudgePct
+    {2437, 387, varUINT16},        // NudgeTime_mS
+    {2438, 389, varBOOL},        // DragInnerTrack
+    {2511, 390, varBOOL},        // EnableBarrelStabilize
+    {2512, 391, varUINT8},        // BarrelSensitivity
+    {2513, 392, varBOOL},        // EnableHillPhysics
+    {2514, 393, varUINT8},        // HillSensitivity
+    {2711, 394, varINT16},        // IgnoreTurretDelay_mS
+    {2811, 396, varUINT8},        // SoundDevice
+    {2812, 397, varUINT16},        // Squeak1_MinInterval_mS
+    {2813, 399, varUINT16},        // Squeak1_MaxInterval_mS
+    {2814, 401, varUINT16},        // Squeak2_MinInterval_mS
+    {2815, 403, varUINT16},        // Squeak2_MaxInterval_mS
+    {2816, 405, varUINT16},        // Squeak3_MinInterval_mS
+    {2817, 407, varUINT16},        // Squeak3_MaxInterval_mS
+    {2818, 409, varBOOL},        // Squeak1_Enabled
+    {2819, 410, varBOOL},        // Squeak2_Enabled
+    {2820, 411, varBOOL},        // Squeak3_Enabled
+    {2821, 412, varUINT8},        // MinSqueakSpeed
+    {2822, 413, varBOOL},        // HeadlightSound_Enabled
+    {2823, 414, varBOOL},        // TurretSound_Enabled
+    {2824, 415, varBOOL},        // BarrelSound_Enabled
+    {2825, 416, varUINT16},        // Squeak4_MinInterval_mS
+    {2826, 418, varUINT16},        // Squeak4_MaxInterval_mS
+    {2827, 420, varUINT16},        // Squeak5_MinInterval_mS
+    {2828, 422, varUINT16},        // Squeak5_MaxInterval_mS
+    {2829, 424, varUINT16},        // Squeak6_MinInterval_mS
+    {2830, 426, varUINT16},        // Squeak6_MaxInterval_mS
+    {2831, 428, varBOOL},        // Squeak4_Enabled
+    {2832, 429, varBOOL},        // Squeak5_Enabled
+    {2833, 430, varBOOL},        // Squeak6_Enabled
+    {3011, 431, varUINT8},        // IR_FireProtocol
+    {3012, 432, varUINT8},        // IR_HitProtocol_2
+    {3013, 433, varUINT8},        // IR_RepairProtocol
+    {3014, 434, varUINT8},        // IR_MGProtocol
+    {3015, 435, varBOOL},        // Use_MG_Protocol
+    {3016, 436, varBOOL},        // Accept_MG_Damage
+    {3017, 437, varUINT8},        // DamageProfile
+    {3018, 438, varUINT16},        // CustomClassSettings.reloadTime
+    {3019, 440, varUINT16},        // CustomClassSettings.recoveryTime
+    {3020, 442, varUINT8},        // CustomClassSettings.maxHits
+    {3021, 443, varUINT8},        // CustomClassSettings.maxMGHits
+    {3022, 444, varBOOL},        // SendTankID
+    {3023, 445, varUINT16},        // TankID
+    {3024, 447, varUINT8},        // IR_Team
+    {3211, 448, varUINT32},        // USBSerialBaud
+    {3212, 452, varUINT32},        // AuxSerialBaud
+    {3213, 456, varUINT32},        // MotorSerialBaud
+    {3214, 460, varUINT32},        // Serial3TxBaud
+    {3215, 464, varBOOL},        // LVC_Enabled
+    {3216, 465, varUINT16},        // LVC_Cutoff_mV
+    {3411, 467, varBOOL},        // RunningLightsAlwaysOn
+    {3412, 468, varUINT8},        // RunningLightsDimLevelPct
+    {3413, 469, varBOOL},        // BrakesAutoOnAtStop
+    {3414, 470, varUINT16},        // AuxLightFlashTime_mS
+    {3415, 472, varUINT16},        // AuxLightBlinkOnTime_mS
+    {3416, 474, varUINT16},        // AuxLightBlinkOffTime_mS
+    {3417, 476, varUINT8},        // AuxLightPresetDim
+    {3418, 477, varUINT8},        // MGLightBlink_mS
+    {3419, 478, varBOOL},        // FlashLightsWhenSignalLost
+    {3420, 479, varBOOL},        // HiFlashWithCannon
+    {3421, 480, varBOOL},        // AuxFlashWithCannon
+    {9011, 481, varBOOL},        // PrintDebug
+    {9999, 482, varUINT32}        // InitStamp
 };
 
 
@@ -488,6 +488,29 @@ enum _trigger_source : byte {
 typedef void(*void_FunctionPointer_uint16)(uint16_t);
 
 
+// Analog Trigger Dispatch
+//------------------------------------------------------------------------------------------------------------------------------------------------------------->>
+// A knob or potentiometer held still still wobbles by a count or two, and passing every wobble on to the function means a serial command to the sound card or
+// a new PWM or servo setting for nothing. So the sketch remembers the last value passed to each analog trigger slot, and only passes a new one straight away
+// if it differs by at least the function's threshold (or is the end of the range). A smaller change is held until the input has stopped changing for
+// ANALOG_SF_SETTLE_mS, then passed on, so the function always ends up with the value the input actually settled at. See SF_AnalogTrigger() in the
+// SpecFunctions tab of the sketch.
+#define ANALOG_SF_SETTLE_mS                 200     // How long the input must hold still before a change smaller than the threshold is passed on
+#define ANALOG_SF_THRESHOLD_DEFAULT         1       // Any change - user functions, and anything not listed in AnalogFunctionThreshold()
+#define ANALOG_SF_THRESHOLD_SERVO           2       // Servo pass-through and pan. About 2 uS of servo pulse.
+#define ANALOG_SF_THRESHOLD_PWM             4       // Outputs with 8-bit PWM resolution (smoker, motors A & B, aux light level). Anything less can't change the output.
+#define ANALOG_SF_THRESHOLD_PERCENT         10      // Settings on a 1-100 scale (barrel stabilization and hill physics sensitivity)
+#define ANALOG_SF_THRESHOLD_VOLUME          31      // 3 percent. Each volume change is a serial command to the sound card.
+#define ANALOG_SF_NONE                      0xFFFF  // Nothing has been passed to the function yet
+
+typedef struct analog_trigger_state
+{
+    uint16_t lastValue;                     // The last value passed to the function
+    uint16_t pendingValue;                  // The latest value that was too close to lastValue to pass on straight away. Equal to lastValue if there isn't one.
+    uint16_t pendingSince;                  // Low 16 bits of millis() when pendingValue last changed
+};
+
+
 
 
 #endif
@@ -0,0 +1,270 @@
+/* OP_I2C.cpp       Open Panzer I2C - a non-blocking, interrupt-driven I2C (TWI) master
+ * Source:          openpanzer.org
+ * Authors:         Luke Middleton
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "OP_I2C.h"
+
+
+// TWCR values. Every write to TWCR that has TWINT set tells the hardware to carry on with the next step.
+#define TWCR_IDLE               (_BV(TWEN) | _BV(TWIE))
+#define TWCR_NEXT               (_BV(TWEN) | _BV(TWIE) | _BV(TWINT))            // Send/receive the next byte, NACK it if receiving
+#define TWCR_ACK                (TWCR_NEXT | _BV(TWEA))                         // Receive the next byte and ACK it
+#define TWCR_START              (TWCR_NEXT | _BV(TWSTA))
+#define TWCR_STOP               (TWCR_NEXT | _BV(TWSTO))
+#define TWCR_STOP_START         (TWCR_NEXT | _BV(TWSTO) | _BV(TWSTA))           // Stop, then start again straight away for the next transaction
+
+
+// Static variables must be declared outside the class
+i2c_transaction     OP_I2C::Queue[I2C_QUEUE_SIZE];
+uint8_t             OP_I2C::Head;
+uint8_t             OP_I2C::Tail;
+volatile boolean    OP_I2C::Busy;
+volatile uint8_t    OP_I2C::Index;
+volatile boolean    OP_I2C::Reading;
+volatile uint32_t   OP_I2C::StartTime;
+uint16_t            OP_I2C::Errors;
+uint16_t            OP_I2C::Recoveries;
+
+
+void OP_I2C::begin(uint32_t frequency)
+{
+    byte sregRestore = SREG;
+    cli();
+        // The Adafruit breakout boards have their own 10k pullups, the internal pullups are just a backup in case whatever is attached doesn't
+        I2C_DDR &= ~(_BV(I2C_SCL_BIT) | _BV(I2C_SDA_BIT));
+        I2C_PORT |= (_BV(I2C_SCL_BIT) | _BV(I2C_SDA_BIT));
+
+        TWSR = 0;                                           // Prescaler 1
+        TWBR = ((F_CPU / frequency) - 16) / 2;              // SCL = F_CPU / (16 + 2 * TWBR)
+        TWCR = TWCR_IDLE;
+
+        for (uint8_t i = 0; i < I2C_QUEUE_SIZE; i++) Queue[i].status = I2C_EMPTY;
+        Head = Tail = 0;
+        Busy = false;
+    SREG = sregRestore;
+}
+
+int8_t OP_I2C::read(uint8_t address, uint8_t reg, uint8_t *buf, uint8_t len)
+{
+    int8_t handle = I2C_NO_HANDLE;
+
+    if (len == 0) return I2C_NO_HANDLE;
+
+    byte sregRestore = SREG;
+    cli();
+        if (Queue[Tail].status == I2C_EMPTY)
+        {
+            handle = Tail;
+            Queue[Tail].address = address;
+            Queue[Tail].reg = reg;
+            Queue[Tail].readLen = len;
+            Queue[Tail].readBuf = buf;
+            Queue[Tail].status = I2C_QUEUED;
+            if (++Tail >= I2C_QUEUE_SIZE) Tail = 0;
+            if (!Busy) startNext(TWCR_START);
+        }
+    SREG = sregRestore;
+
+    return handle;
+}
+
+int8_t OP_I2C::write(uint8_t address, uint8_t reg, uint8_t value)
+{
+    int8_t handle = I2C_NO_HANDLE;
+
+    byte sregRestore = SREG;
+    cli();
+        if (Queue[Tail].status == I2C_EMPTY)
+        {
+            handle = Tail;
+            Queue[Tail].address = address;
+            Queue[Tail].reg = reg;
+            Queue[Tail].value = value;
+            Queue[Tail].readLen = 0;
+            Queue[Tail].status = I2C_QUEUED;
+            if (++Tail >= I2C_QUEUE_SIZE) Tail = 0;
+            if (!Busy) startNext(TWCR_START);
+        }
+    SREG = sregRestore;
+
+    return handle;
+}
+
+void OP_I2C::release(int8_t handle)
+{
+    // Only a finished transaction can be released. The ISR never touches a slot once it is done, so no need to disable interrupts.
+    if (handle >= 0 && done(handle)) Queue[handle].status = I2C_EMPTY;
+}
+
+uint8_t OP_I2C::wait(int8_t handle)
+{
+    while (!done(handle)) update();
+    return status(handle);
+}
+
+// Start the transaction at the head of the queue if there is one waiting. twcr is what to write to TWCR to kick it off, a plain start if the
+// bus is idle, or a stop followed by a start if we are moving straight on from another transaction. Returns false if there was nothing to start.
+boolean OP_I2C::startNext(uint8_t twcr)
+{
+    if (Queue[Head].status != I2C_QUEUED) return false;
+
+    Queue[Head].status = I2C_ACTIVE;
+    Index = 0;
+    Reading = false;
+    Busy = true;
+    StartTime = micros();
+    TWCR = twcr;
+    return true;
+}
+
+// Mark the active transaction finished and move on to the next one, or release the bus if there isn't one
+void OP_I2C::finish(uint8_t status)
+{
+    Queue[Head].status = status;
+    if (status != I2C_DONE) Errors++;
+    if (++Head >= I2C_QUEUE_SIZE) Head = 0;
+    Busy = false;
+    if (!startNext(TWCR_STOP_START)) TWCR = TWCR_STOP;
+}
+
+void OP_I2C::update(void)
+{
+    boolean hung;
+
+    // The ISR can't take more than a few uS to move from one step to the next, so if the transaction has been running this long the bus is stuck
+    byte sregRestore = SREG;
+    cli();
+        hung = Busy && ((micros() - StartTime) > I2C_TIMEOUT_uS);
+        if (hung) TWCR = 0;                                 // Take the TWI off the pins (and stop its interrupt) so we can work them by hand
+    SREG = sregRestore;
+
+    if (!hung) return;
+
+    recoverBus();
+
+    sregRestore = SREG;
+    cli();
+        Recoveries++;
+        Errors++;
+        Queue[Head].status = I2C_ERROR_TIMEOUT;
+        if (++Head >= I2C_QUEUE_SIZE) Head = 0;
+        Busy = false;
+        TWCR = TWCR_IDLE;
+        startNext(TWCR_START);
+    SREG = sregRestore;
+}
+
+// A slave that was reset or browned out part way through sending us a byte can be left holding SDA low, waiting for clocks that will never come.
+// Clock SCL by hand until it lets go (it will have after at most 9 clocks, the rest of its byte plus the ACK), then send a stop so it starts over.
+// At about 100 kHz this takes ~100 uS. We only get here after a timeout, so nothing is waiting on the bus anyway.
+void OP_I2C::recoverBus(void)
+{
+    // To pull a line low, turn off its pullup and make it an output (PORT is already low). To let it go, make it an input again and turn the pullup back on.
+    for (uint8_t i = 0; i < I2C_RECOVERY_CLOCKS && !(I2C_PIN & _BV(I2C_SDA_BIT)); i++)
+    {
+        I2C_PORT &= ~_BV(I2C_SCL_BIT);  I2C_DDR |= _BV(I2C_SCL_BIT);
+        delayMicroseconds(5);
+        I2C_DDR &= ~_BV(I2C_SCL_BIT);   I2C_PORT |= _BV(I2C_SCL_BIT);
+        delayMicroseconds(5);
+    }
+
+    // With SCL released, pull SDA low and let it go again. That is a start followed by a stop, which resets the slave's state machine.
+    I2C_PORT &= ~_BV(I2C_SDA_BIT);  I2C_DDR |= _BV(I2C_SDA_BIT);
+    delayMicroseconds(5);
+    I2C_DDR &= ~_BV(I2C_SDA_BIT);   I2C_PORT |= _BV(I2C_SDA_BIT);
+    delayMicroseconds(5);
+}
+
+
+// The hardware sets TWINT and calls this after every step of a transaction. The status register tells us what just happened. Nothing happens on the
+// bus until we write TWCR (with TWINT set) again.
+ISR(TWI_vect)
+{
+    OP_I2C::TWI_ISR();
+}
+
+void OP_I2C::TWI_ISR(void)
+{
+    if (!Busy)
+    {   // Shouldn't happen, but if it does make sure we don't just keep coming back here
+        TWCR = TWCR_STOP;
+        return;
+    }
+
+    i2c_transaction &t = Queue[Head];
+
+    switch (TW_STATUS)
+    {
+        case TW_START:                  // Start sent, now the slave address
+        case TW_REP_START:
+            TWDR = (t.address << 1) | (Reading ? TW_READ : TW_WRITE);
+            TWCR = TWCR_NEXT;
+            break;
+
+        case TW_MT_SLA_ACK:             // Slave answered, send the register
+            TWDR = t.reg;
+            Index = 1;
+            TWCR = TWCR_NEXT;
+            break;
+
+        case TW_MT_DATA_ACK:            // Byte written
+            if (t.readLen)
+            {   // That was the register, now a repeated start to read from it
+                Reading = true;
+                Index = 0;
+                TWCR = TWCR_START;
+            }
+            else if (Index == 1)
+            {   // That was the register, now the value
+                TWDR = t.value;
+                Index = 2;
+                TWCR = TWCR_NEXT;
+            }
+            else finish(I2C_DONE);      // That was the value
+            break;
+
+        case TW_MR_SLA_ACK:             // Slave answered, start reading. ACK every byte but the last, which tells the slave we're done.
+            TWCR = (t.readLen > 1) ? TWCR_ACK : TWCR_NEXT;
+            break;
+
+        case TW_MR_DATA_ACK:            // Byte read, and more to come
+            t.readBuf[Index++] = TWDR;
+            TWCR = (Index < (t.readLen - 1)) ? TWCR_ACK : TWCR_NEXT;
+            break;
+
+        case TW_MR_DATA_NACK:           // Last byte read
+            t.readBuf[Index++] = TWDR;
+            finish(I2C_DONE);
+            break;
+
+        case TW_MT_SLA_NACK:
+        case TW_MR_SLA_NACK:
+            finish(I2C_ERROR_NACK_ADDR);
+            break;
+
+        case TW_MT_DATA_NACK:
+            finish(I2C_ERROR_NACK_DATA);
+            break;
+
+        case TW_MT_ARB_LOST:            // Same code as TW_MR_ARB_LOST. We are the only master so this means noise on the bus.
+        case TW_BUS_ERROR:              // Illegal start or stop. A stop is what the datasheet says to send to recover from this.
+        default:
+            finish(I2C_ERROR_BUS);
+            break;
+    }
+}
@@ -0,0 +1,117 @@
+/* OP_I2C.h         Open Panzer I2C - a non-blocking, interrupt-driven I2C (TWI) master
+ * Source:          openpanzer.org
+ * Authors:         Luke Middleton
+ *
+ * The Arduino Wire library waits in a loop for every byte of every transaction, and it does some of that waiting inside its own ISR. While it waits
+ * nothing else in the main loop gets done, and while it waits inside the ISR nothing else can interrupt either, which is why the IMU was disabled.
+ *
+ * This library lets the TWI hardware do the work. The sketch queues a transaction (write a register, or read some number of bytes starting at a register)
+ * and gets back a handle. Every step of the transaction (start, address, each data byte, stop) is driven from the TWI interrupt, which only ever does a
+ * few register reads and writes before returning. When one transaction finishes the ISR starts the next one in the queue straight away. The sketch polls
+ * done() on its handle from the main loop, reads the result, and then release()s the handle so the slot can be used again.
+ *
+ * If a slave holds the bus (which is what happens if it gets reset or loses power part way through a transaction), the TWI hardware waits forever and
+ * no more interrupts come. update() should be called every time through the main loop; if a transaction has been running for longer than I2C_TIMEOUT_uS
+ * it fails the transaction, clocks the bus by hand until the slave lets go of SDA, and starts the next transaction in the queue. This is the only time
+ * anything in here waits, roughly 100 uS, and only after something has already gone wrong.
+ *
+ * I2C is on Arduino pins 20 (SDA) and 21 (SCL), ATmega PD1 and PD0.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OP_I2C_H
+#define OP_I2C_H
+
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include <util/twi.h>
+
+
+#define I2C_FREQUENCY           400000UL    // Fast mode
+#define I2C_QUEUE_SIZE          4           // Number of transactions that can be queued at once
+#define I2C_TIMEOUT_uS          5000        // A 16 byte read at 400 kHz takes about 450 uS, so this is plenty
+#define I2C_RECOVERY_CLOCKS     9           // Clocking SCL this many times frees a slave that is part way through sending a byte
+
+// Pins, for bus recovery
+#define I2C_PORT                PORTD
+#define I2C_DDR                 DDRD
+#define I2C_PIN                 PIND
+#define I2C_SCL_BIT             PD0         // Arduino pin 21
+#define I2C_SDA_BIT             PD1         // Arduino pin 20
+
+// Transaction status
+#define I2C_EMPTY               0           // Slot not in use
+#define I2C_QUEUED              1           // Waiting for the transactions ahead of it
+#define I2C_ACTIVE              2           // On the bus now
+#define I2C_DONE                3           // Finished successfully. Anything from here up means the transaction is over.
+#define I2C_ERROR_NACK_ADDR     4           // Nothing answered to the slave address
+#define I2C_ERROR_NACK_DATA     5           // Slave refused a byte we wrote
+#define I2C_ERROR_BUS           6           // Illegal start/stop on the bus, lost arbitration, or a status we didn't expect
+#define I2C_ERROR_TIMEOUT       7           // Bus hung, see update()
+
+#define I2C_NO_HANDLE           -1          // Returned when the queue is full
+
+
+typedef struct {
+    volatile uint8_t status;                // One of the statuses above
+    uint8_t address;                        // 7-bit slave address
+    uint8_t reg;                            // Register to write to or start reading from
+    uint8_t value;                          // Byte to write, for writes
+    uint8_t readLen;                        // Bytes to read, 0 for a write
+    uint8_t *readBuf;                       // Where to put them
+} i2c_transaction;
+
+
+class OP_I2C
+{
+    public:
+        OP_I2C(void) {}
+        static void     begin(uint32_t frequency = I2C_FREQUENCY);
+
+        // Queue a transaction. These return a handle, or I2C_NO_HANDLE if the queue is full. The buffer for a read must stay valid until it is done.
+        static int8_t   read(uint8_t address, uint8_t reg, uint8_t *buf, uint8_t len);
+        static int8_t   write(uint8_t address, uint8_t reg, uint8_t value);
+
+        static uint8_t  status(int8_t handle)           { return (handle < 0) ? I2C_ERROR_BUS : Queue[handle].status; }
+        static boolean  done(int8_t handle)             { return status(handle) >= I2C_DONE; }
+        static boolean  successful(int8_t handle)       { return status(handle) == I2C_DONE; }
+        static void     release(int8_t handle);         // Call once you have the result, to free the slot
+        static uint8_t  wait(int8_t handle);            // Blocks until the transaction is over and returns its status. Only for use in setup()!
+
+        static void     update(void);                   // Call every time through the main loop, this catches a hung bus
+        static uint16_t errorCount(void)                { return Errors; }
+        static uint16_t recoveryCount(void)             { return Recoveries; }
+
+        static void     TWI_ISR(void);                  // The actual ISR calls this so it can get at the class variables
+
+    private:
+        static boolean  startNext(uint8_t twcr);        // Start the next queued transaction, if there is one. Interrupts must be off.
+        static void     finish(uint8_t status);         // Finish the active transaction and move on. Interrupts must be off.
+        static void     recoverBus(void);
+
+        static i2c_transaction Queue[I2C_QUEUE_SIZE];
+        static uint8_t  Head;                           // Oldest transaction, the one on the bus if we are busy
+        static uint8_t  Tail;                           // Where the next one will be queued
+        static volatile boolean Busy;
+        static volatile uint8_t Index;                  // Bytes of the active transaction written or read so far
+        static volatile boolean Reading;                // Active transaction is past the repeated start and reading
+        static volatile uint32_t StartTime;             // micros() when the active transaction started
+        static uint16_t Errors;
+        static uint16_t Recoveries;
+};
+
+
+#endif
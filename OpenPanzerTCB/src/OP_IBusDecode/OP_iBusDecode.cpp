@@ -44,6 +44,9 @@ decodeState_t           iBusDecode::State;                              // The c
 boolean                 iBusDecode::NewFrame;                           // Boolean variable to indicate a new complete PPM frame has arrived or been read. 
 uint8_t                 iBusDecode::frameCount;                         // 
 uint8_t                 iBusDecode::framesToDiscard;                    // How many frames to skip for every one read
+uint16_t                iBusDecode::LastByteTicks;                      // Timer 1 count when the last byte arrived
+uint32_t                iBusDecode::LastByteTime;                       // millis() when the last byte arrived
+uint32_t                iBusDecode::LastFrameTime;                      // millis() when the last complete, valid frame arrived
 
 // Constructor
 iBusDecode::iBusDecode(){}
@@ -88,13 +91,12 @@ void iBusDecode::begin()
     iBus_UCSRB = 0x90;                  // Rx interrupt enabled, Rx enabled, TX disabled, only 8 bits
 
     // Timer 1 
-    // iBusDecode uses Timer 1 Compare C (OCR1C). Timer 1 is setup in the main sketch, using a macro defined in OP_Settings.h
-    // We can set OCR1C to some time in the future, and the OCF1C flag (Output Compare match flag) of the TIFR1 (Timer 1 Interrupt Flag Register)
-    // will get set when that time is reached. We can use this flag to determine if the timing of our incoming pulse stream is correct. 
-    // Note: you could also set an interrupt to occur when this flag is set, which is a frequent application, but we do not need it here! 
-    // NOTE: Even worse, if you enable the output compare interrupt but do not specify an ISR, the IDE will NOT warn you about it, but will go off
-    // and choose an ISR maybe defined somewhere else in some unrelated library or who knows, and you will get all kinds of random and inexplicable behavior!
-    // Don't ask us how many countless hours we spent trying to troubleshoot this one! 
+    // iBusDecode reads Timer 1 (TCNT1) to measure the time between incoming bytes. Timer 1 is setup in the main sketch, using a macro defined in OP_Settings.h
+    // We used to set Timer 1 Compare C (OCR1C) some time in the future and poll its match flag, but Compare C is now used by OP_TaigenSound. 
+    // Because TCNT1 rolls over every 32.7 mS we also keep the millis() time of the last byte, so a long silence is never mistaken for a short one. 
+    LastByteTicks = TCNT1;
+    LastByteTime = millis();
+    LastFrameTime = LastByteTime;                       // Start the frame age from now, so the radio class doesn't see a stale signal before we've had a chance to acquire
 
     // Other initializations
     State = NOT_SYNCHED_state;                          // Decoder not yet synched
@@ -144,10 +146,10 @@ uint16_t temp;
     {
         UART_error = iBus_UCSRA & 0x1C;                 // Save error
         b = _serial->read();                            // Get data from serial Rx 
-        TimeFlag = TIFR1 & (1 << OCF1C );               // Save the  Compare C flag. If 1, it means our set amount of time has been exceeded since last char. 
-                                                        // This may be good or bad depending, we will check below.
-        TIFR1 |= (1 << OCF1C );                         // Reset the compare flag 
-        OCR1C = TCNT1 + iBus_MIN_TICKS_BEFORE_START;    // Flag again 3.5mS from now
+        TimeFlag = ((uint16_t)(TCNT1 - LastByteTicks) >= iBus_MIN_TICKS_BEFORE_START) ||     // Save the gap flag. If true, it means our set amount of time has been exceeded since last char. 
+                   ((millis() - LastByteTime) > 30);                                    // This may be good or bad depending, we will check below.
+        LastByteTicks = TCNT1;                                                          // Start timing again for the next byte
+        LastByteTime = millis();
     
         if ( UART_error )   
         {   
@@ -217,6 +219,7 @@ uint16_t temp;
                             }
                             else    // No iBus error, checksums match                        
                             {                       
+                                LastFrameTime = millis();                   // Stamp every valid frame, even the ones we discard below. The radio class uses the age of this to decide when the signal has been lost
                                 if ( State == ACQUIRING_state)  
                                 {   // If we are in ACQUIRING_state we have been collecting channel data. We keep collecting until we have ACQUISITION count of frames under our belt.
                                     // We are only in Acquiring state once - when the program first boots. After that we will only be either READY or FAILSAFE
@@ -156,6 +156,7 @@ class iBusDecode
         uint8_t                 getChanCount(void);             // Channel count - will always return iBus_CHANNELS
         void                    GetiBus_Frame(int16_t pulseArray[], int16_t chanCount);  // Copy a complete frame of pulses 
         static boolean          NewFrame;                       // Has an unread frame of data arrived? 
+        uint32_t                getLastFrameTime(void) { return LastFrameTime; }    // millis() time when the last complete, valid frame arrived (discarded or not)
         void                    update(void);
         void                    slowDownForPCComm(void);        // Adjust on the fly how many frames we choose to discard, this will set it to IBUS_PCCOMM_DISCARD_FRAMES
         void                    defaultSpeed(void);             // Revert to the default number of discarded frames IBUS_DEFAULT_DISCARD_FRAMES
@@ -170,6 +171,9 @@ class iBusDecode
         static decodeState_t    State;                          // The current state
         static uint8_t          frameCount;                     // Used to keep track of frames for the purpose of discarding some
         static uint8_t          framesToDiscard;                // How many frames to discard for each frame we read
+        static uint16_t         LastByteTicks;                  // Timer 1 count when the last byte was received
+        static uint32_t         LastByteTime;                   // millis() time when the last byte was received (in case TCNT1 has rolled over since)
+        static uint32_t         LastFrameTime;                  // millis() time when the last complete, valid frame was received
 };
 
 
@@ -28,9 +28,15 @@
 #define NUM_IO_PORTS    2
 #define IO_PULSE_TIME   300     // Time in milliseconds to pulse the IO port if set to output and the user triggers the pulse function
 
+// Input data types
+#define IO_INPUT_ANALOG     0
+#define IO_INPUT_DIGITAL    1
+#define IO_INPUT_ENCODER    2   // Pulses from a wheel encoder are counted for closed-loop track speed (see OP_TrackSpeed). Port A is the left track, B the right. 
+                                // Only used if both ports are set this way, and the port can't also trigger functions. 
+
 typedef struct external_io_settings{
     uint8_t dataDirection;  // 1 = output, 0 = input
-    uint8_t dataType;       // If input, 1 = "digital" (on/off only), 0 = analog (variable), default to digital. If Output, 1 = normally high, 0 = normally low, default normally high.
+    uint8_t dataType;       // If input, 1 = "digital" (on/off only), 0 = analog (variable), 2 = wheel encoder, default to digital. If Output, 1 = normally high, 0 = normally low, default normally high.
 };
 
 typedef struct external_io{
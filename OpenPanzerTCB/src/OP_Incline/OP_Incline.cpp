@@ -0,0 +1,107 @@
+/* OP_Incline.cpp   Open Panzer Incline - barrel stabilization and hill physics from the pitch measured by the IMU
+ * Source:          openpanzer.org
+ * Authors:         Luke Middleton
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "OP_Incline.h"
+
+
+// Static variables must be declared outside the class
+int32_t           OP_Incline::BarrelGain = 0;
+int16_t           OP_Incline::BarrelMin = 1000;
+int16_t           OP_Incline::BarrelMax = 2000;
+int16_t           OP_Incline::ReferencePitch = 0;
+int16_t           OP_Incline::ReferencePosition = 1500;
+int16_t           OP_Incline::BarrelPosition = 1500;
+uint16_t          OP_Incline::HillGain = 0;
+int16_t           OP_Incline::HillPitchLimit = 1;
+int16_t           OP_Incline::HillAdjust = 0;
+
+
+void OP_Incline::setBarrelScale(uint8_t sensitivity, int16_t epMin, int16_t epMax, boolean reversed)
+{
+    // The pitch range is 99 degrees either side of level at sensitivity 1, down to 1 degree at 99. Larger numbers are more sensitive. 100 would be a
+    // range of zero, so that is treated as 99.
+    if (sensitivity > 99) sensitivity = 99;
+    uint8_t range = 100 - sensitivity;
+
+    if (epMin > epMax) { int16_t t = epMin; epMin = epMax; epMax = t; }
+    BarrelMin = epMin;
+    BarrelMax = epMax;
+
+    // The full servo travel across twice the range, in 1/16ths: (epMax - epMin) / (2 * range * 16) uS per step, times 4096 for Q12, rounded
+    int32_t gain = (((int32_t)(epMax - epMin) << INCLINE_GAIN_SHIFT) + (range * INCLINE_LSB_PER_DEGREE)) / ((int32_t)range * 2 * INCLINE_LSB_PER_DEGREE);
+    BarrelGain = reversed ? -gain : gain;
+}
+
+void OP_Incline::setHillScale(uint8_t sensitivity)
+{
+    // Full adjustment at 119 degrees at sensitivity 1, down to 20 degrees at 100
+    if (sensitivity > 100) sensitivity = 100;
+    uint8_t range = 120 - sensitivity;
+
+    HillPitchLimit = (int16_t)range * INCLINE_LSB_PER_DEGREE;
+    HillGain = (((int32_t)HILL_MAX_ADJUST_uS << INCLINE_GAIN_SHIFT) + (HillPitchLimit / 2)) / HillPitchLimit;
+}
+
+void OP_Incline::setBarrelReference(int16_t pitch, int16_t position)
+{
+    ReferencePitch = pitch;
+    ReferencePosition = position;
+    BarrelPosition = position;
+}
+
+boolean OP_Incline::updateBarrel(int16_t pitch)
+{
+    // The barrel moves opposite to the tank: as the nose goes up (pitch increases) the barrel has to come down relative to the hull by the same angle.
+    // Add half before the shift so it rounds rather than truncates. Gain times a full 360 degrees of pitch change still fits in 32 bits.
+    int32_t correction = (BarrelGain * (ReferencePitch - pitch) + (1 << (INCLINE_GAIN_SHIFT - 1))) >> INCLINE_GAIN_SHIFT;
+    int32_t target = ReferencePosition + correction;
+    if (target < BarrelMin)      target = BarrelMin;
+    else if (target > BarrelMax) target = BarrelMax;
+
+    if (abs((int16_t)target - BarrelPosition) <= BARREL_STAB_DEADBAND_uS) return false;
+
+    BarrelPosition = rateLimit(BarrelPosition, (int16_t)target, BARREL_STAB_MAX_STEP_uS);
+    return true;
+}
+
+boolean OP_Incline::updateHill(int16_t pitch)
+{
+    int16_t target = 0;
+    uint16_t magnitude = abs(pitch);
+
+    if (magnitude > HILL_DEADBAND)
+    {
+        if (magnitude > (uint16_t)HillPitchLimit) magnitude = HillPitchLimit;
+        uint16_t adjust = ((uint32_t)magnitude * HillGain + (1 << (INCLINE_GAIN_SHIFT - 1))) >> INCLINE_GAIN_SHIFT;
+        if (adjust > HILL_MAX_ADJUST_uS) adjust = HILL_MAX_ADJUST_uS;   // Rounding of the gain could take it a uS or so over
+        target = (pitch > 0) ? (int16_t)adjust : -(int16_t)adjust;
+    }
+
+    if (target == HillAdjust) return false;
+
+    HillAdjust = rateLimit(HillAdjust, target, HILL_MAX_STEP_uS);
+    return true;
+}
+
+int16_t OP_Incline::rateLimit(int16_t current, int16_t target, int16_t maxStep)
+{
+    if (target > current + maxStep) return current + maxStep;
+    if (target < current - maxStep) return current - maxStep;
+    return target;
+}
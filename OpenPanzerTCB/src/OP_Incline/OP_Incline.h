@@ -0,0 +1,99 @@
+/* OP_Incline.h     Open Panzer Incline - barrel stabilization and hill physics from the pitch measured by the IMU
+ * Source:          openpanzer.org
+ * Authors:         Luke Middleton
+ *
+ * Both features work off the same thing, the pitch of the tank as read by the IMU (see OP_BNO055), and both run once per IMU sample, which the sketch
+ * requests at a fixed rate (INCLINE_SAMPLE_PERIOD_mS).
+ *
+ * Barrel stabilization: when the user stops moving the barrel we record the pitch of the tank and the position of the barrel servo. From then on, as the
+ * tank pitches up or down, the barrel servo is moved the other way by the same angle so the barrel stays pointed where the user left it. How many uS of
+ * servo pulse equal one degree of pitch depends on the linkage, which is what the user's sensitivity setting is for. The sensitivity (1-100) sets the
+ * range of pitch, 99 down to 1 degrees either side of level, that is mapped across the full travel of the barrel servo.
+ *
+ * Hill physics: the tank slows going uphill and speeds up going downhill. We do this by moving the end-point of the throttle channel, so the same stick
+ * position gives a lesser or greater speed. The sensitivity setting sets the pitch, 119 down to 20 degrees, at which the adjustment reaches its maximum
+ * of HILL_MAX_ADJUST_uS.
+ *
+ * Everything is integer. The two scale factors (uS per 1/16th of a degree) are worked out once, when a sensitivity or end-point changes, and stored as
+ * Q12 fixed point (multiples of 1/4096). After that each update is a multiply, a shift and a few compares. Each output also has a deadband, so sensor noise
+ * doesn't keep the servo or the throttle hunting, and a rate limit, so a single bad reading or a sharp bump can't snap the barrel or lurch the tank.
+ * 
+ * Cost per sample, ESTIMATED by counting instructions rather than measured on the board: about 150 cycles for the barrel (one 32-bit multiply) and 100 for 
+ * the hill, so roughly 15 uS at 16 MHz, against something like 3000 cycles for the float code this replaced (two mapf calls and a divide, all soft-float). 
+ * test/host/test_incline.cpp checks the results against a float model of the old code, but it runs on the PC so it can't confirm the cycle counts. 
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OP_INCLINE_H
+#define OP_INCLINE_H
+
+#include <Arduino.h>
+
+
+#define INCLINE_SAMPLE_PERIOD_mS        20      // Both loops run once per IMU sample, 50 times a second. The rate limits below are per sample.
+#define INCLINE_LSB_PER_DEGREE          16      // Pitch is passed in 1/16ths of a degree, as the BNO055 gives it to us
+#define INCLINE_GAIN_SHIFT              12      // Scale factors are Q12, multiples of 1/4096 uS per 1/16th degree. Q8 would be out by up to 4 uS.
+
+#define BARREL_STAB_DEADBAND_uS         3       // Corrections this small are left alone, hobby servos won't reliably move this little anyway
+#define BARREL_STAB_MAX_STEP_uS         25      // Most the barrel is moved in one sample. 1250 uS per second, full travel in under a second.
+
+#define HILL_DEADBAND                   (1 * INCLINE_LSB_PER_DEGREE)    // Pitch within a degree of level counts as level
+#define HILL_MAX_ADJUST_uS              400     // Most the throttle end-point is moved
+#define HILL_MAX_STEP_uS                10      // Most the end-point is moved in one sample. 500 uS per second, full adjustment in 0.8 seconds.
+
+
+class OP_Incline
+{
+    public:
+        OP_Incline(void) {}
+
+        // Call these at startup, and again whenever the sensitivity or the barrel servo end-points change. This is where the division is.
+        static void     setBarrelScale(uint8_t sensitivity, int16_t epMin, int16_t epMax, boolean reversed);
+        static void     setHillScale(uint8_t sensitivity);
+
+        // Barrel stabilization. Call setBarrelReference() at the first sample after the user stops moving the barrel, with the position the servo stopped at.
+        // After that call updateBarrel() with each sample. It returns true if the barrel should be moved, to barrelPosition().
+        static void     setBarrelReference(int16_t pitch, int16_t position);
+        static boolean  updateBarrel(int16_t pitch);
+        static int16_t  barrelPosition(void)            { return BarrelPosition; }
+
+        // Hill physics. Call updateHill() with each sample, it returns true if the adjustment has changed. The adjustment is in uS and has the same sign
+        // as the pitch: add it to the throttle end-point in the direction of travel.
+        static boolean  updateHill(int16_t pitch);
+        static int16_t  hillAdjust(void)                { return HillAdjust; }
+        static void     resetHill(void)                 { HillAdjust = 0; }
+
+        // The precomputed scale factors, Q12 uS per 1/16th degree
+        static int32_t  barrelGain(void)                { return BarrelGain; }
+        static uint16_t hillGain(void)                  { return HillGain; }
+
+    private:
+        static int16_t  rateLimit(int16_t current, int16_t target, int16_t maxStep);
+
+        static int32_t  BarrelGain;                     // Q12 uS of servo pulse per 1/16th degree of pitch. Negative if the servo is reversed. Up to 192,000.
+        static int16_t  BarrelMin;                      // Servo end-points
+        static int16_t  BarrelMax;
+        static int16_t  ReferencePitch;                 // Pitch of the tank when the user left the barrel
+        static int16_t  ReferencePosition;              // And where they left it
+        static int16_t  BarrelPosition;                 // Where we have put it since
+
+        static uint16_t HillGain;                       // Q12 uS of end-point adjustment per 1/16th degree of pitch. 860 to 5120.
+        static int16_t  HillPitchLimit;                 // Pitch (1/16th degree) at which the adjustment reaches HILL_MAX_ADJUST_uS
+        static int16_t  HillAdjust;
+};
+
+
+#endif
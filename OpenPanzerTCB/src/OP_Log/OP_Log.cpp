@@ -0,0 +1,221 @@
+/* OP_Log.cpp       Open Panzer Log - deferred debug messages
+ * Source:          openpanzer.org              
+ * Authors:         Luke Middleton
+ *   
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */ 
+
+#include "OP_Log.h"
+
+// Message text. The order must match the log_message enum in OP_Log.h
+const char _logmsg_00[] PROGMEM = "RADIO FAILSAFE";
+const char _logmsg_01[] PROGMEM = "Failsafe recovery: %u uS";
+const char _logmsg_02[] PROGMEM = "Turn Engine On";
+const char _logmsg_03[] PROGMEM = "Turn Engine Off";
+const char _logmsg_04[] PROGMEM = "Engine Auto Shutdown";
+const char _logmsg_05[] PROGMEM = "Engage Transmission";
+const char _logmsg_06[] PROGMEM = "Disengage Transmission";
+const char _logmsg_07[] PROGMEM = "Fire Cannon";
+const char _logmsg_08[] PROGMEM = "Fire Repair Signal";
+const char _logmsg_09[] PROGMEM = "MG Start";
+const char _logmsg_10[] PROGMEM = "MG Stop";
+const char _logmsg_11[] PROGMEM = "CANNON HIT! (%S%S)";
+const char _logmsg_12[] PROGMEM = "MACHINE GUN HIT! (%S)";
+const char _logmsg_13[] PROGMEM = "VEHICLE REPAIR STARTED (%S)";
+const char _logmsg_14[] PROGMEM = "REPAIR OPERATION CANCELLED";
+const char _logmsg_15[] PROGMEM = "VEHICLE REPAIR COMPLETE";
+const char _logmsg_16[] PROGMEM = "Health Level: %d%%";
+const char _logmsg_17[] PROGMEM = "TANK DESTROYED";
+const char _logmsg_18[] PROGMEM = "TANK RESTORED";
+const char _logmsg_19[] PROGMEM = "Braking";
+const char _logmsg_20[] PROGMEM = "Moving Forward";
+const char _logmsg_21[] PROGMEM = "Moving Reverse";
+const char _logmsg_22[] PROGMEM = "Neutral Turn";
+const char _logmsg_23[] PROGMEM = "Stopped";
+const char _logmsg_24[] PROGMEM = "Light %u On";
+const char _logmsg_25[] PROGMEM = "Light %u Off";
+const char _logmsg_26[] PROGMEM = "Running Lights On";
+const char _logmsg_27[] PROGMEM = "Running Lights Off";
+const char _logmsg_28[] PROGMEM = "Aux Output On";
+const char _logmsg_29[] PROGMEM = "Aux Output Off";
+const char _logmsg_30[] PROGMEM = "Aux Output Preset Dim";
+const char _logmsg_31[] PROGMEM = "Aux Output Flashed";
+const char _logmsg_32[] PROGMEM = "Aux Output Inverse Flashed";
+const char _logmsg_33[] PROGMEM = "Start Aux Output Blinking";
+const char _logmsg_34[] PROGMEM = "Stop Aux Output Blinking";
+const char _logmsg_35[] PROGMEM = "Start Revolving Aux Light";
+const char _logmsg_36[] PROGMEM = "Stop Revolving Aux Light";
+const char _logmsg_37[] PROGMEM = "IO Port %S Output - On";
+const char _logmsg_38[] PROGMEM = "IO Port %S Output - Off";
+const char _logmsg_39[] PROGMEM = "LVC threshold reached! (%u.%uv)";
+const char _logmsg_40[] PROGMEM = "LVC Exit - Voltage Restored";
+const char _logmsg_41[] PROGMEM = "Driving Profile set to #%u";
+const char _logmsg_42[] PROGMEM = "Set Turn Mode: %u";
+const char _logmsg_43[] PROGMEM = "Enable Neutral Turns";
+const char _logmsg_44[] PROGMEM = "Disable Neutral Turns";
+const char _logmsg_45[] PROGMEM = "Set Accel Ramp Level: %u";
+const char _logmsg_46[] PROGMEM = "Set Decel Ramp Level: %u";
+const char _logmsg_47[] PROGMEM = "Set Barrel Sensitivity: %u%%";
+const char _logmsg_48[] PROGMEM = "Set Hill Sensitivity: %u%%";
+const char _logmsg_49[] PROGMEM = "%S - Manual Trigger";
+const char _logmsg_50[] PROGMEM = "%S - Enabled";
+const char _logmsg_51[] PROGMEM = "%S - Disabled";
+const char _logmsg_52[] PROGMEM = "Radio Ready - %S";
+const char _logmsg_53[] PROGMEM = "Comms changed to %S";
+const char _logmsg_54[] PROGMEM = "Barrel Stabilization: ON (Sensitivity %u)";
+const char _logmsg_55[] PROGMEM = "Barrel Stabilization: OFF";
+const char _logmsg_56[] PROGMEM = "Hill Physics: ON (Sensitivity %u)";
+const char _logmsg_57[] PROGMEM = "Hill Physics: OFF";
+const char _logmsg_58[] PROGMEM = "Smoker enabled";
+const char _logmsg_59[] PROGMEM = "Smoker disabled";
+const char _logmsg_60[] PROGMEM = "Set volume: %u%%";
+const char _logmsg_61[] PROGMEM = "User Sound %u";
+const char _logmsg_62[] PROGMEM = "User Sound %u - Start Repeating";
+const char _logmsg_63[] PROGMEM = "User Sound %u - Stop";
+const char _logmsg_64[] PROGMEM = "User Function %u";
+const char _logmsg_65[] PROGMEM = "Analog User Function %u - %u";
+const char _logmsg_66[] PROGMEM = "Debug buffer full - %u messages dropped";
+const char * const _logmsg_table_[LOG_NUM_MESSAGES] PROGMEM = 
+{   _logmsg_00, _logmsg_01, _logmsg_02, _logmsg_03, _logmsg_04, _logmsg_05, _logmsg_06, _logmsg_07, _logmsg_08, _logmsg_09, 
+    _logmsg_10, _logmsg_11, _logmsg_12, _logmsg_13, _logmsg_14, _logmsg_15, _logmsg_16, _logmsg_17, _logmsg_18, _logmsg_19, 
+    _logmsg_20, _logmsg_21, _logmsg_22, _logmsg_23, _logmsg_24, _logmsg_25, _logmsg_26, _logmsg_27, _logmsg_28, _logmsg_29, 
+    _logmsg_30, _logmsg_31, _logmsg_32, _logmsg_33, _logmsg_34, _logmsg_35, _logmsg_36, _logmsg_37, _logmsg_38, _logmsg_39, 
+    _logmsg_40, _logmsg_41, _logmsg_42, _logmsg_43, _logmsg_44, _logmsg_45, _logmsg_46, _logmsg_47, _logmsg_48, _logmsg_49, 
+    _logmsg_50, _logmsg_51, _logmsg_52, _logmsg_53, _logmsg_54, _logmsg_55, _logmsg_56, _logmsg_57, _logmsg_58, _logmsg_59, 
+    _logmsg_60, _logmsg_61, _logmsg_62, _logmsg_63, _logmsg_64, _logmsg_65, _logmsg_66 };
+
+
+// Static variables must be initialized outside the class 
+log_record  OP_Log::Buffer[LOG_BUFFER_SIZE];
+uint8_t     OP_Log::Head = 0;
+uint8_t     OP_Log::Tail = 0;
+uint8_t     OP_Log::Count = 0;
+char        OP_Log::Line[LOG_LINE_CHARS];
+uint8_t     OP_Log::LineLength = 0;
+uint16_t    OP_Log::Dropped = 0;
+uint16_t    OP_Log::DroppedReported = 0;
+
+
+void OP_Log::write(uint8_t id, int16_t a, int16_t b)
+{
+    if (id >= LOG_NUM_MESSAGES) return;
+    
+    if (Count >= LOG_BUFFER_SIZE) 
+    {   // No room. Don't wait, just count it.
+        if (Dropped < 0xFFFF) Dropped++;
+        return;
+    }
+    
+    // Messages are only written from the main loop (not from interrupts), so we don't need to disable interrupts here
+    Buffer[Head].ID = id;
+    Buffer[Head].Arg[0] = a;
+    Buffer[Head].Arg[1] = b;
+    if (++Head >= LOG_BUFFER_SIZE) Head = 0;
+    Count++;
+}
+
+boolean OP_Log::pending(void)
+{
+    return (Count > 0 || LineLength > 0 || Dropped != DroppedReported);
+}
+
+void OP_Log::update(HardwareSerial *port)
+{
+    log_record r;
+    
+    while (true)
+    {
+        // Done sending the last line, get the next one
+        if (LineLength == 0)
+        {
+            if (Count > 0)
+            {
+                format(Buffer[Tail]);
+                if (++Tail >= LOG_BUFFER_SIZE) Tail = 0;
+                Count--;
+            }
+            else if (Dropped != DroppedReported)
+            {   // Once the buffer has emptied out, let the user know some messages are missing
+                r.ID = LOG_OVERFLOW;
+                r.Arg[0] = Dropped - DroppedReported;
+                DroppedReported = Dropped;
+                format(r);
+            }
+            else return;    // Nothing to send
+        }
+        
+        // We only hand over a whole line at a time, and only if it fits in the transmit buffer right now. That way we never wait, 
+        // and anything else printed directly to the same port can't land in the middle of one of our lines. 
+        if (port->availableForWrite() < LineLength) return;
+        port->write((const uint8_t *)Line, LineLength);
+        LineLength = 0;
+    }
+}
+
+void OP_Log::flush(HardwareSerial *port)
+{
+    while (pending()) 
+    {
+        update(port);
+    }
+}
+
+void OP_Log::format(const log_record &r)
+{
+    const char *fmt = (const char *)pgm_read_word(&_logmsg_table_[r.ID]);
+    const char *s;
+    uint8_t arg = 0;
+    uint8_t n = 0;
+    char c;
+    const uint8_t maxText = LOG_LINE_CHARS - 2;     // Leave room for the line ending
+    
+    while ((c = pgm_read_byte(fmt++)) && n < maxText)
+    {
+        if (c != '%') { Line[n++] = c; continue; }
+        
+        c = pgm_read_byte(fmt++);
+        switch (c)
+        {
+            case 'd':
+            case 'u':
+                {
+                    char num[7];    // -32768 plus terminator
+                    if (c == 'd') itoa(r.Arg[arg], num, 10);
+                    else          utoa((uint16_t)r.Arg[arg], num, 10);
+                    for (uint8_t i=0; num[i] && n < maxText; i++) Line[n++] = num[i];
+                    arg++;
+                }
+                break;
+                
+            case 'S':
+                // A NULL (0) program memory string just prints nothing
+                s = (const char *)(uintptr_t)(uint16_t)r.Arg[arg++];
+                if (s) { while ((c = pgm_read_byte(s++)) && n < maxText) Line[n++] = c; }
+                break;
+                
+            case '%':
+                Line[n++] = '%';
+                break;
+                
+            default:                // Unknown, or the string ended right after the %
+                if (c == 0) fmt--;
+                break;
+        }
+    }
+    
+    Line[n++] = '\r';               // Same line ending as println()
+    Line[n++] = '\n';
+    LineLength = n;
+}
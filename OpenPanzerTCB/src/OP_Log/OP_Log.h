@@ -0,0 +1,142 @@
+/* OP_Log.h         Open Panzer Log - deferred debug messages
+ * Source:          openpanzer.org              
+ * Authors:         Luke Middleton
+ *   
+ * Printing debug text directly to the serial port blocks whenever the 64 byte HardwareSerial transmit buffer is full, which at 115200 baud 
+ * is about 87 uS per extra character. A burst of messages (a cannon hit, a change of drive mode) can hold up the main loop for several milliseconds. 
+ * 
+ * This class instead saves a small binary record for each message: a message number (see the table in OP_Log.cpp) and up to two integer 
+ * arguments. The records go into a ring buffer in RAM. update() should be called every time through the main loop, it turns one record at a time 
+ * into text and hands each line to the serial port only once the whole line fits in its transmit buffer, so it never waits. If messages arrive faster 
+ * than they can be sent, the newest are discarded and counted, never waited on. 
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */ 
+
+#ifndef OP_LOG_H
+#define OP_LOG_H
+
+#include <Arduino.h>
+#include "../OP_Settings/OP_Settings.h"
+
+
+#define LOG_BUFFER_SIZE     16              // How many messages can wait to be sent. Each takes 5 bytes of RAM. 
+#define LOG_LINE_CHARS      48              // Longest line of text a message can turn into, including the line ending. Must be less than the 64 byte serial transmit buffer.
+
+// Message numbers. These must be in the same order as the strings in the table in OP_Log.cpp. In the strings, 
+// %d prints an argument as a signed number, %u as an unsigned number, and %S as a string in program memory (eg, from F() or ptrIRName()). 
+enum log_message {
+    LOG_RADIO_FAILSAFE = 0,
+    LOG_FAILSAFE_RECOVERY,                  // %u uS
+    LOG_ENGINE_ON,
+    LOG_ENGINE_OFF,
+    LOG_ENGINE_AUTO_SHUTDOWN,
+    LOG_TRANSMISSION_ENGAGE,
+    LOG_TRANSMISSION_DISENGAGE,
+    LOG_FIRE_CANNON,
+    LOG_FIRE_REPAIR,
+    LOG_MG_START,
+    LOG_MG_STOP,
+    LOG_CANNON_HIT,                         // %S protocol, %S team
+    LOG_MG_HIT,                             // %S protocol
+    LOG_REPAIR_STARTED,                     // %S protocol
+    LOG_REPAIR_CANCELLED,
+    LOG_REPAIR_COMPLETE,
+    LOG_HEALTH_LEVEL,                       // %d percent
+    LOG_TANK_DESTROYED,
+    LOG_TANK_RESTORED,
+    LOG_BRAKING,
+    LOG_MOVING_FORWARD,
+    LOG_MOVING_REVERSE,
+    LOG_NEUTRAL_TURN,
+    LOG_STOPPED,
+    LOG_LIGHT_ON,                           // %u light number
+    LOG_LIGHT_OFF,                          // %u light number
+    LOG_RUNNING_LIGHTS_ON,
+    LOG_RUNNING_LIGHTS_OFF,
+    LOG_AUX_ON,
+    LOG_AUX_OFF,
+    LOG_AUX_PRESET_DIM,
+    LOG_AUX_FLASH,
+    LOG_AUX_FLASH_INVERSE,
+    LOG_AUX_BLINK_START,
+    LOG_AUX_BLINK_STOP,
+    LOG_AUX_REVOLVE_START,
+    LOG_AUX_REVOLVE_STOP,
+    LOG_IO_OUTPUT_ON,                       // %S port
+    LOG_IO_OUTPUT_OFF,                      // %S port
+    LOG_LVC_CUTOFF,                         // %u volts, %u tenths
+    LOG_LVC_EXIT,
+    LOG_DRIVING_PROFILE,                    // %u profile
+    LOG_TURN_MODE,                          // %u turn mode
+    LOG_NEUTRAL_TURN_ENABLE,
+    LOG_NEUTRAL_TURN_DISABLE,
+    LOG_ACCEL_RAMP_LEVEL,                   // %u level
+    LOG_DECEL_RAMP_LEVEL,                   // %u level
+    LOG_BARREL_SENSITIVITY,                 // %u percent
+    LOG_HILL_SENSITIVITY,                   // %u percent
+    LOG_MANUAL_TRIGGER,                     // %S device
+    LOG_MECH_BARREL_ENABLE,                 // %S device
+    LOG_MECH_BARREL_DISABLE,                // %S device
+    LOG_RADIO_READY,                        // %S protocol
+    LOG_COMMS_CHANGED,                      // %S port
+    LOG_BARREL_STAB_ON,                     // %u sensitivity
+    LOG_BARREL_STAB_OFF,
+    LOG_HILL_PHYSICS_ON,                    // %u sensitivity
+    LOG_HILL_PHYSICS_OFF,
+    LOG_SMOKER_ENABLE,
+    LOG_SMOKER_DISABLE,
+    LOG_VOLUME,                             // %u percent
+    LOG_USER_SOUND,                         // %u sound number
+    LOG_USER_SOUND_REPEAT,                  // %u sound number
+    LOG_USER_SOUND_STOP,                    // %u sound number
+    LOG_USER_FUNCTION,                      // %u function number
+    LOG_ANALOG_USER_FUNCTION,               // %u function number, %u level
+    LOG_OVERFLOW,                           // %u messages dropped - used internally
+    LOG_NUM_MESSAGES
+};
+
+typedef struct {
+    uint8_t ID;
+    int16_t Arg[2];
+} log_record;
+
+
+class OP_Log
+{
+public:
+    OP_Log() {}
+    static void     write(uint8_t id, int16_t a = 0, int16_t b = 0);   // Save a message to be sent later
+    static void     write(uint8_t id, const __FlashStringHelper *a, const __FlashStringHelper *b = NULL) { write(id, (int16_t)(uintptr_t)a, (int16_t)(uintptr_t)b); }
+    static void     update(HardwareSerial *port);       // Call every time through the loop. Sends what it can without waiting. 
+    static void     flush(HardwareSerial *port);        // Send everything now, waiting as needed. Use before printing anything directly to the same port. 
+    static boolean  pending(void);                      // Is anything waiting to be sent
+    static uint16_t dropped(void) { return Dropped; }   // How many messages have been discarded since power-on because the buffer was full
+
+private:
+    static void     format(const log_record &);         // Turn a record into text in Line[]
+
+    static log_record Buffer[LOG_BUFFER_SIZE];
+    static uint8_t  Head;                               // Next record to write
+    static uint8_t  Tail;                               // Next record to send
+    static uint8_t  Count;
+    static char     Line[LOG_LINE_CHARS];               // Text of the message being sent
+    static uint8_t  LineLength;                         // 0 once it has been sent
+    static uint16_t Dropped;
+    static uint16_t DroppedReported;                    // Dropped count at the time we last told the user about it
+};
+
+
+#endif
@@ -0,0 +1,92 @@
+/* OP_Memory.cpp    Open Panzer Memory - SRAM usage and stack high-water mark
+ * Source:          openpanzer.org              
+ * Authors:         Luke Middleton
+ *   
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */ 
+
+#include "OP_Memory.h"
+
+// These are set by the linker and avr-libc. Only their addresses mean anything. 
+extern uint8_t __data_start;
+extern uint8_t __data_end;
+extern uint8_t __bss_start;
+extern uint8_t __bss_end;
+extern uint8_t __heap_start;
+extern char *  __brkval;            // Top of the heap, or 0 if malloc has never been called
+
+
+// This is placed in the .init3 section, which the startup code runs after it has set the stack pointer and zeroed the register avr-gcc expects to be zero, 
+// but before .data and .bss are set up or any constructors or main() run. Nothing is on the stack yet (the init sections run straight through, they 
+// aren't called), so we can paint everything from the end of our variables right up to the top of RAM. 
+// It must be naked (no prologue/epilogue) since there is no return address to go back to. 
+void OP_Memory_PaintStack(void) __attribute__((naked, used, section(".init3")));
+void OP_Memory_PaintStack(void)
+{
+    uint8_t *p = &__heap_start;
+    while (p <= (uint8_t *)RAMEND) { *p++ = STACK_PAINT_BYTE; }
+}
+
+
+uint8_t * OP_Memory::heapTop(void)
+{
+    return (__brkval == 0) ? &__heap_start : (uint8_t *)__brkval;
+}
+
+uint16_t OP_Memory::totalRAM(void)
+{
+    return RAMEND - RAMSTART + 1;
+}
+
+uint16_t OP_Memory::dataSize(void)
+{
+    return &__data_end - &__data_start;
+}
+
+uint16_t OP_Memory::bssSize(void)
+{
+    return &__bss_end - &__bss_start;
+}
+
+uint16_t OP_Memory::heapSize(void)
+{
+    return heapTop() - &__heap_start;
+}
+
+uint16_t OP_Memory::stackSize(void)
+{
+    return RAMEND - SP;
+}
+
+uint16_t OP_Memory::freeNow(void)
+{
+    return (uint8_t *)SP - heapTop() + 1;       // SP points at the next free byte, so it counts too
+}
+
+uint16_t OP_Memory::minFree(void)
+{
+    // Count painted bytes up from the top of the heap until we find one the stack has overwritten. 
+    // If the heap has ever grown and then shrunk again, the bytes it gave back won't be painted anymore and will be counted as used. So this can 
+    // only ever under-report free memory, never over-report it. 
+    uint8_t *p = heapTop();
+    uint16_t count = 0;
+    while (p <= (uint8_t *)RAMEND && *p == STACK_PAINT_BYTE) { p++; count++; }
+    return count;
+}
+
+uint16_t OP_Memory::stackHighWater(void)
+{
+    return ((uint8_t *)RAMEND + 1) - heapTop() - minFree();
+}
@@ -0,0 +1,65 @@
+/* OP_Memory.h      Open Panzer Memory - SRAM usage and stack high-water mark
+ * Source:          openpanzer.org              
+ * Authors:         Luke Middleton
+ *   
+ * The ATmega2560 has 8K of SRAM and we use most of it. From the bottom up it holds: 
+ *  - .data     globals with an initial value
+ *  - .bss      globals without one (most of our objects, the EEPROM ramcopy, serial buffers, etc...)
+ *  - the heap  which grows up from the end of .bss (very little now that objects live in the sketch's ObjectArena)
+ *  - the stack which grows down from the top of RAM (RAMEND)
+ * If the stack ever meets the heap or the globals, things get overwritten and the board does strange things or resets. 
+ * 
+ * The compiler can tell us the size of .data + .bss, but not how deep the stack gets. So at boot, before main() runs, we "paint" all the free RAM 
+ * between the end of .bss and the top of RAM with a known byte. Whatever the stack later touches gets overwritten. Counting how many painted bytes 
+ * are still intact above the heap tells us the least free memory there has ever been since boot - the high-water mark of the stack. 
+ * 
+ * For a per-library breakdown of static RAM, build the sketch with the Arduino IDE (File -> Preferences -> "Show verbose output during compilation"
+ * tells you where the build folder is), then from that folder run: 
+ *      avr-size -A OpenPanzerTCB.ino.elf                                               (totals per section)
+ *      avr-nm -S --size-sort -t d -C OpenPanzerTCB.ino.elf | grep -i " [bBdD] "      (every variable in RAM with its size)
+ *      avr-size -t sketch/src/OP_Radio/OP_Radio.cpp.o ...                            (data and bss columns of each library's object files)
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */ 
+
+#ifndef OP_MEMORY_H
+#define OP_MEMORY_H
+
+#include <Arduino.h>
+
+
+#define STACK_PAINT_BYTE        0xC5        // Painted into free RAM at boot. Anything but 0x00 or 0xFF, which are the values most likely to be written by the program. 
+
+
+class OP_Memory
+{
+public:
+    // All values are in bytes
+    static uint16_t totalRAM(void);         // Size of SRAM
+    static uint16_t dataSize(void);         // Initialized globals (.data)
+    static uint16_t bssSize(void);          // Zeroed globals (.bss)
+    static uint16_t heapSize(void);         // Heap presently in use, including malloc's bookkeeping
+    static uint16_t stackSize(void);        // Stack presently in use
+    static uint16_t freeNow(void);          // Space between the top of the heap and the stack right now
+    static uint16_t stackHighWater(void);   // Deepest the stack has been since boot
+    static uint16_t minFree(void);          // Least free space there has been since boot (painted bytes never touched). This takes some time to count, 
+                                            // about 0.4 mS per kilobyte of free RAM, so don't call it every loop. 
+
+private:
+    static uint8_t * heapTop(void);         // First byte above the heap
+};
+
+
+#endif
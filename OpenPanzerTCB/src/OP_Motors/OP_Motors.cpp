@@ -348,13 +348,13 @@ void Onboard_ESC::setSpeed(int s)
     {   //SIDEA - motor A
         if (s < 0)
         {   //Reverse
-            digitalWrite(OB_MA1, LOW);
-            digitalWrite(OB_MA2, HIGH);
+            PIN_LOW(OB_MA1);
+            PIN_HIGH(OB_MA2);
         }
         else
         {   //Forward
-            digitalWrite(OB_MA1, HIGH);
-            digitalWrite(OB_MA2, LOW);
+            PIN_HIGH(OB_MA1);
+            PIN_LOW(OB_MA2);
         }
         // Now set the PWM, always a positive number
         OB_MA_OCR = abs(s); // OB_MA_OCR is defined in OP_Settings.h
@@ -363,13 +363,13 @@ void Onboard_ESC::setSpeed(int s)
     {   //SIDEB - motor B
         if (s < 0)
         {   //Reverse
-            digitalWrite(OB_MB1, LOW);
-            digitalWrite(OB_MB2, HIGH);
+            PIN_LOW(OB_MB1);
+            PIN_HIGH(OB_MB2);
         }
         else
         {   //Forward
-            digitalWrite(OB_MB1, HIGH);
-            digitalWrite(OB_MB2, LOW);
+            PIN_HIGH(OB_MB1);
+            PIN_LOW(OB_MB2);
         }
         // Now set the PWM, always a positive number
         OB_MB_OCR = abs(s); // OB_MB_OCR is defined in OP_Settings.h
@@ -686,7 +686,7 @@ void Servo_RECOIL::begin(void)
         
         p = this->getMinPulseWidth(this->ESC_Position);
         this->setRampSpeed_mS(ESC_Position, _ReturnmS, true);
-        do {delay(1);}
+        do {delay(1); this->updateRamps();}
         while (this->getPulseWidth(ESC_Position) > p);
         this->stopRamping(ESC_Position);
         this->writeMicroseconds(ESC_Position, p);
@@ -697,7 +697,7 @@ void Servo_RECOIL::begin(void)
 
         p = this->getMaxPulseWidth(this->ESC_Position);
         this->setRampSpeed_mS(ESC_Position, _ReturnmS, false);
-        do {delay(1);}
+        do {delay(1); this->updateRamps();}
         while (this->getPulseWidth(ESC_Position) < p);
         this->stopRamping(ESC_Position);    
         this->writeMicroseconds(ESC_Position, p);
@@ -122,6 +122,8 @@ class Motor {
     // Other common functions
     void cut_SpeedPct(uint8_t);         // Cut the total speed range by some percent
     void set_MaxSpeedPct(uint8_t);      // Alternate way of writing cut_SpeedPct
+    uint8_t get_MaxSpeedPct(void)       // What is left of the speed range after any cut, as a percent of the default range
+        { return (this->di_maxspeed == this->di_minspeed) ? 100 : (((long)(this->i_maxspeed - this->i_minspeed) * 100) / (this->di_maxspeed - this->di_minspeed)); }
 
     // This maps the external speed range to the internal one
     int map_Range(int s)
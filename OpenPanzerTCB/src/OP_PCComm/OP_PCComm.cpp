@@ -31,6 +31,43 @@ boolean           OP_PCComm::eepromUpdated;
 boolean           OP_PCComm::CRCRequired;
 int               OP_PCComm::numErrors;
 DataSentence      OP_PCComm::SentenceIN;
+void             (*OP_PCComm::_sysInfoHandler)(void);
+
+// CRC16 lookup table for polynomial 0x1021 (CCITT, zero start, same as XMODEM). One table read per byte instead of 8 shift-and-xor steps.
+const uint16_t PCComm_CRC16_Table[256] PROGMEM = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+    0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+    0x1231, 0x0210, 0x3273, 0x2252, 0x52B5, 0x4294, 0x72F7, 0x62D6,
+    0x9339, 0x8318, 0xB37B, 0xA35A, 0xD3BD, 0xC39C, 0xF3FF, 0xE3DE,
+    0x2462, 0x3443, 0x0420, 0x1401, 0x64E6, 0x74C7, 0x44A4, 0x5485,
+    0xA56A, 0xB54B, 0x8528, 0x9509, 0xE5EE, 0xF5CF, 0xC5AC, 0xD58D,
+    0x3653, 0x2672, 0x1611, 0x0630, 0x76D7, 0x66F6, 0x5695, 0x46B4,
+    0xB75B, 0xA77A, 0x9719, 0x8738, 0xF7DF, 0xE7FE, 0xD79D, 0xC7BC,
+    0x48C4, 0x58E5, 0x6886, 0x78A7, 0x0840, 0x1861, 0x2802, 0x3823,
+    0xC9CC, 0xD9ED, 0xE98E, 0xF9AF, 0x8948, 0x9969, 0xA90A, 0xB92B,
+    0x5AF5, 0x4AD4, 0x7AB7, 0x6A96, 0x1A71, 0x0A50, 0x3A33, 0x2A12,
+    0xDBFD, 0xCBDC, 0xFBBF, 0xEB9E, 0x9B79, 0x8B58, 0xBB3B, 0xAB1A,
+    0x6CA6, 0x7C87, 0x4CE4, 0x5CC5, 0x2C22, 0x3C03, 0x0C60, 0x1C41,
+    0xEDAE, 0xFD8F, 0xCDEC, 0xDDCD, 0xAD2A, 0xBD0B, 0x8D68, 0x9D49,
+    0x7E97, 0x6EB6, 0x5ED5, 0x4EF4, 0x3E13, 0x2E32, 0x1E51, 0x0E70,
+    0xFF9F, 0xEFBE, 0xDFDD, 0xCFFC, 0xBF1B, 0xAF3A, 0x9F59, 0x8F78,
+    0x9188, 0x81A9, 0xB1CA, 0xA1EB, 0xD10C, 0xC12D, 0xF14E, 0xE16F,
+    0x1080, 0x00A1, 0x30C2, 0x20E3, 0x5004, 0x4025, 0x7046, 0x6067,
+    0x83B9, 0x9398, 0xA3FB, 0xB3DA, 0xC33D, 0xD31C, 0xE37F, 0xF35E,
+    0x02B1, 0x1290, 0x22F3, 0x32D2, 0x4235, 0x5214, 0x6277, 0x7256,
+    0xB5EA, 0xA5CB, 0x95A8, 0x8589, 0xF56E, 0xE54F, 0xD52C, 0xC50D,
+    0x34E2, 0x24C3, 0x14A0, 0x0481, 0x7466, 0x6447, 0x5424, 0x4405,
+    0xA7DB, 0xB7FA, 0x8799, 0x97B8, 0xE75F, 0xF77E, 0xC71D, 0xD73C,
+    0x26D3, 0x36F2, 0x0691, 0x16B0, 0x6657, 0x7676, 0x4615, 0x5634,
+    0xD94C, 0xC96D, 0xF90E, 0xE92F, 0x99C8, 0x89E9, 0xB98A, 0xA9AB,
+    0x5844, 0x4865, 0x7806, 0x6827, 0x18C0, 0x08E1, 0x3882, 0x28A3,
+    0xCB7D, 0xDB5C, 0xEB3F, 0xFB1E, 0x8BF9, 0x9BD8, 0xABBB, 0xBB9A,
+    0x4A75, 0x5A54, 0x6A37, 0x7A16, 0x0AF1, 0x1AD0, 0x2AB3, 0x3A92,
+    0xFD2E, 0xED0F, 0xDD6C, 0xCD4D, 0xBDAA, 0xAD8B, 0x9DE8, 0x8DC9,
+    0x7C26, 0x6C07, 0x5C64, 0x4C45, 0x3CA2, 0x2C83, 0x1CE0, 0x0CC1,
+    0xEF1F, 0xFF3E, 0xCF5D, 0xDF7C, 0xAF9B, 0xBFBA, 0x8FD9, 0x9FF8,
+    0x6E17, 0x7E36, 0x4E55, 0x5E74, 0x2E93, 0x3EB2, 0x0ED1, 0x1EF0
+};
 
 
 //------------------------------------------------------------------------------------------------------------------------>>
@@ -193,6 +230,8 @@ byte endsWith;
 boolean SentenceReceived = false;   // Start off false, will get set to true if a valid sentence was received
 static char responseData[SENTENCE_BUFF];    
 static uint8_t numBytes = 0;        // Start off with no data received
+static uint16_t crc = 0;            // Running CRC of every byte received so far in this sentence
+static uint16_t crcToDelimiter = 0; // The running CRC as of the last delimiter. The checksum itself comes after that, so this is what it should match.
 
 
     if (_serial->available() > 0)   // We have at least one byte to read
@@ -202,10 +241,14 @@ static uint8_t numBytes = 0;        // Start off with no data received
             // Add the next character to our responseData array and increments numBytes
             endsWith = responseData[numBytes++] = _serial->read();
             
+            // Keep the CRC up to date as each byte arrives rather than going back over the whole line at the end
+            crc = crcUpdate(crc, endsWith);
+            if (endsWith == DELIMITER) crcToDelimiter = crc;
+            
             // If we see a newline character, check if we have a valid sentence
             if (endsWith == NEWLINE) //'\n')    
             {
-                if (ParseSentence(responseData, numBytes))
+                if (ParseSentence(responseData, numBytes, crcToDelimiter))
                 {
                     SentenceReceived = true;
                 }
@@ -220,6 +263,7 @@ static uint8_t numBytes = 0;        // Start off with no data received
                 // in order to start fresh for the next communication. 
                 responseData[0] = (char)0;  // Clear the response buffer (only need to set the first element to zero)
                 numBytes = 0;               // And reset the number of bytes received to zero
+                crc = crcToDelimiter = 0;   // And the CRC
             }
         }
     }
@@ -229,7 +273,8 @@ static uint8_t numBytes = 0;        // Start off with no data received
 
 
 // ParseSentence takes an array of characters and tries to split them out in the individual pieces of our sentence.
-boolean OP_PCComm::ParseSentence(char *data, int datasize)
+// The CRC of the sentence up to and including the last delimiter has already been worked out by ReadData as the bytes came in. 
+boolean OP_PCComm::ParseSentence(char *data, int datasize, uint16_t sentenceCRC)
 {
 static boolean validSentence = false;
 static char line_segment[VALUE_BUFF];   // Buffer large enough to hold all the characters of one portion of the sentence
@@ -256,8 +301,8 @@ byte c;
                 // So reset the watchdog timer (tell it start counting over from now)
                 resetWatchdog();
                 
-                // Now process sentence - here we use the full char array minus the checksum portion at the end 
-                if (CRCRequired && (SentenceIN.Checksum != calcrc(data, line_length - segment_length)))
+                // Now check the sentence CRC - this covers the full char array minus the checksum portion at the end 
+                if (CRCRequired && (SentenceIN.Checksum != (int16_t)sentenceCRC))
                 {   // Checksum doesn't add up. 
                     validSentence = false;
                 }
@@ -392,7 +437,7 @@ OP_PololuQik * Qik;
             {
                 // At 115,200 baud it would take 8.5mS to send a 16 channel SBus radio sentence. The sentence would also be about 95 bytes long, but we are trying to keep sentences under 64. 
                 // If we are only sending 8 channels of data in a sentence the time would only be about 5mS and the sentence ~55 bytes
-                // 8 channels is the max for PPM anyway. While incoming PPM frame lengths can vary by the number of channels and their positions, they are often around 20ms.
+                // PPM is usually 8 channels or less. While incoming PPM frame lengths can vary by the number of channels and their positions, they are often around 20ms.
                 // That means at 115200 we easily have enough time to transmit each PPM frame out the serial port. 
                 // SBus is a different story. Although there are theoretically different SBus frame rates, the FrSky X4R we tested sent a new frame every 9mS and the frame
                 // itself takes 3mS to read at the SBus baud rate of 100000. That only leaves a 6mS gap to send a 8.5mS sentence to the PC (assuming we sent all 16 channels). 
@@ -454,10 +499,7 @@ OP_PololuQik * Qik;
                         arrOut[strLen] = '\0';                  // Mark the end of the array
 
                         // Send out sentence including CRC
-                        _serial->print(arrOut);                 // Now print what we have so far
-                        _serial->print(calcrc(arrOut, strLen)); // Calculate the CRC for all the above and print that
-                        _serial->print(NEWLINE);                // End sentence
-                        _serial->flush();                       // This is supposed to wait until the transmission is done
+                        sendSentence(arrOut);
                         
                         // Now if we have more than 8 channels to send, send the opposite 8 next time around
                         if (_radio->getChannelCount() > 8) HiLo == LOW ? HiLo = HIGH : HiLo = LOW;
@@ -600,6 +642,22 @@ OP_PololuQik * Qik;
             }
             break;
 
+        case PCCMD_READ_MEMORY:         // Computer wants to know how much SRAM we are using. The ID says which figure. 
+            GivePC_Memory(SentenceIN.ID);
+            break;
+
+        case PCCMD_SYSINFO_COMPACT:     // Computer wants the compact system info dump
+            if (SentenceIN.ID == SentenceIN.Command)    // On commands with no value ID, the command should be repeated in the ID slot
+            {
+                if (_sysInfoHandler)
+                {
+                    _sysInfoHandler();      // Prints the whole dump out our port and returns once it has gone
+                    AskForNextSentence();
+                }
+                else sendNullValueSentence(DVCMD_NOSUCH_VALUE);
+            }
+            break;
+
         case PCCMD_STAY_AWAKE:          // Computer has nothing for us to do, but doesn't want us to disconnect yet
             if (SentenceIN.ID == SentenceIN.Command)    // On commands with no value ID, the command should be repeated in the ID slot
             {
@@ -639,10 +697,7 @@ SentencePrefix s;
         strLen += valueStrLen;                                      // String length is now this long
         sentenceOut[strLen++] = DELIMITER;                          // Add final delimiter
         sentenceOut[strLen] = '\0';                                 // Mark the end of the array
-        _serial->print(sentenceOut);                                // Now print: Command | ID | Value |
-        _serial->print(calcrc(sentenceOut, strLen));                // Calculate the CRC for all the above and print that
-        _serial->print(NEWLINE);                                    // End sentence
-        _serial->flush();   
+        sendSentence(sentenceOut);                                  // Now print: Command | ID | Value | CRC NEWLINE
     }
     else
     {
@@ -651,6 +706,21 @@ SentencePrefix s;
     }
 }
 
+void OP_PCComm::GivePC_Memory(uint16_t ID)
+{
+    switch (ID)
+    {
+        case DVID_MEM_TOTAL:    GivePC_Int(ID, OP_Memory::totalRAM());          break;
+        case DVID_MEM_DATA:     GivePC_Int(ID, OP_Memory::dataSize());          break;
+        case DVID_MEM_BSS:      GivePC_Int(ID, OP_Memory::bssSize());           break;
+        case DVID_MEM_HEAP:     GivePC_Int(ID, OP_Memory::heapSize());          break;
+        case DVID_MEM_FREE:     GivePC_Int(ID, OP_Memory::freeNow());           break;
+        case DVID_MEM_MINFREE:  GivePC_Int(ID, OP_Memory::minFree());           break;
+        case DVID_MEM_STACKMAX: GivePC_Int(ID, OP_Memory::stackHighWater());    break;
+        default:                sendNullValueSentence(DVCMD_NOSUCH_VALUE);      break;
+    }
+}
+
 void OP_PCComm::GivePC_Int(uint16_t returnID, int32_t val)
 {
 String str = "";
@@ -673,10 +743,7 @@ SentencePrefix s;
     strLen += valueStrLen;                                      // String length is now this long
     sentenceOut[strLen++] = DELIMITER;                          // Add final delimiter
     sentenceOut[strLen] = '\0';                                 // Mark the end of the array
-    _serial->print(sentenceOut);                                // Now print: Command | ID | Value |
-    _serial->print(calcrc(sentenceOut, strLen));                // Calculate the CRC for all the above and print that
-    _serial->print(NEWLINE);                                    // End sentence
-    _serial->flush();   
+    sendSentence(sentenceOut);                                  // Now print: Command | ID | Value | CRC NEWLINE
 }
 
 // Give the PC our firmware version
@@ -712,10 +779,7 @@ void OP_PCComm::GivePC_FirmwareVersion(void)
     strcat(sentenceOut, fValue);            // Concatenate the arrays
     sentenceOut[strLen] = '\0';             // Mark the end of the array
 
-    _serial->print(sentenceOut);            // Now print command | ID | 0 |
-    _serial->print(calcrc(sentenceOut, strLen));    // Calculate the CRC for all the above and print that
-    _serial->print(NEWLINE);                // End sentence
-    _serial->flush();   
+    sendSentence(sentenceOut);              // Now print: Command | ID | Value | CRC NEWLINE
     
 }
 
@@ -752,10 +816,7 @@ void OP_PCComm::GivePC_MinOPCVersion(void)
     strcat(sentenceOut, fValue);            // Concatenate the arrays
     sentenceOut[strLen] = '\0';             // Mark the end of the array
 
-    _serial->print(sentenceOut);            // Now print command | ID | 0 |
-    _serial->print(calcrc(sentenceOut, strLen));    // Calculate the CRC for all the above and print that
-    _serial->print(NEWLINE);                // End sentence
-    _serial->flush();   
+    sendSentence(sentenceOut);              // Now print: Command | ID | Value | CRC NEWLINE
     
 }
 
@@ -797,13 +858,25 @@ void OP_PCComm::sendNullValueSentence(uint8_t command, boolean setValueFlag /*=f
     else                sentenceOut[strLen++] = '0';    // no value - typical
     sentenceOut[strLen++] = DELIMITER; 
     sentenceOut[strLen] = '\0'; // Mark the end of the array
-    // Now print command | ID | 0 |
-    _serial->print(sentenceOut);
-    // Calculate the CRC for all the above and print that
-    _serial->print(calcrc(sentenceOut, strLen));
-    // End sentence
-    _serial->print(NEWLINE);
-    _serial->flush();   
+    // Now print command | ID | 0 | followed by the CRC and a newline
+    sendSentence(sentenceOut);
+}
+
+// Print a sentence followed by its CRC and a newline. The sentence should already end in a delimiter. The CRC is worked out as each character 
+// goes out so we only pass over the sentence once. 
+void OP_PCComm::sendSentence(const char *sentence)
+{
+    uint16_t crc = 0;
+    char c;
+    
+    while ((c = *sentence++) != '\0')
+    {
+        _serial->write(c);
+        crc = crcUpdate(crc, c);
+    }
+    _serial->print((int16_t)crc);   // The PC expects the CRC as a signed number
+    _serial->print(NEWLINE);        // End sentence
+    _serial->flush();               // This is supposed to wait until the transmission is done
 }
 
 void OP_PCComm::prefixToByteArray(SentencePrefix s, char *prefix, uint8_t prefixBUFF, uint8_t &returnStrLen)
@@ -862,26 +935,10 @@ int32_t OP_PCComm::constructNumber(char *c, int numBytes)
     
 }
 
-// This will calculate a CRC value from a character string
-int16_t OP_PCComm::calcrc(char *ptr, int16_t count) 
-{ 
-    int16_t crc; 
-    uint8_t i; 
-    
-    crc = 0; 
-    while (--count >= 0) 
-    { 
-        crc = crc ^ (int16_t) *ptr++ << 8; 
-        i = 8; 
-        do 
-        { 
-            if (crc & 0x8000) 
-                crc = crc << 1 ^ 0x1021; 
-            else 
-                crc = crc << 1; 
-        } while(--i); 
-    } 
-    return (crc); 
+// Add one more character to a running CRC. Start with a CRC of 0 and call this for each character in turn. 
+uint16_t OP_PCComm::crcUpdate(uint16_t crc, uint8_t c)
+{
+    return (crc << 8) ^ pgm_read_word(&PCComm_CRC16_Table[(uint8_t)(crc >> 8) ^ c]);
 }
 
 // Turn on/off CRC checking
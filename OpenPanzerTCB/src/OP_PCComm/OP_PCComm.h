@@ -123,6 +123,7 @@
 #include "../OP_EEPROM/OP_EEPROM.h"
 #include "../OP_Radio/OP_Radio.h"
 #include "../OP_Settings/OP_Settings.h"
+#include "../OP_Memory/OP_Memory.h"
 
 
 // Communication defines
@@ -143,6 +144,8 @@
 #define PCCMD_READ_VERSION      128     // PC wants to know what firmware version we're running
 #define PCCMD_STAY_AWAKE        129     // PC is tellings us to stay on the line
 #define PCCMD_MINOPC_VERSION    130     // PC requests the minimum version of OP Config the current version of TCB firmware requires
+#define PCCMD_READ_MEMORY       131     // PC wants one of the SRAM usage figures, the ID slot says which one (see DVID_MEM_ below)
+#define PCCMD_SYSINFO_COMPACT   139     // PC wants the compact system info dump: "$SI,..." lines from "$SI,BEGIN" to "$SI,END", followed by the usual next-sentence request
 #define PCCMD_DISCONNECT        31      // PC tells us to disconnect
 
 // "Commands" returned by device
@@ -159,6 +162,15 @@
 #define DVID_RADIOSTREAM_LO     401
 #define DVID_RADIOSTREAM_HI     402
 
+// IDs for PCCMD_READ_MEMORY. The PC sends the ID of the figure it wants, we return it in bytes with the same ID (see OP_Memory.h)
+#define DVID_MEM_TOTAL          410     // Size of SRAM
+#define DVID_MEM_DATA           411     // Initialized globals
+#define DVID_MEM_BSS            412     // Zeroed globals
+#define DVID_MEM_HEAP           413     // Heap in use
+#define DVID_MEM_FREE           414     // Free right now
+#define DVID_MEM_MINFREE        415     // Least free since boot
+#define DVID_MEM_STACKMAX       416     // Stack high-water mark
+
 // IDs returned by device that ARE EEPROM
 #define MIN_EEPROM_ID           1000    // Any ID over this number will be the ID of an eeprom variable. Any ID below it will be something else
 
@@ -212,11 +224,13 @@ class OP_PCComm
         
         static void skipCRC();      // Mostly used for testing, we can skip CRC checking (the CRC portion of the sentence must still be provided though, it just won't be checked)
         static void requireCRC();   
+        
+        static void setSysInfoHandler(void (*f)(void)) { _sysInfoHandler = f; }    // The sketch prints the system info dump, since only it knows what goes in it. This is the function that does it.
                 
     private:
         // Functions
         static boolean ReadData(void);                              // Process incoming bytes on the serial port
-        static boolean ParseSentence(char *data, int datasize);     // Try to convert a full line of data into a sentence
+        static boolean ParseSentence(char *data, int datasize, uint16_t sentenceCRC);  // Try to convert a full line of data into a sentence
         static void ProcessCommand(void);                           // Do whatever the computer asked us to
         
         static void AskForNextSentence(void);
@@ -227,11 +241,13 @@ class OP_PCComm
         static void GivePC_Int(uint16_t returnID, int32_t val);     // Sends an arbitrary value up to int32
         static void GivePC_FirmwareVersion(void);
         static void GivePC_MinOPCVersion(void); 
+        static void GivePC_Memory(uint16_t ID);                     // Sends one of the SRAM usage figures
         static void sendNullValueSentence(uint8_t command, boolean setValueFlag = false);
+        static void sendSentence(const char *sentence);             // Prints the sentence, its CRC and a newline
         static void prefixToByteArray(SentencePrefix s, char *prefixOut, uint8_t prefixBUFF, uint8_t &returnStrLen);
 
         static int32_t constructNumber(char *c, int numBytes);
-        static int16_t calcrc(char *ptr, int16_t count);
+        static uint16_t crcUpdate(uint16_t crc, uint8_t c);         // Adds one character to a running CRC
         
         static void startWatchdog(void);
         static void resetWatchdog(void);
@@ -254,6 +270,7 @@ class OP_PCComm
         static boolean          CRCRequired;
         static int              numErrors;
         static DataSentence     SentenceIN;
+        static void             (*_sysInfoHandler)(void);
         
 };
 
@@ -38,6 +38,10 @@ volatile decodeState_t  PPMDecode::State;                           // The curre
 volatile uint8_t        PPMDecode::NbrChannels;                     // the total number of channels detected in a complete frame
 volatile uint16_t       PPMDecode::tickStamp;                       // Timestamp
 volatile boolean        PPMDecode::NewFrame;                        // Boolean variable to indicate a new complete PPM frame has arrived or been read. 
+volatile uint32_t       PPMDecode::LastFrameTime;                   // millis() time of the last complete, valid frame
+volatile boolean        PPMDecode::WatchSerial;                     // Are we watching for serial data?
+volatile boolean        PPMDecode::SerialSeen;                      // Serial data was seen and the interrupt turned off
+volatile uint8_t        PPMDecode::ShortEdges;                      // Count of consecutive edges too close together to be PPM
 
 // Constructor
 PPMDecode::PPMDecode(){}
@@ -51,7 +55,10 @@ void PPMDecode::begin()
     Channel = 0;                                                    // Current channel is 0
     State = NOT_SYNCHED_state;                                      // PPM decoder not yet synched
     NewFrame = false;                                               // We haven't received a frame yet, so it hasn't been read either
+    LastFrameTime = millis();                                       // Start the frame age from now, so the radio class doesn't see a stale signal before we've had a chance to acquire
     clearTicks();                                                   // Set all tick counts to 0
+    WatchSerial = SerialSeen = false;                               // Not watching for serial data unless asked, see watchForSerial()
+    ShortEdges = 0;
 
 
     // SETUP EXTERNAL INTERRUPT
@@ -111,6 +118,18 @@ void PPMDecode::begin()
     
 }
 
+void PPMDecode::watchForSerial(boolean watch)
+{
+    // This is only for use while the radio class is detecting what is attached. In normal operation a burst of noise must never turn PPM off, 
+    // so once PPM has been detected this must be called again with watch = false. 
+    byte sregRestore = SREG;        // Save interrupt register
+    cli();                          // Disable interrupts
+        ShortEdges = 0;
+        SerialSeen = false;
+        WatchSerial = watch;
+    SREG = sregRestore;             // Restore interrupts
+}
+
 void PPMDecode::clearTicks()
 {
     // Initialize ticks to 0 so we will be able to tell if they were ever correctly measured or not.
@@ -137,18 +156,36 @@ void PPMDecode::shutdown()
 
 // This is Atmega external Interrupt 5 on Atmega2560 pin 7 (TQFP). Arduino would call it external Interrupt 1 on Arduino pin 3. But they are the same thing.
 // See: Arduino\hardware\arduino\avr\cores\arduino\WInterrupts.c for the Arduino translation
+// NOTE: The PPM pin (PE5) is not connected to any of the Atmega's input capture units, so the edge can't be time-stamped in hardware. The next best thing 
+// is to read Timer 1 once, as the very first thing we do, and use that one reading both to measure this pulse and as the start of the next. Any time we 
+// lose waiting for the interrupt then only moves the edge between two pulses, it doesn't shorten every pulse in the frame. 
 ISR(INT5_vect){
-    PPMDecode::INT5_PPM_ISR();
+    PPMDecode::INT5_PPM_ISR(TCNT1);
     
 }
 
-void PPMDecode::INT5_PPM_ISR()
+void PPMDecode::INT5_PPM_ISR(uint16_t edgeTicks)
 {
     // How long since last interrupt
-    uint16_t elapsedTicks = TCNT1 - tickStamp;
+    uint16_t elapsedTicks = edgeTicks - tickStamp;
+
+    // Save the time of this edge for next go round
+    tickStamp = edgeTicks; 
 
-    // Save the current time for next go round
-    tickStamp = TCNT1; 
+    if (WatchSerial)
+    {   // We are still detecting. Edges this close together are serial data, see SERIAL_EDGE_TICKLEN in OP_PPMDecode.h
+        if (elapsedTicks < SERIAL_EDGE_TICKLEN)
+        {
+            if (++ShortEdges >= SERIAL_EDGE_COUNT)
+            {
+                EIMSK &= ~(1 << INT5);                          // Disable interrupt 5, we're done
+                WatchSerial = false;
+                SerialSeen = true;
+            }
+            return;                                             // Not PPM anyway, and we want to spend as little time in here as possible
+        }
+        ShortEdges = 0;
+    }
     
     // Without an overflow, we will only go into FailSafe if the number of channels changes (highly unlikely), or if we get a pulsewidth less than 
     // the length required to be a synch pulse but not equal to a valid frame pulse. 
@@ -165,6 +202,7 @@ void PPMDecode::INT5_PPM_ISR()
             else                                                // In this case we have completed a full frame of channel data
             {
                 NewFrame = true;
+                LastFrameTime = millis();                       // Stamp it, the radio class uses the age of this to decide when the signal has been lost
             }
         }
         else{                                                   // We're not running yet - should we be? 
@@ -233,5 +271,15 @@ void PPMDecode::GetPPM_Frame( int16_t pulseArray[], int16_t chanCount)
     NewFrame = false;                                           // We've read this frame, so it's no longer new
 }
 
+uint32_t PPMDecode::getLastFrameTime(void)
+{
+    uint32_t t;
+    uint8_t sreg = SREG;                                        // LastFrameTime is written by the ISR and is more than one byte, 
+    cli();                                                      // so disable interrupts while we read it
+    t = LastFrameTime;
+    SREG = sreg;
+    return t;
+}
+
 
 
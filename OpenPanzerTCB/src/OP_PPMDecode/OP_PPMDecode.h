@@ -48,9 +48,10 @@
                                                         // #define RISING   3       (11)
 
 #define MIN_PPM_CHANNELS        4                       // We don't accept anything less than 4 channels, even if the signal is valid
-#define MAX_PPM_CHANNELS        8                       // maximum number of channels in PPM stream we can store. This is not the same as the
+#define MAX_PPM_CHANNELS        12                      // maximum number of channels in PPM stream we can store. This is not the same as the
                                                         // the number of channels the main sketch actually uses (see COUNT_OP_CHANNELS in OP_Radio.h)
-                                                        // If your radio spits out more than 8 channels of PPM data, the extra channels will be ignored. 
+                                                        // If your radio spits out more than 12 channels of PPM data, the extra channels will be ignored. 
+                                                        // 12 channels at the maximum pulse width plus the sync gap still fits in one Timer 1 rollover (32.7 mS)
                                                         
 #define PPM_ACQUISITION_COUNT   6                       // Must have this many consecutive valid frames to transition to the ready state.
 
@@ -60,6 +61,13 @@
 #define MAX_PPM_TICKLEN     (MAX_POSSIBLE_PULSE * PPM_TICKS_PER_uS)     // Maximum valid pulse width, converted to timer ticks
 #define SYNC_GAP_TICKLEN    (3000 * PPM_TICKS_PER_uS)       // we assume a space at least 3000uS is sync. Some use longer, but this would be the minimum (it exceeds the maximum possible pulse)
 
+// The PPM input and the serial receiver input (Serial 3 Rx) are the same signal, so when a serial receiver is attached this pin sees every edge of the serial data. 
+// While the radio class is still detecting, we watch for that: PPM edges are never closer than MIN_POSSIBLE_PULSE, but the edges of serial data come at least once 
+// per byte (120 uS for SBus, the slowest). Once we see SERIAL_EDGE_COUNT short edges in a row we know it isn't PPM, and turn the interrupt off before it can 
+// load down the processor (at CRSF's 400k baud there can be an edge every 5 uS). 
+#define SERIAL_EDGE_TICKLEN (300 * PPM_TICKS_PER_uS)        // Rising edges closer together than this can't be PPM
+#define SERIAL_EDGE_COUNT   16                              // This many in a row and we give up on PPM. Every serial frame we know of is longer than this. 
+
 
 class PPMDecode
 {
@@ -71,8 +79,11 @@ class PPMDecode
         decodeState_t                   getState();                     // Get state Function
         void                            GetPPM_Frame(int16_t pulseArray[], int16_t chanCount); // Get a full, complete frame of pulses. 
         uint8_t                         getChanCount();                 // Returns the number of channels in a full frame
-        static void                     INT5_PPM_ISR(void);             // The actual ISR will call this public member function, in order that it can access class variables
+        uint32_t                        getLastFrameTime(void);         // millis() time when the last complete, valid frame arrived
+        static void                     INT5_PPM_ISR(uint16_t);         // The actual ISR will call this public member function, in order that it can access class variables
         static volatile boolean         NewFrame;                       // Has an unread frame of data arrived? 
+        void                            watchForSerial(boolean watch);  // Only while detecting: turn ourselves off if the input turns out to be serial data
+        boolean                         serialSeen(void)    { return SerialSeen; }  // Did watchForSerial() see serial data and turn us off? 
         
     private:
         static volatile uint16_t        Ticks[MAX_PPM_CHANNELS + 1];    // Array holding the channel tick count. We have +1 since 0 will be our sync pulse, rest are channels
@@ -81,6 +92,10 @@ class PPMDecode
         static volatile decodeState_t   State;                          // The current state
         static volatile uint8_t         NbrChannels;                    // the total number of channels detected in a complete frame
         static volatile uint16_t        tickStamp;  
+        static volatile uint32_t        LastFrameTime;                  // millis() time when the last complete, valid frame arrived
+        static volatile boolean         WatchSerial;                    // Are we watching for serial data?
+        static volatile boolean         SerialSeen;                     // Serial data was seen and the interrupt turned off
+        static volatile uint8_t         ShortEdges;                     // Count of consecutive edges too close together to be PPM
 };
 
 
@@ -29,15 +29,15 @@ sf_channel                  OP_Radio::SpecialStick;                 // This hold
 PPMDecode                 * OP_Radio::PPMDecoder;                   // PPM Decoder object       
 SBusDecode                * OP_Radio::SBusDecoder;                  // SBus Decoder object
 iBusDecode                * OP_Radio::iBusDecoder;                  // iBus Decoder object
-boolean                     OP_Radio::PPMFailed;
-boolean                     OP_Radio::SBusFailed;
-boolean                     OP_Radio::iBusFailed;       
+CRSFDecode                * OP_Radio::CRSFDecoder;                  // CRSF Decoder object
+uint16_t                    OP_Radio::DetectTime_mS;
 RADIO_PROTOCOL              OP_Radio::Protocol;                     // Which protocol detected
 OP_SimpleTimer            * OP_Radio::radioTimer;
 uint8_t                     OP_Radio::channelCount;
 common_channel_settings     OP_Radio::ptrCommonChannelSettings[(STICKCHANNELS + AUXCHANNELS)];    // This array of pointers to common channel settings for all channels allows us to loop through them quickly, see GetPPMFrame() in RadioInputs tab. 
+int16_t                     OP_Radio::PulseHistory[(STICKCHANNELS + AUXCHANNELS)][2];
+boolean                     OP_Radio::FilterPrimed;
 int16_t                     OP_Radio::ignoreTurretDelay_mS;
-int                         OP_Radio::WatchdogTimerID;
 
 
 
@@ -68,7 +68,7 @@ const __FlashStringHelper *TurretStickPosition(uint8_t TSP)
 const __FlashStringHelper *RadioProtocol(RADIO_PROTOCOL RP)          
 {
     if ( RP > LAST_RADIOPROTOCOL) RP = PROTOCOL_NONE;
-    const __FlashStringHelper *Names[LAST_RADIOPROTOCOL+1]={F("None Detected"),F("PPM"),F("SBus"),F("iBus")};
+    const __FlashStringHelper *Names[LAST_RADIOPROTOCOL+1]={F("None Detected"),F("PPM"),F("SBus"),F("iBus"),F("CRSF")};
     return Names[RP];
 }
 
@@ -84,10 +84,7 @@ OP_Radio::OP_Radio()
     channelCount = 0;
     UsingSpecialPositions = false;
     InFailsafe = false;
-    
-    PPMFailed = false;
-    SBusFailed = false;
-    iBusFailed = false;
+    DetectTime_mS = 0;
 }
 
 
@@ -98,128 +95,113 @@ void OP_Radio::saveTimer(OP_SimpleTimer * t)
 
 void OP_Radio::detect(void)
 {
-// This function tries to detect a radio signal (PPM, SBus, or iBus). It tries one, if it fails, it tries the next,
-// and keeps going until it tries the last one, and then returns to the first and starts over. It keeps trying so long as it's called, 
-// so the calling routine needs to also be checking OP_Radio.Status(). When status returns READY_state, then the calling routine knows a protocol
-// has been successfully detected. At that time the calling routine can check OP_Radio.getProtocol() to find out which one we found. 
-
-static RADIO_PROTOCOL tryProtocol = PROTOCOL_SBUS;     // Whatever you set here, will be the first one checked
+// This function tries to detect a radio signal (PPM, SBus, iBus, or CRSF). It keeps trying so long as it's called, so the calling routine needs to also 
+// be checking OP_Radio.Status(). When status returns READY_state, then the calling routine knows a protocol has been successfully detected. At that time 
+// the calling routine can check OP_Radio.getProtocol() to find out which one we found. 
+//
+// We don't give each protocol a turn of its own any more, because then the time to detect grows with every protocol we add. Instead, the PPM decoder listens 
+// on its own interrupt the whole time. The serial protocols all use the same serial port, which can only listen at one baud rate at a time, so they still 
+// take turns, but each turn is only a short "sniff" window - just long enough to catch one valid frame. A protocol that produces one keeps the port for 
+// SERIAL_ACQUIRE_TIME, otherwise we move straight on to the next. Whichever decoder reaches READY_state first (its acquisition count of good frames in a row) wins.
+// The PPM input is the same signal as the serial input, so if a serial receiver is attached the PPM decoder will see the serial data. It recognizes this 
+// and turns itself off (see watchForSerial() in OP_PPMDecode.cpp), which tells us to stop listening for PPM. 
+// See RADIO_DETECT_WORST_MS in OP_Radio.h for how long all this can take. 
+
+static RADIO_PROTOCOL trySerial = PROTOCOL_SBUS;        // Whatever you set here, will be the first serial protocol checked
 static boolean started = false;
+static boolean listeningPPM;                            // Is the PPM decoder still in the running? 
+static boolean frameSeen;                               // Has the serial protocol on the port produced a valid frame yet? 
+static uint32_t windowStart;                            // When the serial protocol on the port got its turn
+static uint32_t detectStart;                            // When we started detecting
+uint16_t windowLength;
+
+    // Already found it? The PC comms routine may call us again if the radio has since gone into failsafe, but there's nothing more for us to do, 
+    // the decoder will pick the signal up again by itself. 
+    if (Protocol != PROTOCOL_NONE) 
+    {
+        radioTimer->run();
+        return;
+    }
 
-    // START TRYING A PROTOCOL
+    // START LISTENING
     // ---------------------------------------------------------------------------->>
     if (started == false)
     {
-        switch (tryProtocol)
-        {
-            
-            case PROTOCOL_PPM:
-                if (!PPMFailed)
-                {   // Try to detect PPM
-                    PPMDecoder = new PPMDecode;
-                    PPMDecoder->begin();
-                    // Start a try timer
-                    radioTimer->setTimeout(PPM_TRY_TIME, failPPM);
-                    started = true;
-                    //Serial.println(F("Searching for PPM..."));
-                }
-                break;
-                
-            case PROTOCOL_SBUS:
-                if (!SBusFailed)
-                {   // See if we can detect SBus
-                    SBusDecoder = new SBusDecode;
-                    SBusDecoder->begin();
-                    // Start a try timer
-                    radioTimer->setTimeout(SBUS_TRY_TIME, failSBus);
-                    started = true;
-                    //Serial.println(F("Searching for SBus..."));
-                }
-                break;
-
-            case PROTOCOL_iBUS:
-                if (!iBusFailed)
-                {   // See if we can detect iBus
-                    iBusDecoder = new iBusDecode;
-                    iBusDecoder->begin();
-                    // Start a try timer
-                    radioTimer->setTimeout(iBUS_TRY_TIME, failiBus);
-                    started = true;
-                    //Serial.println(F("Searching for iBus..."));
-                }
-                break;
-        }
+        detectStart = millis();
+        
+        // PPM listens the whole time
+        PPMDecoder = new PPMDecode;
+        PPMDecoder->begin();
+        PPMDecoder->watchForSerial(true);
+        listeningPPM = true;
+        
+        // And the first serial protocol gets the serial port
+        startSerial(trySerial);
+        windowStart = serialLastFrameTime(trySerial);   // The decoder sets this to millis() in begin(), so any change means it has seen a valid frame
+        frameSeen = false;
+        
+        started = true;
     }
-    // KEEP TRYING A PROTOCOL
+
+    // PPM
     // ---------------------------------------------------------------------------->>
-    else
+    if (listeningPPM)
     {
-        switch (tryProtocol)
-        {
-            case PROTOCOL_PPM:
-                if (!PPMFailed && PPMDecoder->getState() == READY_state) Protocol = PROTOCOL_PPM;   // Set protocol to PPM
-                break;
-                
-            case PROTOCOL_SBUS:
-                if (!SBusFailed)
-                {   // SBus needs to be polled
-                    SBusDecoder->update();
-                    if (SBusDecoder->getState() == READY_state) { Protocol = PROTOCOL_SBUS; }       // Set protocol to SBUS
-                }
-                break;
-            
-            case PROTOCOL_iBUS:
-                if (!iBusFailed)
-                {   // iBus needs to be polled
-                    iBusDecoder->update();
-                    if (iBusDecoder->getState() == READY_state) { Protocol = PROTOCOL_iBUS; }       // Set protocol to iBUS
-                }
-                break;
+        if (PPMDecoder->getState() == READY_state)
+        {   // PPM wins. Stop watching for serial data (from now on a burst of noise must not turn PPM off), and give up the serial port. 
+            PPMDecoder->watchForSerial(false);
+            stopSerial(trySerial);
+            Protocol = PROTOCOL_PPM;
+        }
+        else if (PPMDecoder->serialSeen())
+        {   // The input is serial data, so it isn't PPM
+            PPMDecoder->shutdown();
+            delete PPMDecoder;
+            listeningPPM = false;
         }
     }
 
-    // FAIL A PROTOCOL, AND TRY THE OTHER ONE INSTEAD
+    // SERIAL
     // ---------------------------------------------------------------------------->>
-    switch (tryProtocol)
+    if (Protocol == PROTOCOL_NONE)
     {
-        case PROTOCOL_PPM:
-            if (PPMFailed)
+        if (serialState(trySerial) == READY_state)
+        {   // This serial protocol wins
+            if (listeningPPM)
             {
-                // Shutdown and deconstruct object
                 PPMDecoder->shutdown();
-                delete PPMDecoder;      
-
-                // Try the next protocol - SBus
-                SBusFailed = started = false;
-                tryProtocol = PROTOCOL_SBUS;
+                delete PPMDecoder;
+                listeningPPM = false;
             }
-            break;
+            Protocol = trySerial;
+        }
+        else
+        {
+            if (serialLastFrameTime(trySerial) != windowStart) frameSeen = true;
             
-        case PROTOCOL_SBUS:
-            if (SBusFailed) 
+            switch (trySerial)
             {
-                // Shutdown and deconstruct object
-                SBusDecoder->shutdown();
-                delete SBusDecoder;             
-                
-                // Try the next protocol - iBus
-                iBusFailed = started = false;
-                tryProtocol = PROTOCOL_iBUS;    
+                case PROTOCOL_SBUS: windowLength = SBUS_SNIFF_TIME;     break;
+                case PROTOCOL_iBUS: windowLength = iBUS_SNIFF_TIME;     break;
+                case PROTOCOL_CRSF: 
+                default:            windowLength = CRSF_SNIFF_TIME;     break;
             }
-            break;
-
-        case PROTOCOL_iBUS:
-            if (iBusFailed) 
-            {
-                // Shutdown and deconstruct object
-                iBusDecoder->shutdown();
-                delete iBusDecoder;             
-                
-                // Try the next protocol - PPM
-                PPMFailed = started = false;
-                tryProtocol = PROTOCOL_PPM;   
+            if (frameSeen) windowLength = SERIAL_ACQUIRE_TIME;
+            
+            if ((millis() - windowStart) >= windowLength)
+            {   // Turn is up, hand the port to the next serial protocol
+                stopSerial(trySerial);
+                if (++trySerial > LAST_RADIOPROTOCOL) trySerial = PROTOCOL_SBUS;
+                startSerial(trySerial);
+                windowStart = serialLastFrameTime(trySerial);
+                frameSeen = false;
             }
-            break;
+        }
+    }
+    
+    if (Protocol != PROTOCOL_NONE)
+    {   // Done
+        DetectTime_mS = millis() - detectStart;
     }
     
     // Every time this function is called, update the timer.
@@ -228,25 +210,58 @@ static boolean started = false;
     radioTimer->run();
 }
 
-void OP_Radio::failPPM(void)
+void OP_Radio::startSerial(RADIO_PROTOCOL p)
+{
+    switch (p)
+    {
+        case PROTOCOL_SBUS: SBusDecoder = new SBusDecode;   SBusDecoder->begin();   break;
+        case PROTOCOL_iBUS: iBusDecoder = new iBusDecode;   iBusDecoder->begin();   break;
+        case PROTOCOL_CRSF: CRSFDecoder = new CRSFDecode;   CRSFDecoder->begin();   break;
+    }
+}
+
+void OP_Radio::stopSerial(RADIO_PROTOCOL p)
+{
+    switch (p)
+    {
+        case PROTOCOL_SBUS: SBusDecoder->shutdown();    delete SBusDecoder;     break;
+        case PROTOCOL_iBUS: iBusDecoder->shutdown();    delete iBusDecoder;     break;
+        case PROTOCOL_CRSF: CRSFDecoder->shutdown();    delete CRSFDecoder;     break;
+    }
+}
+
+decodeState_t OP_Radio::serialState(RADIO_PROTOCOL p)
 {
-    PPMFailed = true;
+    // Serial decoders need to be polled
+    switch (p)
+    {
+        case PROTOCOL_SBUS: SBusDecoder->update();  return SBusDecoder->getState();
+        case PROTOCOL_iBUS: iBusDecoder->update();  return iBusDecoder->getState();
+        case PROTOCOL_CRSF: CRSFDecoder->update();  return CRSFDecoder->getState();
+        default:                                    return NOT_SYNCHED_state;
+    }
 }
 
-void OP_Radio::failSBus(void)
+uint32_t OP_Radio::serialLastFrameTime(RADIO_PROTOCOL p)
 {
-    SBusFailed = true;
+    switch (p)
+    {
+        case PROTOCOL_SBUS: return SBusDecoder->getLastFrameTime();
+        case PROTOCOL_iBUS: return iBusDecoder->getLastFrameTime();
+        case PROTOCOL_CRSF: return CRSFDecoder->getLastFrameTime();
+        default:            return 0;
+    }
 }
 
-void OP_Radio::failiBus(void)
+uint16_t OP_Radio::getDetectTime(void)
 {
-    iBusFailed = true;
+    return DetectTime_mS;
 }
 
 
 // Begin
 // This initializes our channels to the settings saved in eeprom. 
-void OP_Radio::begin(_eeprom_data *storage)
+void OP_Radio::begin(_eeprom_hot *storage)
 {
     // Run this so we know how many channels the radio even has
     getChannelCount();
@@ -325,24 +340,32 @@ void OP_Radio::begin(_eeprom_data *storage)
     ptrCommonChannelSettings[0].updated = &Sticks.Throttle.updated;
     ptrCommonChannelSettings[0].started = &Sticks.Throttle.started;
     ptrCommonChannelSettings[0].present = &Sticks.Throttle.present;
+    ptrCommonChannelSettings[0].jitterBand = &Sticks.Throttle.Settings->jitterBand;
+    ptrCommonChannelSettings[0].medianFilter = &Sticks.Throttle.Settings->medianFilter;
    
     ptrCommonChannelSettings[1].pulse = &Sticks.Turn.pulse;
     ptrCommonChannelSettings[1].channelNum = &Sticks.Turn.Settings->channelNum;
     ptrCommonChannelSettings[1].updated = &Sticks.Turn.updated;
     ptrCommonChannelSettings[1].started = &Sticks.Turn.started;
     ptrCommonChannelSettings[1].present = &Sticks.Turn.present;
+    ptrCommonChannelSettings[1].jitterBand = &Sticks.Turn.Settings->jitterBand;
+    ptrCommonChannelSettings[1].medianFilter = &Sticks.Turn.Settings->medianFilter;
     
     ptrCommonChannelSettings[2].pulse = &Sticks.Elevation.pulse;
     ptrCommonChannelSettings[2].channelNum = &Sticks.Elevation.Settings->channelNum;
     ptrCommonChannelSettings[2].updated = &Sticks.Elevation.updated;
     ptrCommonChannelSettings[2].started = &Sticks.Elevation.started;
     ptrCommonChannelSettings[2].present = &Sticks.Elevation.present;
+    ptrCommonChannelSettings[2].jitterBand = &Sticks.Elevation.Settings->jitterBand;
+    ptrCommonChannelSettings[2].medianFilter = &Sticks.Elevation.Settings->medianFilter;
     
     ptrCommonChannelSettings[3].pulse = &Sticks.Azimuth.pulse;
     ptrCommonChannelSettings[3].channelNum = &Sticks.Azimuth.Settings->channelNum;
     ptrCommonChannelSettings[3].updated = &Sticks.Azimuth.updated;
     ptrCommonChannelSettings[3].started = &Sticks.Azimuth.started;
     ptrCommonChannelSettings[3].present = &Sticks.Azimuth.present;
+    ptrCommonChannelSettings[3].jitterBand = &Sticks.Azimuth.Settings->jitterBand;
+    ptrCommonChannelSettings[3].medianFilter = &Sticks.Azimuth.Settings->medianFilter;
     
     for (uint8_t i = 0; i < (ChannelsUtilized - 4); i++)
     {
@@ -350,6 +373,8 @@ void OP_Radio::begin(_eeprom_data *storage)
         ptrCommonChannelSettings[4 + i].channelNum = &AuxChannel[i].Settings->channelNum;
         ptrCommonChannelSettings[4 + i].updated = &AuxChannel[i].updated;
         ptrCommonChannelSettings[4 + i].present = &AuxChannel[i].present;
+        ptrCommonChannelSettings[4 + i].jitterBand = &AuxChannel[i].Settings->jitterBand;
+        ptrCommonChannelSettings[4 + i].medianFilter = &AuxChannel[i].Settings->medianFilter;
     }
     
     
@@ -384,6 +409,12 @@ boolean OP_Radio::GetCommands()
     // If we're using it, the iBusDecoder needs to be polled
     polliBus();     
 
+    // If we're using it, the CRSFDecoder needs to be polled
+    pollCRSF();
+
+    // Have we gone too long without a valid frame? 
+    checkWatchdog();
+
     if (Status() == READY_state)
     {   // We have a lock on the Rx. 
         RxReady = true;
@@ -391,7 +422,6 @@ boolean OP_Radio::GetCommands()
         // Has a new frame of data arrived yet? 
         if (NewFrame() == true)
         {
-            restartWatchdog();      // Re-start the watchdog timer
             InFailsafe = false;     // If we were in failsafe, we aren't now
 
             // Get all channel pulses. 
@@ -474,9 +504,6 @@ boolean OP_Radio::GetCommands()
         {
             // We already read this frame. No update
             ClearAllChannelUpdates();
-            
-            // Start the watchdog timer, in case it hasn't been already
-            startWatchdog();
         }
     }
     else
@@ -494,25 +521,41 @@ boolean OP_Radio::GetCommands()
     return RxReady;
 }
 
-void OP_Radio::startWatchdog()
+void OP_Radio::checkWatchdog()
 {
-    // Start the watchdog timer
-    if (!radioTimer->isEnabled(WatchdogTimerID))
+    // We used to restart a SimpleTimer timeout on every frame. Now each decoder simply stamps the millis() time of every valid frame it receives
+    // and we compare the age of that stamp against RADIO_FAILSAFE_MS. This costs nothing per frame and doesn't tie up one of the timer slots. 
+    // Read the stamp before millis(). If a PPM frame completes in between, the age comes out slightly long instead of wrapping around to a huge number. 
+    uint32_t lastFrame = LastFrameTime();
+    if (!InFailsafe && (millis() - lastFrame) > RADIO_FAILSAFE_MS) 
     {
-        WatchdogTimerID = radioTimer->setTimeout(RADIO_FAILSAFE_MS, SetChannelsFailSafe);  
+        SetChannelsFailSafe();
     }
 }
 
-void OP_Radio::restartWatchdog()
+uint32_t OP_Radio::LastFrameTime(void)
 {
-    if (radioTimer->isEnabled(WatchdogTimerID))
-    {   
-        // Re-set the timer to the beginning
-        radioTimer->restartTimer(WatchdogTimerID);
-    }
-    else
-    {   // In this case the timer hasn't been created yet, so do it now. 
-        startWatchdog();
+    switch (Protocol)
+    {
+        case PROTOCOL_PPM: 
+            return PPMDecoder->getLastFrameTime();
+            break;
+        
+        case PROTOCOL_SBUS:
+            return SBusDecoder->getLastFrameTime();
+            break;
+            
+        case PROTOCOL_iBUS:
+            return iBusDecoder->getLastFrameTime();
+            break;
+
+        case PROTOCOL_CRSF:
+            return CRSFDecoder->getLastFrameTime();
+            break;
+            
+        case PROTOCOL_NONE:
+        default:
+            return millis();    // No protocol, no signal to lose
     }
 }
 
@@ -523,6 +566,8 @@ void OP_Radio::restartWatchdog()
 void OP_Radio::GetFrame()
 {
     int16_t Pulse;                         // Temp var to save typing
+    int16_t Prior;                         // Oldest pulse in the median filter history
+    int16_t Median;                        // Median filter result
     int16_t NewPulse[ChannelsUtilized];    // Temporary array of pulses
 
     // Fill our NewPulse array with the new frame of data
@@ -539,6 +584,10 @@ void OP_Radio::GetFrame()
         case PROTOCOL_iBUS:
             iBusDecoder->GetiBus_Frame(NewPulse, ChannelsUtilized);
             break;      
+
+        case PROTOCOL_CRSF:
+            CRSFDecoder->GetCRSF_Frame(NewPulse, ChannelsUtilized);
+            break;      
         
         case PROTOCOL_NONE:
         default:
@@ -552,10 +601,25 @@ void OP_Radio::GetFrame()
         if (*ptrCommonChannelSettings[i].present == true)
         {
             Pulse = NewPulse[*ptrCommonChannelSettings[i].channelNum-1];    // We subtract one because in the array the channel numbers start at 0, not 1
-            if (*ptrCommonChannelSettings[i].pulse == Pulse) { *ptrCommonChannelSettings[i].updated = false; }
+            
+            // Jitter filter, see the notes in OP_RadioDefines.h. We keep the history up to date even if the median filter is off, it costs next to nothing. 
+            if (!FilterPrimed) { PulseHistory[i][0] = PulseHistory[i][1] = Pulse; }
+            Prior = PulseHistory[i][0];
+            PulseHistory[i][0] = PulseHistory[i][1];
+            PulseHistory[i][1] = Pulse;
+            if (*ptrCommonChannelSettings[i].medianFilter)
+            {   // Median of Prior, PulseHistory[i][0] and Pulse
+                if (Prior > PulseHistory[i][0]) { Median = Prior; Prior = PulseHistory[i][0]; } else { Median = PulseHistory[i][0]; }  // Now Prior is the lower of the two older pulses, Median the higher
+                if (Pulse < Median) Median = (Pulse > Prior) ? Pulse : Prior;
+                Pulse = Median;
+            }
+            
+            // Only pass the pulse on if it has moved more than the jitter band away from the pulse we last passed on
+            if (abs(Pulse - *ptrCommonChannelSettings[i].pulse) <= *ptrCommonChannelSettings[i].jitterBand) { *ptrCommonChannelSettings[i].updated = false; }
             else {*ptrCommonChannelSettings[i].updated = true; *ptrCommonChannelSettings[i].pulse = Pulse; }
         }
     }
+    FilterPrimed = true;
 
     return;
 }
@@ -563,11 +627,11 @@ void OP_Radio::GetFrame()
 // ---------------------------------------------------------------------------------------------------------------------------------------------------->>
 // GET FRAME IN STRING FORMAT - LOW LEVEL RADIO READING
 // ---------------------------------------------------------------------------------------------------------------------------------------------------->>
-// This is similar to the above in that it obtains a frame of pulse widths from either the PPM, SBus or iBus decoders, but instead of putting them into our channel objects, 
+// This is similar to the above in that it obtains a frame of pulse widths from either the PPM, SBus, iBus or CRSF decoders, but instead of putting them into our channel objects, 
 // it assembles them into a string and passes them back to the calling function in the form of a character array. This is used to send pulse widths to the PC. 
 void OP_Radio::GetStringFrame(char *chrArray, uint8_t buffer, uint8_t &StrLength, char delimiter, uint8_t HiLo)
 {
-// We only return 8 channels at a time. For SBus and iBus, you can request LOW or HIGH which will return either channels 1-8 or 9-16
+// We only return 8 channels at a time. For SBus, iBus, CRSF, or PPM with more than 8 channels, you can request LOW or HIGH which will return either channels 1-8 or 9-16
 #define COUNT_STRING_CHANNELS 8    
     
     uint8_t StartChan;
@@ -582,7 +646,7 @@ void OP_Radio::GetStringFrame(char *chrArray, uint8_t buffer, uint8_t &StrLength
     switch (Protocol)
     {
         case PROTOCOL_PPM:
-            HiLo = LOW; // By definition, PPM only goes up to 8 channels, so we only return the low 8 regardless of what was passed
+            // PPM can have up to 12 channels, so like SBus and iBus it may need to be sent in two halves
             PPMDecoder->GetPPM_Frame(NewPulse, channelCount);
             break;
         
@@ -596,6 +660,11 @@ void OP_Radio::GetStringFrame(char *chrArray, uint8_t buffer, uint8_t &StrLength
             iBusDecoder->GetiBus_Frame(NewPulse, channelCount);
             break;      
 
+        case PROTOCOL_CRSF:
+            // We will only call this function if we checked for a new frame first, so we don't need to poll CRSF again here
+            CRSFDecoder->GetCRSF_Frame(NewPulse, channelCount);
+            break;      
+
         case PROTOCOL_NONE:
         default:
             // Bad news bears, hope we don't end up here
@@ -812,7 +881,7 @@ int Pulse = AuxChannel[a].pulse;
 // ---------------------------------------------------------------------------------------------------------------------------------------------------->>
 // FAILSAFE
 // ---------------------------------------------------------------------------------------------------------------------------------------------------->>
-// If the watchdog timer expires, this function will be called
+// If the last valid frame is too old, checkWatchdog() will call this function
 void OP_Radio::SetChannelsFailSafe()
 {
     if (!InFailsafe)    
@@ -833,6 +902,7 @@ void OP_Radio::SetChannelsFailSafe()
         //    AuxChannel[a].pulse = 1500;
         //}
         SetAllChannelUpdates();    // This sets the updated flag for every channel. We want the main code to read the new failsafe values we have just written above. 
+        FilterPrimed = false;      // The median filter history is stale now, start it again from the first frame after we recover
         InFailsafe = true;         // Set the failsafe flag. The sketch will check this flag in order to take its own actions on failsafe. 
     }
 }
@@ -868,6 +938,11 @@ decodeState_t OP_Radio::Status(void)
             return iBusDecoder->getState();
             break;
 
+        case PROTOCOL_CRSF:
+            pollCRSF();     // CRSF needs polled
+            return CRSFDecoder->getState();
+            break;
+
         case PROTOCOL_NONE:
         default:
             return ACQUIRING_state;
@@ -891,6 +966,11 @@ boolean OP_Radio::NewFrame(void)
             polliBus();     // iBus needs polled
             return iBusDecoder->NewFrame;
             break;
+
+        case PROTOCOL_CRSF:
+            pollCRSF();     // CRSF needs polled
+            return CRSFDecoder->NewFrame;
+            break;
             
         case PROTOCOL_NONE:
         default:
@@ -915,6 +995,10 @@ uint8_t OP_Radio::getChannelCount(void)
         case PROTOCOL_iBUS:
             channelCount = iBusDecoder->getChanCount();
             break;
+
+        case PROTOCOL_CRSF:
+            channelCount = CRSFDecoder->getChanCount();
+            break;
         
         case PROTOCOL_NONE:
         default:
@@ -948,6 +1032,7 @@ void OP_Radio::Update(void)
 {   
     pollSBus();
     polliBus();
+    pollCRSF();
     // We don't need to update radioTimer because it is just a pointer to the sketch's timer, 
     // and the sketch will update that itself. 
 }
@@ -962,6 +1047,11 @@ void OP_Radio::polliBus(void)
     if (Protocol == PROTOCOL_iBUS) { iBusDecoder->update(); }
 }
 
+void OP_Radio::pollCRSF(void)
+{   // This checks if we're using the CRSF protocol, and if so, updates it
+    if (Protocol == PROTOCOL_CRSF) { CRSFDecoder->update(); }
+}
+
 void OP_Radio::slowDownForPCComm(void)
 {
     // Some protocols may operate at a speed too fast for reliable streaming to the PC, 
@@ -971,6 +1061,7 @@ void OP_Radio::slowDownForPCComm(void)
         case PROTOCOL_PPM:                                      break;   // No slow down implemented for PPM
         case PROTOCOL_SBUS: SBusDecoder->slowDownForPCComm();   break;
         case PROTOCOL_iBUS: iBusDecoder->slowDownForPCComm();   break;
+        case PROTOCOL_CRSF: CRSFDecoder->slowDownForPCComm();   break;
     }
 }
     
@@ -982,6 +1073,7 @@ void OP_Radio::defaultSpeed(void)
         case PROTOCOL_PPM:                                      break;   // No change needed for PPM
         case PROTOCOL_SBUS: SBusDecoder->defaultSpeed();        break;
         case PROTOCOL_iBUS: iBusDecoder->defaultSpeed();        break;
+        case PROTOCOL_CRSF: CRSFDecoder->defaultSpeed();        break;
     }
 }
 
@@ -26,6 +26,7 @@
 #include "../OP_PPMDecode/OP_PPMDecode.h"
 #include "../OP_SBusDecode/OP_SBusDecode.h"
 #include "../OP_IBusDecode/OP_iBusDecode.h"
+#include "../OP_CRSFDecode/OP_CRSFDecode.h"
 #include "../OP_Motors/OP_Motors.h"
 #include "../OP_SimpleTimer/OP_SimpleTimer.h"
 
@@ -34,8 +35,9 @@ typedef char RADIO_PROTOCOL;
 #define PROTOCOL_PPM    1                   // PPM protocol
 #define PROTOCOL_SBUS   2                   // SBus protocol
 #define PROTOCOL_iBUS   3                   // iBus protocol
+#define PROTOCOL_CRSF   4                   // CRSF protocol (TBS Crossfire, ExpressLRS)
 #define FIRST_RADIOPROTOCOL PROTOCOL_PPM    // So we know how to identify invalid values
-#define LAST_RADIOPROTOCOL  PROTOCOL_iBUS   // 
+#define LAST_RADIOPROTOCOL  PROTOCOL_CRSF   // 
 const __FlashStringHelper *RadioProtocol(RADIO_PROTOCOL RP); // Returns a pointer to a flash-stored character string that is the name of the radio protocol
 
 // This one is to print out turret stick positions
@@ -45,22 +47,33 @@ const __FlashStringHelper *TurretStickPosition(uint8_t TSP); // Returns a pointe
 const PROGMEM uint8_t TurretStickPositionStringLengths[SPECIALPOSITIONS+1] = { 7, 8, 9, 9, 11, 12, 12, 11, 12, 12 }; // We add one for "unknown"
 #define TS_PositionString_Length(p) pgm_read_byte_far(&TurretStickPositionStringLengths[p])
 
-                                    // From OP_PCComm.cpp we know we only have 800 mS to try all three protocols on the Read Radio routine (actually we can have up to 1 second but 
-                                    // the setting is 800mS). So we set these to something that will let us try all three in that time frame. 1/4 second should be enough. 
-#define PPM_TRY_TIME        250     // How long to try detecting a PPM signal, in mS. Only used in detect mode at startup. 
-#define SBUS_TRY_TIME       250     // How long to try detecting an SBus signal, in mS. Only used in detect mode at startup. 
-#define iBUS_TRY_TIME       250     // How long to try detecting an iBus signal, in mS. Only used in detect mode at startup. 
-
-#define RADIO_FAILSAFE_MS   300     // If we exceed this amount of time in milliseconds without reading a valid radio frame, go into failsafe. 
-                                    // 250 milliseconds is 1/4 second. That is a long time for an RC receiver, normally 12 PPM frames and over 25 SBus
-                                    // frames would have arrived in that time (although we throw away every other SBus frame so in fact it's about the same as PPM). 
+                                    // Radio detection (see detect() in OP_Radio.cpp) listens for PPM the whole time, on its own interrupt. The serial protocols have to take turns on the 
+                                    // serial port, but each only gets a short "sniff" window, just long enough to catch one valid frame at its slowest frame rate. Only a protocol that 
+                                    // produces a valid frame keeps the port for the longer acquire time, long enough for its 4 good frames in a row (40 mS frames for 25 Hz ExpressLRS). 
+#define SBUS_SNIFF_TIME     30      // SBus frames come every 14 mS at most (analog mode), so we should see a complete one within 2 frames
+#define iBUS_SNIFF_TIME     20      // iBus frames come every 7.7 mS
+#define CRSF_SNIFF_TIME     50      // ExpressLRS can be set as slow as 25 Hz (40 mS)
+#define SERIAL_ACQUIRE_TIME 180     // Once a serial protocol has produced a valid frame, it has this long to reach the ready state
+#define RADIO_SNIFF_CYCLE_MS (SBUS_SNIFF_TIME + iBUS_SNIFF_TIME + CRSF_SNIFF_TIME)   // One sniff window for each serial protocol, 100 mS
+#define RADIO_DETECT_WORST_MS ((2 * RADIO_SNIFF_CYCLE_MS) + SERIAL_ACQUIRE_TIME)
+                                    // Worst case: the serial signal comes on just after its own sniff window has opened, too late for a frame to land in it, so we wait out 
+                                    // that window and all the others. On its next turn the port opens part way through a frame, and the decoder can need one more frame to get 
+                                    // back in sync. At 25 Hz (ExpressLRS) that pushes the first good frame past the 50 mS window, so it misses again and we go round one more 
+                                    // full cycle before it gets the acquire time. That is 2 x 100 + 180 = 380 mS. PPM takes 7 frames (the first sync plus 6 good frames), at 
+                                    // most about 210 mS for 12 channels, and no longer however many serial protocols we add. From OP_PCComm.cpp we know we only have 800 mS 
+                                    // to detect the radio on the Read Radio routine, so this still leaves room. 
+
+#define RADIO_FAILSAFE_MS   300     // If the last valid radio frame is older than this amount of time in milliseconds, go into failsafe. 
+                                    // 300 milliseconds is roughly 1/3 second. That is a long time for an RC receiver, normally 13 PPM frames and 20 or more SBus
+                                    // frames would have arrived in that time. The decoders stamp every valid frame, including the SBus/iBus frames we discard, 
+                                    // and GetCommands() checks the age of the stamp each time it is called, so failsafe begins within one loop of the limit passing. 
 
 class OP_Radio
 {
     public: 
         OP_Radio();                                                     // Constructor
         static void             saveTimer(OP_SimpleTimer * t);          // Get a reference to the sketch's SimpleTimer
-        static void             begin(_eeprom_data *storage);           // This loads the save eeprom information into the radio object, and does basic initialization
+        static void             begin(_eeprom_hot *storage);            // This loads the save eeprom information into the radio object, and does basic initialization
         
         static void             detect();                               // See what kind of signal is attached
         static boolean          hasBegun(void);                         // Did we already call the begin() function yet? 
@@ -70,6 +83,7 @@ class OP_Radio
         static boolean          NewFrame(void);                         // Is a new PPM frame available
         static uint8_t          getChannelCount(void);                  // How many channels did the PPM decoder detect. Once set, this value doesn't change until reboot.
         static int              ChannelsUtilized;                       // This is the number of channels utilized, assuming you already calculated it (getChannelCount calculates it too) 
+        static uint16_t         getDetectTime(void);                    // How long detect() took to find the radio, in mS
 
         static boolean          UsingSpecialPositions;                  // Are any function triggers assigned to the "special stick" (turret stick special positions)
         static void             AdjustTurretStickEndPoints(void);       // If we are using special positions, we will need to artificially adjust the end-points of the turret stick
@@ -91,6 +105,7 @@ class OP_Radio
         static                  PPMDecode *PPMDecoder;                  // PPM Decoder object       
         static                  SBusDecode *SBusDecoder;                // SBus Decoder object
         static                  iBusDecode *iBusDecoder;                // iBus Decoder object
+        static                  CRSFDecode *CRSFDecoder;                // CRSF Decoder object
         static void             GetFrame(void);                         // Request a frame from the PPM/SBus decoder
         static void             GetStickCommand(stick_channel &ch);     // Calculate the four stick channel positions
         static int              GetSpecialPosition(sf_channel &sfc);    // Calculate the abstract "special stick" position, if used
@@ -102,22 +117,23 @@ class OP_Radio
         static void             ClearAllChannelUpdates(void);           // Set all channels to "not updated"
         static void             SetAllChannelUpdates(void);             // Set all channels to "updated"
         
-        static void             startWatchdog(void);                    // Create a watchdog timer
-        static void             restartWatchdog(void);                  // Re-starts the watchdog timer. We call this every time we get a new frame of data from the radio. 
-        static int              WatchdogTimerID;
+        static uint32_t         LastFrameTime(void);                    // Returns the millis() time of the last valid frame from whichever decoder is in use
+        static void             checkWatchdog(void);                    // Go into failsafe if the last valid frame is older than RADIO_FAILSAFE_MS. Called every time we look for commands. 
         
-        static void             failPPM(void);                          // If we fail to read PPM
-        static void             failSBus(void);                         // If we fail to read SBus
-        static void             failiBus(void);                         // If we fail to read iBus
-        static boolean          PPMFailed;                              // Are we trying to detect PPM? 
-        static boolean          SBusFailed;                             // Are we trying to detect SBus?
-        static boolean          iBusFailed;                             // Are we trying to detect iBus?        
+        static void             startSerial(RADIO_PROTOCOL p);          // Create and begin a serial decoder, used while detecting
+        static void             stopSerial(RADIO_PROTOCOL p);           // Shut down and delete a serial decoder, used while detecting
+        static decodeState_t    serialState(RADIO_PROTOCOL p);          // Poll a serial decoder and return its state, used while detecting
+        static uint32_t         serialLastFrameTime(RADIO_PROTOCOL p);  // millis() time of the last valid frame from a serial decoder, used while detecting
+        static uint16_t         DetectTime_mS;                          // How long detect() took
         static void             pollSBus(void);                         // SBus needs polling
         static void             polliBus(void);                         // iBus needs polling
+        static void             pollCRSF(void);                         // CRSF needs polling
         
-        static OP_SimpleTimer * radioTimer;                             // Used for watchdog timer and other stuff. Pointer to the sketch's SimpleTimer, rather than creating a new instance of the class. 
+        static OP_SimpleTimer * radioTimer;                             // Used for the turret stick ignore delays. Pointer to the sketch's SimpleTimer, rather than creating a new instance of the class. 
         static uint8_t          channelCount;                           // How many channels were detected in the PPM stream
         static common_channel_settings  ptrCommonChannelSettings[(STICKCHANNELS + AUXCHANNELS)];    // This array of pointers to common channel settings for all channels allows us to loop through them quickly, see GetPPMFrame() in RadioInputs tab. 
+        static int16_t          PulseHistory[(STICKCHANNELS + AUXCHANNELS)][2]; // The two pulses received before the latest one, for each channel, used by the median filter
+        static boolean          FilterPrimed;                           // Has PulseHistory been filled since we started or came out of failsafe
                                                                                                     // And yes, it says "ptr" but you see no *. But look in OP_RadioDefines.h for the struct definition, it is all pointers. 
         static int16_t          ignoreTurretDelay_mS;                   // Local copy of the user variable stored in eeprom
 
@@ -23,7 +23,7 @@
 #include <Arduino.h>
 
 // CHANNEL COUNTS                                               
-const byte COUNT_OP_CHANNELS    = 16;   // We can read up to 8 PPM channels (defined in OP_PPMDecode.h) or 16 SBUS channels (OP_SBusDecode.h)
+const byte COUNT_OP_CHANNELS    = 16;   // We can read up to 12 PPM channels (defined in OP_PPMDecode.h) or 16 SBUS channels (OP_SBusDecode.h)
                                         // If we wished to use less than that we could set this to less, but we will leave it at 16
                                         // 4 stick channels and (up to) 12 aux channels
 const byte STICKCHANNELS        = 4;    // There are always 4 channels associated with the two transmitter sticks, no more, no less
@@ -37,6 +37,7 @@ const byte AUXCHANNELS          = 12;   // There can be (up to) 12 aux channels
 // STICK CHANNELS (the four sticks)
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------->>
 #define DEFAULT_DEADBAND          15    // Default stick deadband (pulses less than deadband away from stick center are ignored)
+#define DEFAULT_JITTERBAND        3     // Default jitter band, in uS. See the notes for the jitter filter below. 
 
 typedef struct stick_channel_settings{  // Settings are saved to EEPROM
     uint8_t channelNum;                 // Which number are we in the PPM input stream
@@ -45,6 +46,8 @@ typedef struct stick_channel_settings{  // Settings are saved to EEPROM
     int16_t pulseCenter;                // PPM pulse center
     uint8_t deadband;                   // Pulse values below deadband are ignored
     boolean reversed;                   // Is the channel reversed
+    uint8_t jitterBand;                 // Pulse changes of this many uS or less are not passed on (see the jitter filter notes below)
+    boolean medianFilter;               // Pass on the median of the last three pulses rather than the latest one
 };
 
 typedef struct stick_channel {
@@ -86,6 +89,8 @@ typedef struct aux_channel_settings{    // Settings are saved to EEPROM
     boolean Digital;                    // Is this a digital channel (switch input) or an analog knob input? 
     uint8_t numPositions;               // If digital, how many positions does this switch have
     boolean reversed;                   // Is the channel reversed
+    uint8_t jitterBand;                 // Pulse changes of this many uS or less are not passed on (see the jitter filter notes below)
+    boolean medianFilter;               // Pass on the median of the last three pulses rather than the latest one
 };
 
 typedef struct aux_channels {
@@ -110,10 +115,27 @@ typedef struct common_channel_settings {
     boolean *updated;                   // Has the pulse changed since last check
     boolean *started;                   // Has a command just started
     boolean *present;                   // Did we detect this channel in the PPM stream? 
+    uint8_t *jitterBand;                // Jitter filter settings
+    boolean *medianFilter;
 };
 
 
 
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------->>
+// JITTER FILTER
+//-------------------------------------------------------------------------------------------------------------------------------------------------------------->>
+// Even with the sticks sitting perfectly still, the pulse widths we receive wander by a microsecond or two from frame to frame - partly the transmitter and 
+// receiver, partly our own measurement of PPM. If every one of those changes counted as an update, the sketch would recalculate stick commands, run analog 
+// special functions and send volume commands to the sound card on nearly every frame for no reason. So before a pulse is passed on to a channel, 
+// GetFrame() in OP_Radio.cpp runs it through a small filter whose settings are kept with the rest of the channel's settings in EEPROM: 
+// - jitterBand: the channel's pulse (and its updated flag) only changes once the new pulse is more than jitterBand uS away from the pulse we last passed on. 
+//   Because we compare to the last pulse passed on rather than to the last pulse received, slow jitter can't creep the value along, and a stick resting right on 
+//   the edge of the band doesn't flicker back and forth (hysteresis). Set to 0 to pass on every change, which is how the TCB used to work. 
+// - medianFilter: use the median of the last three pulses received instead of the latest. This throws out single-frame spikes (the odd corrupted PPM pulse) 
+//   at the cost of one frame of delay on real movements. Off by default for the sticks, on for the aux channels where the delay doesn't matter. 
+
+
+
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------->>
 // TURRET STICK SPECIAL POSITIONS
 //-------------------------------------------------------------------------------------------------------------------------------------------------------------->>
@@ -45,6 +45,11 @@
 // Static variables must be initialized outside the class 
 volatile OP_Servos::PortPin OP_Servos::Channel[SERVO_OUT_COUNT]; 
 volatile uint8_t OP_Servos::CurrentChannel;
+volatile OP_Servos::PortGroup OP_Servos::Group[SERVO_GROUP_COUNT];
+uint8_t OP_Servos::Mode = SERVO_MODE_SEQUENTIAL;
+volatile uint16_t OP_Servos::FrameCount = 0;
+uint16_t OP_Servos::LastFrameCount[SERVO_GROUP_COUNT];
+uint8_t OP_Servos::DirtyGroups = 0;
 
 // They are set to private, so you won't be able to access them from the sketch
 uint16_t OP_Servos::_GlobalMaxTicks = SERVO_uS_TO_TICKS(SERVO_OUT_MAXPULSE);
@@ -94,22 +99,53 @@ OP_Servos::OP_Servos()
         // and depends on the actual pulse widths, it could be as high as 100hz (all 8 servos at minimum pulse width of 1000). 
         // Anyway, this should work fine with all normal servos. 
         OP_Servos::setFrameSpace(8, 2000);
+
+        // Output groups for parallel mode. Servos 1-4 (drive and turret) in the first group, 5-8 (recoil and sound card props) in the second. 
+        // The frame periods are set in OP_Settings.h
+        OP_Servos::setGroupPins(0, 0x0F);
+        OP_Servos::setGroupPins(1, 0xF0);
+        OP_Servos::setGroupFrame_uS(0, SERVO_GROUP1_FRAME_uS);
+        OP_Servos::setGroupFrame_uS(1, SERVO_GROUP2_FRAME_uS);
         
         // Don't run this again
         initialized = true;
     }
 }
 
-void OP_Servos::begin()
+void OP_Servos::begin(uint8_t mode)
 {
     // OP_Servos uses Timer 1 Compare A interrupt. Timer 1 is setup in the main sketch, using a macro defined in OP_Settings.h
-
-    // Enable Timer 1 Output Compare A interrupt
-    TIMSK1 |= (1 << OCIE1A);        // TIMSK1, bit OCIE1A = Output Compare Interrupt Enable 1 A. 
-                                    // Set this flag to one to enable an interrupt to occur when the TCNT1 equals the Timer 1 Compare A value (OCR1A)
+    Mode = mode;
     
-    OCR1A = TCNT1 + 4000;           // Start in two milliseconds (4000 ticks at 2 ticks per microsecond/uS)
+    if (Mode == SERVO_MODE_PARALLEL)
+    {
+        uint8_t sreg = SREG;
+        cli();
+            // Start the first group in two milliseconds, and stagger the others by a millisecond each so their rising edges don't land on top of each other
+            for (uint8_t g=0; g<SERVO_GROUP_COUNT; g++)
+            {
+                buildGroupEdges(g, 0);
+                Group[g].Active = 0;
+                Group[g].Pending = false;
+                Group[g].EdgeIndex = 0;
+                Group[g].RiseTime = TCNT1 + 4000 + (g * 2000);
+                Group[g].Pulsing = false;
+                Group[g].RampTime_uS = 0;
+                Group[g].RampFrames = 0;
+                LastFrameCount[g] = 0;
+            }
+            DirtyGroups = 0;
+            OCR1A = Group[0].RiseTime;
+        SREG = sreg;
+    }
+    else
+    {
+        OCR1A = TCNT1 + 4000;           // Start in two milliseconds (4000 ticks at 2 ticks per microsecond/uS)
+    }
 
+    // Enable Timer 1 Output Compare A interrupt
+    TIMSK1 |= (1 << OCIE1A);            // TIMSK1, bit OCIE1A = Output Compare Interrupt Enable 1 A. 
+                                        // Set this flag to one to enable an interrupt to occur when the TCNT1 equals the Timer 1 Compare A value (OCR1A)
 }
 
 void OP_Servos::attach(uint8_t WhatChannel)
@@ -121,6 +157,7 @@ void OP_Servos::attach(uint8_t WhatChannel)
     cli();                          // Disable interrupts
         Channel[WhatChannel].Enabled = true;
     SREG = sreg;                    // Restore register
+    DirtyGroups = 0xFF;
 
     *ServoDDR |= 1 << WhatChannel;  // We set the pin to output
 
@@ -141,6 +178,7 @@ void OP_Servos::detach(uint8_t WhatChannel)
         Channel[WhatChannel].NumTicks = SERVO_uS_TO_TICKS(SERVO_OUT_MINPULSE);
         Channel[WhatChannel].Enabled = false;
     SREG = sreg;
+    DirtyGroups = 0xFF;
 }
 
 boolean OP_Servos::isAttached(uint8_t WhatChannel)
@@ -152,7 +190,8 @@ boolean OP_Servos::isAttached(uint8_t WhatChannel)
 // Timer1 Output Compare A interrupt service routine
 ISR(TIMER1_COMPA_vect)
 {
-    OP_Servos::OCR1A_ISR();
+    if (OP_Servos::getMode() == SERVO_MODE_PARALLEL) OP_Servos::Parallel_ISR();
+    else                                             OP_Servos::OCR1A_ISR();
 }
 
 
@@ -163,6 +202,7 @@ void OP_Servos::OCR1A_ISR()
     {   // Start over
         CurrentChannel = 0;
         OP_Servos::setPinLow(SERVO_OUT_COUNT-1);
+        FrameCount++;                   // Let updateRamps() know another frame has gone by
     }
     else
     {   
@@ -173,27 +213,147 @@ void OP_Servos::OCR1A_ISR()
     // Done with last pin, now set this pin high
     OP_Servos::setPinHigh(CurrentChannel);
 
-    // Set the duration of the pulse. We may need to modify the actual pulse if this is a ramped servo
-    if ( Channel[CurrentChannel].TickStep != 0 )
+    // Set the duration of the pulse. Any ramping has already been applied to NumTicks by updateRamps()
+    OP_Servos::setPulseWidthTimer(CurrentChannel);
+
+    // Go to next channel
+    CurrentChannel++;
+}
+
+
+// In parallel mode all the enabled pins of a group go high together at the start of the group's frame, then each goes low at its own time. 
+// The falling edges were sorted ahead of time by buildGroupEdges() so we only need one compare interrupt per distinct edge. All times are calculated 
+// from the time the interrupt was *scheduled* for, rather than the time it actually ran, so interrupt latency mostly cancels out of the pulse width. 
+void OP_Servos::Parallel_ISR()
+{
+    uint16_t Now = OCR1A;               // The time this interrupt was scheduled for
+    uint16_t Ahead;                     // Ticks from Now to some edge
+    uint16_t NextAhead;                 // Ticks from Now to the soonest edge of any group
+    uint8_t g, a;
+
+    while (true)
     {
-        OP_Servos::setPulseWidthTimer_Ramp(CurrentChannel);
+        NextAhead = 0xFFFF;
+        for (g=0; g<SERVO_GROUP_COUNT; g++)
+        {
+            a = Group[g].Active;
+            if (Group[g].Pulsing)
+            {   // Set low any pins whose falling edge is due
+                Ahead = Group[g].RiseTime + Group[g].EdgeTicks[a][Group[g].EdgeIndex] - Now;
+                while (Ahead <= SERVO_EDGE_MERGE_TICKS || Ahead >= SERVO_EDGE_LATE_TICKS)
+                {
+                    *ServoPort &= ~Group[g].EdgeMask[a][Group[g].EdgeIndex];
+                    if (++Group[g].EdgeIndex >= Group[g].EdgeCount[a])
+                    {   // That was the last pin of this frame
+                        Group[g].Pulsing = false;
+                        OP_Servos::endGroupFrame(g);
+                        break;
+                    }
+                    Ahead = Group[g].RiseTime + Group[g].EdgeTicks[a][Group[g].EdgeIndex] - Now;
+                }
+            }
+            else
+            {   // Waiting for the start of the frame
+                Ahead = Group[g].RiseTime - Now;
+                if (Ahead <= SERVO_EDGE_MERGE_TICKS || Ahead >= SERVO_EDGE_LATE_TICKS)
+                {
+                    if (Group[g].EdgeCount[a] > 0)
+                    {
+                        *ServoPort |= Group[g].RiseMask[a];
+                        Group[g].Pulsing = true;
+                    }
+                    else
+                    {   // Nothing enabled in this group, skip to the next frame
+                        OP_Servos::endGroupFrame(g);
+                    }
+                }
+            }
+
+            // Now how long until the next edge of this group (the active list may have changed above)
+            a = Group[g].Active;
+            if (Group[g].Pulsing) Ahead = Group[g].RiseTime + Group[g].EdgeTicks[a][Group[g].EdgeIndex] - Now;
+            else                  Ahead = Group[g].RiseTime - Now;
+            if (Ahead < NextAhead) NextAhead = Ahead;
+        }
+
+        // If the next edge is far enough away, set the compare register and leave. Otherwise the timer could pass it before we get out of here, 
+        // so wait for it and handle it now. 
+        Now += NextAhead;
+        if ((uint16_t)(Now - TCNT1) > SERVO_EDGE_GUARD_TICKS && (uint16_t)(Now - TCNT1) < SERVO_EDGE_LATE_TICKS)
+        {
+            OCR1A = Now;
+            return;
+        }
+        while ((int16_t)(Now - TCNT1) > 0) { ; }    // Wait until the timer reaches the edge (never more than a few ticks)
+    }
+}
+
+
+// Called from the parallel ISR when a group's frame is over. Schedules the next frame, switches to the new edge list if updateRamps() has 
+// prepared one, and counts ramp frames. 
+void OP_Servos::endGroupFrame(uint8_t g)
+{
+    Group[g].RiseTime += Group[g].FrameTicks;
+    Group[g].EdgeIndex = 0;
+    if (Group[g].Pending)
+    {
+        Group[g].Active ^= 1;
+        Group[g].Pending = false;
     }
-    else 
+    // One ramp step for every SERVO_RAMP_FRAME_uS of frame time, the remainder carried over to the next frame. A 333 hz group steps about every 
+    // fifth frame and a 50 hz group sometimes steps twice in one frame, but over time both step 70 times a second, which is what the ramp speeds assume. 
+    Group[g].RampTime_uS += Group[g].Frame_uS;
+    while (Group[g].RampTime_uS >= SERVO_RAMP_FRAME_uS)
     {
-        if ( Channel[CurrentChannel].RecoilState == 1 && ((millis() - Channel[CurrentChannel].RecoilStartTime) >  Channel[CurrentChannel].RecoilTime_mS ))
-        {   // Recoil time is up. Start the return. 
-            Channel[CurrentChannel].TickStep = Channel[CurrentChannel].RecoilTickStep_Return;   // Ramp back to starting position at the rate specified in the recoil return setting
-            Channel[CurrentChannel].RecoilState = 2;                // Kickback done, on the return journey
-            OP_Servos::setPulseWidthTimer_Ramp(CurrentChannel);     // This is a ramped movement
-        }       
-        else 
-        {   // This is the regular action. It simply sets the pulse width time
-            OP_Servos::setPulseWidthTimer(CurrentChannel);
+        Group[g].RampTime_uS -= SERVO_RAMP_FRAME_uS;
+        Group[g].RampFrames++;
+    }
+}
+
+
+// Sort the pulse widths of the enabled pins of a parallel group into a list of falling edges. Pins with the same pulse width share one edge. 
+// This is called from updateRamps() (never the ISR) and writes to whichever of the two edge lists the ISR is not using. 
+void OP_Servos::buildGroupEdges(uint8_t g, uint8_t b)
+{
+    uint16_t Ticks;
+    uint8_t  Mask;
+    uint8_t  Count = 0;
+    uint8_t  RiseMask = 0;
+    uint8_t  ch, i;
+
+    for (ch=0; ch<SERVO_OUT_COUNT-1; ch++)
+    {
+        Mask = Channel[ch].PinMask;
+        if (!(Group[g].PinMask & Mask) || !Channel[ch].Enabled) continue;
+        
+        Ticks = Channel[ch].NumTicks;
+        RiseMask |= Mask;
+
+        // Share an existing edge if one is close enough
+        for (i=0; i<Count; i++)
+        {
+            if ((uint16_t)(Ticks - Group[g].EdgeTicks[b][i] + SERVO_EDGE_MERGE_TICKS) <= (2 * SERVO_EDGE_MERGE_TICKS)) break;
+        }
+        if (i < Count) 
+        { 
+            Group[g].EdgeMask[b][i] |= Mask;
+            continue;
+        }
+        
+        // Otherwise insert a new edge in sorted order
+        i = Count++;
+        while (i > 0 && Group[g].EdgeTicks[b][i-1] > Ticks)
+        {
+            Group[g].EdgeTicks[b][i] = Group[g].EdgeTicks[b][i-1];
+            Group[g].EdgeMask[b][i] = Group[g].EdgeMask[b][i-1];
+            i--;
         }
+        Group[g].EdgeTicks[b][i] = Ticks;
+        Group[g].EdgeMask[b][i] = Mask;
     }
 
-    // Go to next channel
-    CurrentChannel++;
+    Group[g].EdgeCount[b] = Count;
+    Group[g].RiseMask[b] = RiseMask;
 }
 
 
@@ -229,20 +389,95 @@ void OP_Servos::setPulseWidthTimer(uint8_t WhatChannel)
 }
 
 
-// This is a similar function to the above except it increments or decrements the pulsewidth by the value of Step
-// We make it a separate function because it takes longer and this is run from within the ISR. If we don't need to use it,
-// which we often won't, the faster, inline function above will be called
-void OP_Servos::setPulseWidthTimer_Ramp(uint8_t WhatChannel)
+// Ramping and recoil used to be calculated inside the ISR for every channel on every frame, which made the ISR long and its length unpredictable. 
+// Now the ISR only counts frames, and this function (called every time through the main loop) applies one ramp step per frame that has gone by. 
+// In parallel mode it also rebuilds the sorted edge lists whenever a pulse width has changed. 
+void OP_Servos::updateRamps()
+{
+    uint16_t Frames[SERVO_GROUP_COUNT]; // Ramp frames that have gone by since last time, per group (in sequential mode all channels use the first)
+    uint16_t f;
+    uint8_t g, ch;
+    boolean Any = false;
+    byte sregRestore;
+
+    if (Mode == SERVO_MODE_PARALLEL)
+    {
+        for (g=0; g<SERVO_GROUP_COUNT; g++)
+        {
+            sregRestore = SREG;         // Two bytes written by the ISR, so read them with interrupts off
+            cli();
+            f = Group[g].RampFrames;
+            SREG = sregRestore;
+            Frames[g] = f - LastFrameCount[g];
+            LastFrameCount[g] = f;
+            if (Frames[g]) Any = true;
+        }
+    }
+    else
+    {
+        sregRestore = SREG;
+        cli();
+        f = FrameCount;
+        SREG = sregRestore;
+        Frames[0] = f - LastFrameCount[0];
+        LastFrameCount[0] = f;
+        if (Frames[0]) Any = true;
+    }
+
+    if (Any)
+    {
+        for (ch=0; ch<SERVO_OUT_COUNT-1; ch++)
+        {
+            f = Frames[0];
+            if (Mode == SERVO_MODE_PARALLEL)
+            {
+                for (g=0; g<SERVO_GROUP_COUNT; g++) 
+                {   
+                    if (Group[g].PinMask & Channel[ch].PinMask) { f = Frames[g]; break; }
+                }
+            }
+            if (f) OP_Servos::stepChannel(ch, f);
+        }
+    }
+
+    if (Mode == SERVO_MODE_PARALLEL && DirtyGroups)
+    {
+        for (g=0; g<SERVO_GROUP_COUNT; g++)
+        {   // We can only write to the spare list once the ISR has switched over to the last one we gave it
+            if ((DirtyGroups & (1 << g)) && !Group[g].Pending)
+            {
+                OP_Servos::buildGroupEdges(g, Group[g].Active ^ 1);
+                Group[g].Pending = true;
+                DirtyGroups &= ~(1 << g);
+            }
+        }
+    }
+}
+
+
+// Apply the given number of ramp steps to a channel. Step can be positive or negative. This is also where the recoil effect 
+// moves from the kick to the return phase. 
+void OP_Servos::stepChannel(uint8_t WhatChannel, uint16_t Frames)
 {
-    // Add step to current count. Step can be positive or negative.
-    uint16_t TotalTicks = (uint16_t)((int16_t)Channel[WhatChannel].NumTicks + Channel[WhatChannel].TickStep);
-    // TotalTicks needs to be unsigned, but we want signed for TickStep so we can add/subtract, hence the casting. 
+    if (Channel[WhatChannel].TickStep == 0)
+    {
+        if (Channel[WhatChannel].RecoilState == 1 && ((millis() - Channel[WhatChannel].RecoilStartTime) >  Channel[WhatChannel].RecoilTime_mS ))
+        {   // Recoil time is up. Start the return. 
+            Channel[WhatChannel].TickStep = Channel[WhatChannel].RecoilTickStep_Return;     // Ramp back to starting position at the rate specified in the recoil return setting
+            Channel[WhatChannel].RecoilState = 2;                                           // Kickback done, on the return journey
+        }       
+        else return;    // Nothing to do
+    }
+
+    // Add the steps to the current count
+    int32_t Total = (int32_t)Channel[WhatChannel].NumTicks + ((int32_t)Channel[WhatChannel].TickStep * Frames);
+    uint16_t TotalTicks;
 
     // Because adding or subtracting these could cause the value to go beyond our channel's 
     // specific min and max, we constrain
-    if ((TotalTicks > Channel[WhatChannel].MaxTicks) || (TotalTicks < Channel[WhatChannel].MinTicks))
+    if ((Total > Channel[WhatChannel].MaxTicks) || (Total < Channel[WhatChannel].MinTicks))
     {
-        TotalTicks = constrain(TotalTicks, Channel[WhatChannel].MinTicks, Channel[WhatChannel].MaxTicks);
+        TotalTicks = (Total > Channel[WhatChannel].MaxTicks) ? Channel[WhatChannel].MaxTicks : Channel[WhatChannel].MinTicks;
 
         // Exceeding the limits is also a signal we need to change the recoil status, if indeed this is a recoil event. 
         if (Channel[WhatChannel].RecoilState == 2)
@@ -251,13 +486,18 @@ void OP_Servos::setPulseWidthTimer_Ramp(uint8_t WhatChannel)
             Channel[WhatChannel].RecoilState = 0;   // Recoil over
         }
     }
+    else TotalTicks = (uint16_t)Total;
 
-    // After constraint, we set the channel's current tick value to the new value (plus or minus the step)
+    // After constraint, we set the channel's current tick value to the new value (plus or minus the steps)
     // This is what allows it to continue to change gradually over time
-    Channel[WhatChannel].NumTicks = TotalTicks;
-    
-    // Finally, set the timer
-    OCR1A = TCNT1 + TotalTicks;
+    if (TotalTicks != Channel[WhatChannel].NumTicks)
+    {
+        uint8_t sreg = SREG;        // Disable interrupts while we update the multi byte value 
+        cli();
+        Channel[WhatChannel].NumTicks = TotalTicks;
+        SREG = sreg;
+        DirtyGroups = 0xFF;
+    }
 }
 
 
@@ -277,6 +517,7 @@ void OP_Servos::writeMicroseconds(uint8_t WhatChannel, uint16_t Set_uS)
     cli();
     Channel[WhatChannel].NumTicks = Set_Ticks; 
     SREG = sreg;                // enable interrupts
+    DirtyGroups = 0xFF;         // Parallel mode edge lists need to be re-sorted
 }
 
 uint16_t OP_Servos::getPulseWidth(uint8_t WhatChannel)
@@ -479,6 +720,7 @@ void OP_Servos::StartRecoil(uint8_t WhatChannel)
         Channel[WhatChannel].NumTicks = Channel[WhatChannel].RecoiledNumTicks;  // Go straight to the other extreme
         Channel[WhatChannel].RecoilStartTime = millis();                        // Record the time so we know when the wait should be up
     SREG = sreg;            
+    DirtyGroups = 0xFF;
 }
 
 void OP_Servos::setRampStepPerFrame(uint8_t WhatChannel, int16_t Step)
@@ -525,6 +767,32 @@ void OP_Servos::setFrameSpace(uint8_t WhatChannel, uint16_t Set_uS)
     SREG = sreg;            // Restore register
 }
 
+void OP_Servos::setGroupPins(uint8_t WhatGroup, uint8_t PinMask)
+{
+    // Only applies to parallel mode. A pin should only belong to one group. 
+    if (WhatGroup >= SERVO_GROUP_COUNT) return;
+    
+    uint8_t sreg = SREG;
+    cli();
+        Group[WhatGroup].PinMask = PinMask;
+    SREG = sreg;
+    DirtyGroups = 0xFF;
+}
+
+void OP_Servos::setGroupFrame_uS(uint8_t WhatGroup, uint16_t Set_uS)
+{
+    // Only applies to parallel mode. The frame can't be shorter than the longest pulse, nor longer than we can track with Timer 1
+    if (WhatGroup >= SERVO_GROUP_COUNT) return;
+    
+    Set_uS = constrain(Set_uS, SERVO_GROUP_MIN_FRAME, SERVO_GROUP_MAX_FRAME);
+    
+    uint8_t sreg = SREG;
+    cli();
+        Group[WhatGroup].FrameTicks = SERVO_uS_TO_TICKS(Set_uS);
+        Group[WhatGroup].Frame_uS = Set_uS;         // Ramp steps are counted from this, see endGroupFrame()
+    SREG = sreg;
+}
+
 
 // MOVED TO OP_Settings.h as defines, mostly just to have them all in one place. 
 // Convert 
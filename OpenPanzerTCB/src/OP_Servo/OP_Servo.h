@@ -51,6 +51,24 @@
 
 #define SERVO_MAXRAMP_TICKSTEP  50
 
+// Frame generation modes. 
+// Sequential:  the original method. Servos are pulsed one after another followed by a frame space, so the refresh rate depends on the sum of all pulse widths
+//              (roughly 55-100 hz). 
+// Parallel:    all servos in an output group rise together at the start of the group's frame and then fall in order of pulse width, with one compare interrupt
+//              per distinct falling edge. Each group can have its own frame period, so fast digital servos and ESCs can be run at up to 333 hz while other outputs 
+//              (sound card inputs for example) stay at a standard 50 hz. 
+#define SERVO_MODE_SEQUENTIAL   0
+#define SERVO_MODE_PARALLEL     1
+
+// Parallel mode output groups. A group is defined by a mask of the port pins belonging to it. A pin should only belong to one group. 
+#define SERVO_GROUP_COUNT       2
+#define SERVO_GROUP_MIN_FRAME   3000        // Minimum frame period in uS (333 hz). Must be longer than SERVO_OUT_MAXPULSE
+#define SERVO_GROUP_MAX_FRAME   25000       // Maximum frame period in uS. Must be well under one Timer 1 rollover (32.7 mS), see SERVO_EDGE_LATE_TICKS
+#define SERVO_RAMP_FRAME_uS     14286       // Ramp steps are defined per frame at an assumed 70 hz refresh (see setRampSpeed_mS). Parallel groups take one step per this much frame time.
+#define SERVO_EDGE_MERGE_TICKS  1           // Falling edges this close together (in ticks) are combined into a single edge
+#define SERVO_EDGE_GUARD_TICKS  8           // If the next edge is closer than this when we leave the ISR, we wait for it rather than risk missing the compare match
+#define SERVO_EDGE_LATE_TICKS   0xF000      // Edges more than this far "ahead" are actually overdue (the ISR was held off), handle them immediately
+
 class OP_Servos
 {
     // We are using static for everything because we only want one instance of this class. 
@@ -59,11 +77,15 @@ public:
 //  static void setup();
 
     // configures timer1
-    static void begin();
+    static void begin(uint8_t Mode = SERVO_MODE_SEQUENTIAL);
 
     // Called by the timer interrupt service routine, see the cpp file for details.
     // Don't really want it public, but it has to be for the ISR to see it
     static void OCR1A_ISR();
+    static void Parallel_ISR();
+    
+    // Must be called routinely from the main loop. Applies ramp steps and recoil effects, see the cpp file for details.
+    static void updateRamps(void);
 
     // called to set the pulse width for a specific channel, pulse widths are in microseconds 
     static void attach(uint8_t);
@@ -83,6 +105,11 @@ public:
     static void StartRecoil(uint8_t);   // Kick off a recoil event
     static void setRecoilReversed(uint8_t, boolean);
     
+    // Parallel mode only
+    static void setGroupPins(uint8_t, uint8_t);     // Set which port pins belong to an output group (pass the group number and a pin mask)
+    static void setGroupFrame_uS(uint8_t, uint16_t);// Set the frame period of an output group in microseconds
+    static uint8_t getMode(void) { return Mode; }
+    
 protected:
     class PortPin
     {   public:
@@ -99,17 +126,49 @@ protected:
             int16_t  RecoilTickStep_Return; // Specific tick step for slowly returning the barrel to starting position after recoil kick
     };
 
+    // In parallel mode each group of pins has its own frame, and a list of falling edges sorted by time
+    class PortGroup
+    {   public:
+            uint8_t  PinMask;           // Which pins belong to this group
+            uint16_t FrameTicks;        // Frame period in timer ticks
+            uint16_t Frame_uS;          // Frame period in uS, added to RampTime_uS at the end of every frame
+            uint16_t RampTime_uS;       // Frame time not yet turned into ramp steps. Carries the remainder over, so ramp speed doesn't depend on frame rate.
+            uint16_t RampFrames;        // Incremented once per SERVO_RAMP_FRAME_uS of frame time, read by updateRamps()
+            uint16_t RiseTime;          // Timer 1 count at which the current frame started (or the next one will start)
+            boolean  Pulsing;           // Are the pins of this group presently high
+            uint8_t  EdgeIndex;         // Next falling edge to process
+            // There are two edge lists. The ISR uses the Active one while updateRamps() prepares the other, the ISR switches to it at the end of a frame if Pending
+            uint8_t  Active;            
+            boolean  Pending;           
+            uint8_t  RiseMask[2];       // Pins to set high at the start of the frame (enabled pins of this group)
+            uint8_t  EdgeCount[2];      // Number of distinct falling edges in the frame
+            uint16_t EdgeTicks[2][SERVO_OUT_COUNT-1];   // Falling edge times, in ticks from RiseTime, sorted in ascending order
+            uint8_t  EdgeMask[2][SERVO_OUT_COUNT-1];    // Pins to set low at each edge
+    };
+
     static boolean initialized; 
     static void setPinHigh(uint8_t) __attribute__((always_inline));
     static void setPinLow(uint8_t) __attribute__((always_inline));    
     static void setPulseWidthTimer(uint8_t) __attribute__((always_inline));
-    static void setPulseWidthTimer_Ramp(uint8_t);
+    static void endGroupFrame(uint8_t) __attribute__((always_inline));
+    static void buildGroupEdges(uint8_t, uint8_t);
+    static void stepChannel(uint8_t, uint16_t);
     
     // Information about each channel
     static volatile PortPin Channel[SERVO_OUT_COUNT]; 
     
     // current output channel
     static volatile uint8_t CurrentChannel;    
+    
+    // Frame counting for updateRamps(). These are 16 bits so the counts only wrap after 65535 ramp frames, about 15 minutes at 70 hz. 
+    // Unless updateRamps() goes that long without being called, no steps are lost however long the sketch was held up. 
+    static volatile uint16_t FrameCount;                    // Sequential mode frames, incremented by the ISR
+    static uint16_t LastFrameCount[SERVO_GROUP_COUNT];      // Frame counts the last time updateRamps() ran
+    static uint8_t DirtyGroups;                             // Flags for parallel groups whose edge lists need to be rebuilt
+
+    // Parallel mode
+    static uint8_t Mode;
+    static volatile PortGroup Group[SERVO_GROUP_COUNT];
 
     // Moved to OP_Settings.h as defines
     // Convert microseconds to timer ticks 
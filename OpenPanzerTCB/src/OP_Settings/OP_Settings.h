@@ -102,7 +102,8 @@
     //    last signal, it knows how long the pulse-width is
     // [] OP_Servos - uses Timer 1's Output Compare A to set a timed interrupt to generate servo pulse widths
     // [] IRsendBase - uses Timer 1's Output Compare B to set a timed interrupt to generate infra-red pulses. IRsend also uses Timer 2 for the actual PWM.
-    // [] SBusDecode/iBusDecode - uses Timer 1's Output Compare C to set a timed interrupt that we use for error checking of the incoming pulse stream
+    // [] SBusDecode/iBusDecode - read TCNT1 to measure the time between incoming bytes, which we use for error checking of the incoming data stream
+    // [] OP_TaigenSound - uses Timer 1's Output Compare C to set a timed interrupt at each edge of the Taigen sound card data stream
 
     // We set up Timer 1 in Normal Mode: count starts from BOTTOM (0), goes to TOP (0xFFFF / 65,535), then rolls over. 
     // We set prescaler to 8. With a 16MHz clock that gives us 1 clock tick every 0.5 uS (0.0000005 seconds).
@@ -150,8 +151,9 @@
 // ------------------------------------------------------------------------------------------------------------------------------------------------------->>
 // TIMER 3
 // ------------------------------------------------------------------------------------------------------------------------------------------------------->>
-    // Timer 3 is used for ramping effects: 
-    // OP_Driver - uses Timer 3's Output Compare A for acceleration and deceleration ramping of the main drive motors
+    // Timer 3 is not presently used. 
+    // OP_Driver used to use Timer 3's Output Compare A for acceleration and deceleration ramping of the main drive motors, but now works out ramp updates 
+    // from elapsed time whenever drive and throttle speeds are requested. 
     
 
 // ------------------------------------------------------------------------------------------------------------------------------------------------------->>
@@ -160,7 +162,7 @@
     // Timer 4 is used to generate PWM for the Aux Output (if used in analog mode) and the "Hit Notification LEDs" which are the LEDs typically installed 
     // in the IR apple. These LEDs are dimmed and faded in and out to create various effects. 
     
-    // We also use Timer 4's overflow interrupt to generate a stream of data that can control a Taigen sound card. 
+    // Timer 4's overflow interrupt used to generate the stream of data for the Taigen sound card, that is now done with Timer 1 Compare C instead. 
     
     // We set Timer 4 to Fast PWM 10-bit (WGM4 3:0 0111) with a prescaler of 8 (CS4 2:0 010). We leave COM4B and COM4C pins connected to PWM (COM 10)
     // but disconnect PWM from COM4A pin (it can still be used as a digital I/O and it controls part of the direction for onboard motor driver A and is 
@@ -168,20 +170,17 @@
     
     // PWM for the Aux output and Hit Notify LEDs will be 1.95kHz (basically 2kHz). That would be kind of noisy for motors but for switching LEDs is more than fast enough. 
     // Timer 4 will tick (TCNT4 increment) once every 0.5 uS, or in other words, one uS = 2 ticks. 10-bit mode means TOP is equal to 1024, which means Timer 4 will overflow
-    // every (1024 ticks * 0.5uS per tick) = 512 uS or almost exactly 1/2 mS. This works very well because the data stream for the Taigen sound cards all involve
-    // pulses in increments of 1/2mS. 
+    // every (1024 ticks * 0.5uS per tick) = 512 uS or almost exactly 1/2 mS. 
 
-    // NOTE: Our first thought was to use an output compare (OCR4A) to create interrupts at specified times the way we do with generating servo pulses. The problem with this is 
+    // NOTE: Our first thought for Taigen was to use an output compare (OCR4A) to create interrupts at specified times the way we do with generating servo pulses. The problem with this is 
     // that unless you are in Normal or CTC mode, OCRnx doesn't update immediately, making it of little use for this purpose. But using Normal or CTC mode doesn't really leave us
-    // with a useful PWM signal which we want for the other two pins (OC4B and OC4C). So setting an overflow every increment of time and counting overflows works well. 
-    
-    // NOTE: Instead of 10-bit with a TOP of 1024 we could set top to a custom number using ICR4, for example we could set it to 1,000 so each rollover is precisely 1/2mS. 
-    // Nothing wrong with that, but actually the Taigen pulses tend to go a little long anyway, so 1024 seems to work just fine. 
+    // with a useful PWM signal which we want for the other two pins (OC4B and OC4C). So for a while we counted Timer 4 overflows instead, which meant an interrupt every 1/2 mS 
+    // whether the pin needed to change or not. Timer 1 is already in Normal mode, so Compare C there does the job with one interrupt per edge. 
 
     // TCCR4A = 0x2B    // PWM disabled on OCR4A - Fast PWM 10 bit
     // TCCR4B = 0x0A    // Fast PWM, 8  prescaler, TOP 1024 - frequency 2 KHz, tick every 0.5uS (2 ticks per uS)
     // TIFR4 = 0x2F     // Clear all interrupt flags
-    // TIMSK4 = 0x00    // No interrupts enabled - later in OP_TaigenSound.cpp we will enable overflow interrupts by setting the TOIE4 bit in TIMSK4. 
+    // TIMSK4 = 0x00    // No interrupts enabled
     #define SetupTimer4() ({ \  
         TCCR4A = 0x2B;       \
         TCCR4B = 0x0A;       \
@@ -264,14 +263,16 @@
     // but setting it too high will waste RAM. Each additional slot costs 19 bytes of global RAM. 
 
     // Our best estimate as of 9/22/2016 (version 00.91.06) is: 
-    // Main Sketch:     7       At least 14 slots but shouldn't be more than 7 active at any one time
-    // OP_Radio:        3       4 slots but only up to 3 utilized at one time (radio detect, watchdog, elevation & azimuth ignore timers)
+    // Main Sketch:     9       11 slots since the engine idle-off and nudge timers were removed. While driving no more than 6 can be active (voltage check, 
+    //                          aux output, turn blinker, transmission delay, IO A & B pulses), plus the 3 one-shot startup timers (waiting-for-radio message, 
+    //                          restore debug, system info dump) in the first couple seconds after boot. Failsafe and LVC blinking replace the driving ones. 
+    // OP_Radio:        2       Elevation & azimuth ignore timers. Radio detection and the failsafe watchdog no longer use timers, see OP_Radio::detect() and checkWatchdog()
     // OP_Tank:         11      At least 15 slots but shouldn't be possible for more than 11 to be active at one time
-    // OP_TBS (sound):  5       Prop2, Prop3, plus 3 squeak slots, all could be active simultaneously
+    // OP_TBS (sound):  3       Prop2, Prop3, and one slot shared by all the squeaks (see OP_TBS::SqueakTick), all could be active simultaneously
     //-----------------------
-    // TOTAL:           26   
+    // TOTAL:           25   
 
-    #define MAX_SIMPLETIMER_SLOTS       30          // Based on the calculations above, this gives us a few extra slots in case we miscalculated or if we need to add more
+    #define MAX_SIMPLETIMER_SLOTS       29          // Based on the calculations above, this gives us the same four extra slots we have always kept in case we miscalculated or if we need to add more
                                                     // But any time you add more you should re-visit this list. Sometimes extra timer slots can be used that would only 
                                                     // operate at times when other timers must be inactive, so not all new timers require the creation of new slots. 
 
@@ -281,6 +282,14 @@
     // What pulsewidth for stopping a "servo" ESC. Should be 1500. 
     #define SERVO_ESC_STOP              1500
     
+    // How the servo pulses are generated, see OP_Servo.h. SERVO_MODE_SEQUENTIAL pulses the outputs one after the other (the original method), 
+    // SERVO_MODE_PARALLEL pulses all outputs of a group at once. In parallel mode outputs 1-4 (drive and turret) are one group and 5-8 (recoil
+    // and sound card props) are another, and each group can have its own frame period. Digital servos and fast ESCs can go as low as 3000 uS (333 hz), 
+    // but leave the second group at 20000 uS (50 hz) if you are using a Benedini or Taigen sound card. 
+    #define SERVO_FRAME_MODE            SERVO_MODE_SEQUENTIAL
+    #define SERVO_GROUP1_FRAME_uS       20000   // Frame period for servo outputs 1-4 in parallel mode
+    #define SERVO_GROUP2_FRAME_uS       20000   // Frame period for servo outputs 5-8 in parallel mode
+    
     // We need to set which of the eight servo outputs will be used for drive motors (left and right) and turret motors, amongst other things.
     // Not every setup will require servo outputs for drive or turret motors, but if they do, they should always map to the same servo number. 
     #define SERVONUM_LEFTTREAD          SERVO_1     // This is the left-most servo output on the board, looking from the top. Servo 1 on the TCB board (Arduino 22, ATmega A0)
@@ -383,6 +392,10 @@
         #define IO_port                  DDRK     // What Atmega port are the IO pins on (Port K on TCB)
         #define IO_A_bit                 1        // What bit in port_IO is IO "A"
         #define IO_B_bit                 0        // What bit in port_IO is IO "B"
+        #define IO_PCMSK                 PCMSK2   // Pin-change interrupt mask for the IO pins. K0 and K1 are PCINT16 and 17, which are bits 0 and 1 of PCMSK2, same as their bits in port K
+        #define IO_PCIE                  PCIE2    // Pin-change interrupt enable bit in PCICR for that group
+        #define IO_PCIF                  PCIF2    // And its flag bit in PCIFR
+        #define IO_PCINT_vect            PCINT2_vect
         #define pin_BattVoltage          A15      // Input    - Battery voltage monitor through voltage divider (1/3 scaling ratio) (ATmega K7)
 
     // Dipswitch pins
@@ -432,6 +445,106 @@
         // - Hardware Serial, SPI, and I2C ports (defined by Arduino)
 
 
+// ------------------------------------------------------------------------------------------------------------------------------------------------------->>
+// DIRECT PORT ACCESS
+// ------------------------------------------------------------------------------------------------------------------------------------------------------->>
+    // digitalWrite() and digitalRead() look up the port and bit of the pin in three PROGMEM tables, then check if the pin has PWM and turn it off, 
+    // and digitalWrite() also disables interrupts while it writes - roughly 60-70 cycles (4 uS) for something that could take 2. The pins above never 
+    // change, so for the ones we use in the main loop we define their port registers and bit here, and the PIN_ macros below resolve at compile time. 
+    // On ports A-G a write compiles to a single sbi/cbi instruction. Ports H-L are outside the range of sbi/cbi so the compiler has to read, modify 
+    // and write the register; in that case interrupts are disabled for those few cycles, so an ISR can't change another bit on the same port in between. 
+    // 
+    // These must agree with the Arduino pin numbers above! If you change a pin, change it here too. 
+    // 
+    // Usage:   PIN_HIGH(pin_Light1);   PIN_LOW(pin_Light1);    PIN_WRITE(pin_Light1, state);   if (PIN_READ(pin_Dip5)) ...
+    //          Pass the name of the pin (pin_Light1), the macros find the rest from it. 
+    // PWM:     Unlike digitalWrite(), these do not disconnect PWM from the pin. For pins we also use with analogWrite(), call PIN_PWM_OFF(pin) first. 
+    
+        // For each pin: its output (PORT) register, input (PIN) register, and bit. Pins that can also be driven by PWM have the timer control register and compare output bit as well.
+        #define pin_Dip1_PORT           PORTF
+        #define pin_Dip1_PIN            PINF
+        #define pin_Dip1_BIT            PF6
+        #define pin_Dip2_PORT           PORTF
+        #define pin_Dip2_PIN            PINF
+        #define pin_Dip2_BIT            PF5
+        #define pin_Dip3_PORT           PORTK
+        #define pin_Dip3_PIN            PINK
+        #define pin_Dip3_BIT            PK2
+        #define pin_Dip4_PORT           PORTK
+        #define pin_Dip4_PIN            PINK
+        #define pin_Dip4_BIT            PK3
+        #define pin_Dip5_PORT           PORTK
+        #define pin_Dip5_PIN            PINK
+        #define pin_Dip5_BIT            PK4
+        #define pin_RepairTank_PORT     PORTC
+        #define pin_RepairTank_PIN      PINC
+        #define pin_RepairTank_BIT      PC4
+        #define pin_Button_PORT         PORTK
+        #define pin_Button_PIN          PINK
+        #define pin_Button_BIT          PK6
+        #define pin_RedLED_PORT         PORTF
+        #define pin_RedLED_PIN          PINF
+        #define pin_RedLED_BIT          PF3
+        #define pin_GreenLED_PORT       PORTF
+        #define pin_GreenLED_PIN        PINF
+        #define pin_GreenLED_BIT        PF4
+        #define pin_Light1_PORT         PORTB
+        #define pin_Light1_PIN          PINB
+        #define pin_Light1_BIT          PB0
+        #define pin_Light2_PORT         PORTE
+        #define pin_Light2_PIN          PINE
+        #define pin_Light2_BIT          PE3
+        #define pin_Brakelights_PORT    PORTG
+        #define pin_Brakelights_PIN     PING
+        #define pin_Brakelights_BIT     PG5
+        #define pin_Brakelights_TCCR    TCCR0A          // OC0B - Timer 0, used by analogWrite() for the running lights
+        #define pin_Brakelights_COM     COM0B1
+        #define pin_AuxOutput_PORT      PORTH
+        #define pin_AuxOutput_PIN       PINH
+        #define pin_AuxOutput_BIT       PH5
+        #define pin_AuxOutput_TCCR      TCCR4A          // OC4C - Timer 4, see SetupTimer4() above
+        #define pin_AuxOutput_COM       COM4C1
+        #define pin_MuzzleFlash_PORT    PORTG
+        #define pin_MuzzleFlash_PIN     PING
+        #define pin_MuzzleFlash_BIT     PG0
+        #define pin_HitNotifyLEDs_PORT  PORTH
+        #define pin_HitNotifyLEDs_PIN   PINH
+        #define pin_HitNotifyLEDs_BIT   PH4
+        #define pin_HitNotifyLEDs_TCCR  TCCR4A          // OC4B - Timer 4, see SetupTimer4() above
+        #define pin_HitNotifyLEDs_COM   COM4B1
+        #define pin_MechRecoilMotor_PORT PORTL
+        #define pin_MechRecoilMotor_PIN PINL
+        #define pin_MechRecoilMotor_BIT PL6
+        #define pin_IO_A_PORT           PORTK
+        #define pin_IO_A_PIN            PINK
+        #define pin_IO_A_BIT            PK1
+        #define pin_IO_B_PORT           PORTK
+        #define pin_IO_B_PIN            PINK
+        #define pin_IO_B_BIT            PK0
+        #define OB_MA1_PORT             PORTB
+        #define OB_MA1_PIN              PINB
+        #define OB_MA1_BIT              PB4
+        #define OB_MA2_PORT             PORTH
+        #define OB_MA2_PIN              PINH
+        #define OB_MA2_BIT              PH3
+        #define OB_MB1_PORT             PORTB
+        #define OB_MB1_PIN              PINB
+        #define OB_MB1_BIT              PB7
+        #define OB_MB2_PORT             PORTB
+        #define OB_MB2_PIN              PINB
+        #define OB_MB2_BIT              PB5
+
+    // The ## pastes the suffix onto the pin name before the preprocessor gets a chance to replace the name with its Arduino pin number
+    #define PIN_HIGH(pin)               PORT_ATOMIC(pin##_PORT, pin##_PORT |= _BV(pin##_BIT))
+    #define PIN_LOW(pin)                PORT_ATOMIC(pin##_PORT, pin##_PORT &= ~_BV(pin##_BIT))
+    #define PIN_WRITE(pin, val)         do { if (val) PORT_ATOMIC(pin##_PORT, pin##_PORT |= _BV(pin##_BIT)); else PORT_ATOMIC(pin##_PORT, pin##_PORT &= ~_BV(pin##_BIT)); } while (0)
+    #define PIN_READ(pin)               ((pin##_PIN & _BV(pin##_BIT)) ? HIGH : LOW)
+    #define PIN_PWM_OFF(pin)            PORT_ATOMIC(pin##_TCCR, pin##_TCCR &= ~_BV(pin##_COM))
+    // Registers in the low 32 I/O addresses (ports A-G) are changed by a single sbi/cbi, which can't be interrupted. Anything else needs protecting. 
+    // The test is a compile-time constant so only one branch is ever compiled. 
+    #define PORT_ATOMIC(reg, op)        do { if (_SFR_IO_ADDR(reg) < 0x20) { op; } else { uint8_t sreg = SREG; cli(); op; SREG = sreg; } } while (0)
+
+
 
 
 #endif
@@ -30,6 +30,34 @@ const __FlashStringHelper *printSoundDevice(SOUND_DEVICE Device)
 }
 
 
+// Engine speed publisher - see OP_Sound.h 
+OP_SpeedPublisher::OP_SpeedPublisher(uint16_t i, uint8_t d) : _interval(i), _delta(d), _lastSent(0), _lastSeen(0), 
+                                                            _lastSendTime(0), _lastChangeTime(0), _sent(0), _suppressed(0) {}
 
-
-
+boolean OP_SpeedPublisher::update(int s)
+{
+    uint32_t now = millis();
+    boolean changed = false;
+    
+    if (s != _lastSeen)
+    {
+        _lastSeen = s;
+        _lastChangeTime = now;
+        changed = true;
+    }
+    
+    // Nothing new to send (this also covers a speed that wandered off and came back before we sent it)
+    if (s == _lastSent) return false;
+    
+    // Send if enough time has passed, and either the change is big enough or the speed has stopped changing
+    if ((now - _lastSendTime) >= _interval && (abs(s - _lastSent) >= _delta || (now - _lastChangeTime) >= _interval))
+    {
+        _lastSent = s;
+        _lastSendTime = now;
+        _sent++;
+        return true;
+    }
+    
+    if (changed) _suppressed++;
+    return false;
+}
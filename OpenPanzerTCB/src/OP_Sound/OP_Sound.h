@@ -33,11 +33,50 @@ typedef char SOUND_DEVICE;
 const __FlashStringHelper *printSoundDevice(SOUND_DEVICE Device); //Returns a character string that is name of the sound device
 
 
+// ------------------------------------------------------------------------------------------------------------------>>
+// ENGINE SPEED PUBLISHER
+// ------------------------------------------------------------------------------------------------------------------>>
+// Throttle speed changes by a count or two every few milliseconds during a ramp. Some sound devices (the OP Sound Card) need a serial packet 
+// for every update, on the same port as the serial drive ESCs. The publisher decides which updates are worth sending: a new value goes out 
+// only if at least the minimum interval has passed since the last one, and it differs from the last one by at least the minimum delta. 
+// Smaller changes are held back until the speed settles (stops changing for one interval), so the final value always gets through. 
+#define ENGINE_SPEED_MIN_INTERVAL_mS    50      // Send engine speed no more than 20 times a second
+#define ENGINE_SPEED_MIN_DELTA          3       // Out of 255
+
+class OP_SpeedPublisher {
+  public:
+    OP_SpeedPublisher(uint16_t i = ENGINE_SPEED_MIN_INTERVAL_mS, uint8_t d = ENGINE_SPEED_MIN_DELTA);
+    void     setPolicy(uint16_t i, uint8_t d)   { _interval = i; _delta = d; }
+    boolean  update(int);                       // Pass the latest speed every time through the loop. Returns true if it should be sent now. 
+    int      value(void)                        { return _lastSent; }   // The last value we said to send
+    uint32_t sent(void)                         { return _sent; }       // How many updates we let through
+    uint32_t suppressed(void)                   { return _suppressed; } // How many changes we held back
+    
+  private:
+    uint16_t _interval;                         // Minimum time between updates, mS
+    uint8_t  _delta;                            // Minimum change to send before the value settles
+    int      _lastSent;
+    int      _lastSeen;
+    uint32_t _lastSendTime;
+    uint32_t _lastChangeTime;
+    uint32_t _sent;
+    uint32_t _suppressed;
+};
+
+
 class OP_Sound {
   public:
     OP_Sound() {}                                       // Constructor
     virtual void begin() =0;                            // Setups
     
+    // Engine speed, rate limited. Call this every time through the loop with the latest throttle speed, rather than calling SetEngineSpeed directly.
+    // Returns true if the speed was sent, PublishedEngineSpeed() then gives the value that went out. 
+    boolean  PublishEngineSpeed(int s)                  { if (_engineSpeed.update(s)) { SetEngineSpeed(_engineSpeed.value()); return true; } return false; }
+    int      PublishedEngineSpeed(void)                 { return _engineSpeed.value();          }
+    void     SetEngineSpeedPolicy(uint16_t i, uint8_t d){ _engineSpeed.setPolicy(i, d);         }   // Minimum interval in mS, minimum delta
+    uint32_t EngineSpeedUpdatesSent(void)               { return _engineSpeed.sent();           }
+    uint32_t EngineSpeedUpdatesSuppressed(void)         { return _engineSpeed.suppressed();     }
+    
     // Engine sound functions   
     virtual void StartEngine(void) =0;  
     virtual void StopEngine(void) =0;   
@@ -85,6 +124,9 @@ class OP_Sound {
     virtual void DecreaseVolume(void) =0;               // Start decreasing the volume (will keep decreasing until stop is called or volume reaches min)
     virtual void StopVolume(void) =0;                   // Stop changing volume
 
+  private:
+    OP_SpeedPublisher _engineSpeed;
+
 };
 
 
@@ -97,7 +139,7 @@ class OP_Sound {
 
 class BenediniTBS: public OP_Sound, public OP_TBS {
   public:
-    BenediniTBS(OP_SimpleTimer * t) : OP_Sound(), OP_TBS(t)    {} // TBS requires pointer to SimpleTimer object
+    BenediniTBS(OP_SimpleTimer * t, OP_Arena &a) : OP_Sound(), OP_TBS(t, a) {} // TBS requires pointer to SimpleTimer object, and an arena for its servo object
     void begin()                                                { OP_TBS::begin();                     }
 
   // Engine sound functions
@@ -133,7 +175,7 @@ class BenediniTBS: public OP_Sound, public OP_TBS {
   // Squeaks
     void StartSqueaks(void)                                     { OP_TBS::StartSqueaks();              }
     void StopSqueaks(void)                                      { OP_TBS::StopSqueaks();               }
-    boolean AreSqueaksActive(void)                              { OP_TBS::AreSqueaksActive();          }
+    boolean AreSqueaksActive(void)                              { return OP_TBS::AreSqueaksActive();   }
     void SetSqueak_Interval(uint8_t s, unsigned int a, unsigned int b) { OP_TBS::SetSqueak_Interval(s,a,b); }
     void Squeak_SetEnabled(uint8_t s, boolean b)                { OP_TBS::Squeak_SetEnabled(s,b);      }
   // Other Movement Sounds
@@ -306,6 +348,15 @@ class OP_SoundCard: public OP_Sound {
 #define NUM_BITS            16          // Number of data bits in a stream
 #define TOP_BIT             0x8000      // Mask for left-most bit of a 16 bit binary number
 
+// Stream timing. A sentence is a long header low, a short high, then two edges per bit (1 = long low + short high, 0 = short low + long high), 
+// a short closing low, and finally a long gap high before the next sentence. Every edge toggles the pin so a sentence is just a list of durations. 
+#define TS_HEADER_LOW_uS    4160        // 4.16 mS
+#define TS_SHORT_uS         520         // 0.52 mS
+#define TS_LONG_uS          1560        // 1.56 mS
+#define TS_GAP_uS           12520       // 12.52 mS
+#define TS_NUM_EDGES        ((NUM_BITS * 2) + 4)    // Header low & high, two per bit, closing low, gap high
+#define TS_uS_TO_TICKS(s)   ((uint16_t)(s) * 2) // Timer 1 ticks twice per uS (see OP_Settings.h)
+
 // There are 16 data bits in a Taigen sentence. Bits 12 and 16 don't seem to be used for anything. 
 // Auxillary sounds
 #define TS_MASK_TURRET          0x0004  // Bit 3    Turret movement
@@ -399,12 +450,17 @@ class OP_TaigenSound: public OP_Sound {
 
 
   public: 
-    // This function is called by the Timer 4 overflow interrupt service routine, see the cpp file for details.
+    // This function is called by the Timer 1 Compare C interrupt service routine, see the cpp file for details.
     // Don't really need it public, but it has to be for the ISR to see it
-    static void OVF_ISR();
+    static void OCR1C_ISR();
   
   private:
     static volatile uint16_t    command;    // Used to consruct our 16 bit data stream
+    static void                 BuildSentence(uint16_t data);       // Fill in the duration list for the next sentence
+    static uint16_t             Duration[TS_NUM_EDGES];             // Time in Timer 1 ticks from each edge to the next
+    static uint8_t              EdgeIndex;                          // Next edge to create
+    static volatile uint8_t   * TaigenPort;                         // Output register and bit mask of pin_Prop1, so the ISR can write the port directly
+    static uint8_t              TaigenPinMask;
     
     // Class variables
     boolean     _turretEnabled;
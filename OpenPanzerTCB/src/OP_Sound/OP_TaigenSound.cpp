@@ -25,6 +25,10 @@
 
 
 volatile uint16_t OP_TaigenSound::command; 
+uint16_t          OP_TaigenSound::Duration[TS_NUM_EDGES];
+uint8_t           OP_TaigenSound::EdgeIndex;
+volatile uint8_t* OP_TaigenSound::TaigenPort;
+uint8_t           OP_TaigenSound::TaigenPinMask;
 
 
 void OP_TaigenSound::begin() 
@@ -35,186 +39,147 @@ void OP_TaigenSound::begin()
     _barrelEnabled = false;    
     _barrelSoundActive = false;
     
-    // TaigenSound uses Timer 4 Overflow interrupt. Timer 4 is setup in the main sketch, using a macro defined in OP_Settings.h
-
-    // We set Timer 4 to Fast PWM 10-bit (TOP = 1024) with a prescaler of 8. Timer 4 will tick (TCNT4 increment) once every 0.5 uS, or in other words, one uS = 2 ticks. 
-    // Timer 4 will overflow every (1024 ticks * 0.5uS per tick) = 512 uS or just a hair over 1/2 mS. This works very well because the data stream for the 
-    // Taigen sound cards all involve pulses in increments of 1/2mS. 
+    // TaigenSound uses Timer 1 Compare C interrupt. Timer 1 is setup in the main sketch, using a macro defined in OP_Settings.h
+    
+    // Timer 1 runs free in Normal mode and ticks every 0.5 uS. Each time the interrupt fires we change the pin and set OCR1C to the time of the next edge, 
+    // which we read out of a list of durations built once per sentence. So the interrupt only happens when the pin actually needs to change (36 times 
+    // per sentence), rather than every 1/2 mS whether anything needs doing or not. pin_Prop1 is not an output compare pin, so we still set it ourselves, 
+    // but we write to the port register directly. 
 
-    // Set pint to output, start high
+    // Set pin to output, start high
     pinMode(pin_Prop1, OUTPUT);
     digitalWrite(pin_Prop1, HIGH); 
-
-    // Enable Timer 4 Overflow interrupt
-    TIMSK4 |= (1 << TOIE4);         // TIMSK4, bit TOIE4 = Timer Overflow Interrupt Enable 4
-                                    // We set this flag to enable an interrupt to occur whenever TCNT4 equals TOP. 
-                                    // TCNT4 will tick every 0.5uS. TOP is set to 1024 so TCNT4 will rollover every (1024*0.5) = 512uS .
-                                    // If we need to wait longer than 1/2mS, we simply overflow multiple times and count up until we reach the length of time we need. 
+    TaigenPort = portOutputRegister(digitalPinToPort(pin_Prop1));
+    TaigenPinMask = digitalPinToBitMask(pin_Prop1);
     
     // No command to start
     command = 0x00;
     
     // Engine start 0x40;
+
+    // Start with the gap (the pin is already high), the first sentence will follow 
+    BuildSentence(command);
+    EdgeIndex = 0;
+    
+    uint8_t sreg = SREG;
+    cli();
+        OCR1C = TCNT1 + Duration[TS_NUM_EDGES - 1];
+        TIFR1 |= (1 << OCF1C);      // Clear any stale compare flag
+        TIMSK1 |= (1 << OCIE1C);    // TIMSK1, bit OCIE1C = Output Compare Interrupt Enable 1 C
+                                    // Set this flag to one to enable an interrupt to occur when TCNT1 equals the Timer 1 Compare C value (OCR1C)
+    SREG = sreg;
 }
 
 
 // We call a class function so that we can take advantage of class variables, 
 // which are not visible to the actual ISR
-ISR(TIMER4_OVF_vect)
+ISR(TIMER1_COMPC_vect)
 {
-    OP_TaigenSound::OVF_ISR();
+    OP_TaigenSound::OCR1C_ISR();
 }
 
-// Timer 4 Overflow interrupt routine
-void OP_TaigenSound::OVF_ISR()
+// Timer 1 Compare C interrupt routine
+void OP_TaigenSound::OCR1C_ISR()
 {
-    static uint8_t NextState = 0;
-    static uint8_t OverflowsToWait = 0;
-    static uint8_t OverflowsWaited = 0;
-    static uint8_t bitNum = 0;
-    static uint16_t data = 0;
     static boolean TriggerSent = false;
 
-    // We use a state machine to decide if the pin should go high or low, and for how long
+    // Even edges go low, odd edges go high. The next edge is timed from when this one was scheduled, not from when we got here, 
+    // so interrupt latency doesn't add up over the sentence. 
+    if (EdgeIndex & 0x01)   *TaigenPort |=  TaigenPinMask;
+    else                    *TaigenPort &= ~TaigenPinMask;
+    OCR1C += Duration[EdgeIndex];
+
+    if (++EdgeIndex < TS_NUM_EDGES) return;
 
-    OverflowsWaited += 1; 
+    // We just started the gap at the end of the sentence. We have over 12 mS now until the next header, 
+    // so this is where we update our data and build the next sentence. 
+    EdgeIndex = 0;
     
-    if (OverflowsWaited >= OverflowsToWait)     
-    {
-        OverflowsWaited = 0;
-        
-        switch (NextState)
+    // Start signal only gets sent once
+    if (command & TS_MASK_ENGINE_START) 
+    { 
+        if (TriggerSent)
         {
-            case 0:                                         // Header low
-                digitalWrite(pin_Prop1, LOW);   
-                OverflowsToWait = 8;                        // 4.16 mS, we just wait 4.096
-                NextState = 1;  
-                break;  
+            command ^= TS_MASK_ENGINE_START;    // Clear the start signal
+            command |= TS_MASK_ENGINE_IDLE;     // Set the engine idle flag
+            TriggerSent = false;                // Reset
+        }
+        else    TriggerSent = true;             // Set flag so this only happens once
+    }
+    
+    
+    // Stop signal only gets sent once
+    if (command & TS_MASK_ENGINE_STOP)
+    {
+        if (TriggerSent) 
+        { 
+            command = 0;                        // Turn off all sounds
+            TriggerSent = false;                
+        }
+        else    TriggerSent = true;            
+    }
+    
+    // Stop Cannon
+    if (command & TS_MASK_CANNON)
+    {
+        if (TriggerSent) 
+        { 
+            command ^= TS_MASK_CANNON;         
+            TriggerSent = false;
+        }
+        else    TriggerSent = true;            
+    }
+
+    // Stop Hit
+    if (command & TS_MASK_CANNON_HIT)
+    {
+        if (TriggerSent) 
+        { 
+            command ^= TS_MASK_CANNON_HIT;            
+            TriggerSent = false;
+        }
+        else    TriggerSent = true;            
+    }
+    
+    // Stop Destroy
+    if (command & TS_MASK_DESTROY)
+    {
+        if (TriggerSent) 
+        { 
+            command ^= TS_MASK_DESTROY;        
+            TriggerSent = false;
+        }
+        else    TriggerSent = true;            
+    }
     
-            case 1:                                         // Header high
-                digitalWrite(pin_Prop1, HIGH);              // 0.52 mS, we wait 0.512
-                OverflowsToWait = 1;                        // This will only take a single overflow
-                NextState = 2;  
-                break;  
-                    
-            case 2:                                         // Data low - the length of this determines if bit is 1 or 0
-                digitalWrite(pin_Prop1, LOW);   
-                if (data & TOP_BIT)     
-                {   
-                    OverflowsToWait = 3;                    // If this bit is 1, drop for 1.56 mS, we do 1.536
-                    NextState = 4;                          // 1 bits have shorter high portion after
-                }   
-                else    
-                {   
-                    OverflowsToWait = 1;                    // If this bit is 0, drop for 0.52 ms, we do 0.512
-                    NextState = 3;                          // 0 bits have longer high portion after
-                }   
-                break;  
-                
-            case 3:                                         // Data high - 0 bit
-                digitalWrite(pin_Prop1, HIGH);  
-                OverflowsToWait = 3;                        // If the bit was 0 (short), the high portion is longer (1.56mS, we do 1.536)
-                if (++bitNum >= NUM_BITS)                   // Increment bitNum and see if we're done
-                {       
-                    bitNum = 0;                             // We've finished, reset the count
-                    NextState = 5;                          // Next go to the end
-                }   
-                else    
-                {   
-                    data <<= 1;                             // Still have more, shift to next bit
-                    NextState = 2;                          // and go back to 2
-                }   
-                break;  
-                
-            case 4:                                         // Data high - 1 bit
-                digitalWrite(pin_Prop1, HIGH);  
-                OverflowsToWait = 1;                        // If the bit was 1 (long), the high portion is shorter (0.52mS, we do 0.512)
-                if (++bitNum >= NUM_BITS)                   // Increment bitNum and see if we're done
-                {       
-                    bitNum = 0;                             // We've finished, reset the count
-                    NextState = 5;                          // Next go to the end
-                }   
-                else    
-                {   
-                    data <<= 1;                             // Still have more, shift to next bit
-                    NextState = 2;                          // and go back to 2
-                }   
-                break;  
-                    
-            case 5:                                         // Closing low
-                digitalWrite(pin_Prop1, LOW);               // 0.52 mS, we wait 0.512
-                OverflowsToWait = 1;                        // This will only take a single overflow
-                NextState = 6;            
-                break;
-            
-            case 6:                                         // Gap high
-                digitalWrite(pin_Prop1, HIGH);
-                OverflowsToWait = 24;                       // 12.52 mS, we wait 12.288
-                data = command;                             // Here is where we update our data variable
-                
-                // Start signal only gets sent once
-                if (command & TS_MASK_ENGINE_START) 
-                { 
-                    if (TriggerSent)
-                    {
-                        command ^= TS_MASK_ENGINE_START;    // Clear the start signal
-                        command |= TS_MASK_ENGINE_IDLE;     // Set the engine idle flag
-                        TriggerSent = false;                // Reset
-                    }
-                    else    TriggerSent = true;             // Set flag so this only happens once
-                }
-                
-                
-                // Stop signal only gets sent once
-                if (command & TS_MASK_ENGINE_STOP)
-                {
-                    if (TriggerSent) 
-                    { 
-                        command = 0;                        // Turn off all sounds
-                        TriggerSent = false;                
-                    }
-                    else    TriggerSent = true;            
-                }
-                
-                // Stop Cannon
-                if (command & TS_MASK_CANNON)
-                {
-                    if (TriggerSent) 
-                    { 
-                        command ^= TS_MASK_CANNON;         
-                        TriggerSent = false;
-                    }
-                    else    TriggerSent = true;            
-                }
+    // Now set the durations for the next sentence
+    BuildSentence(command);
+}
 
-                // Stop Hit
-                if (command & TS_MASK_CANNON_HIT)
-                {
-                    if (TriggerSent) 
-                    { 
-                        command ^= TS_MASK_CANNON_HIT;            
-                        TriggerSent = false;
-                    }
-                    else    TriggerSent = true;            
-                }
-                
-                // Stop Destroy
-                if (command & TS_MASK_DESTROY)
-                {
-                    if (TriggerSent) 
-                    { 
-                        command ^= TS_MASK_DESTROY;        
-                        TriggerSent = false;
-                    }
-                    else    TriggerSent = true;            
-                }
-                
-                // Set our local data variable, then repeat
-                data = command;               
-                NextState = 0;                
-                break;
+// Convert a 16 bit command to the list of times between edges. The last entry is the gap, which is also the 
+// time from the edge that just called this function to the first edge of the new sentence. 
+void OP_TaigenSound::BuildSentence(uint16_t data)
+{
+    uint8_t e = 0;
+    
+    Duration[e++] = TS_uS_TO_TICKS(TS_HEADER_LOW_uS);                           // Header low
+    Duration[e++] = TS_uS_TO_TICKS(TS_SHORT_uS);                                // Header high
+    for (uint8_t i=0; i<NUM_BITS; i++)
+    {
+        if (data & TOP_BIT)
+        {   // 1 bits have a long low and a short high
+            Duration[e++] = TS_uS_TO_TICKS(TS_LONG_uS);
+            Duration[e++] = TS_uS_TO_TICKS(TS_SHORT_uS);
+        }
+        else
+        {   // 0 bits have a short low and a long high
+            Duration[e++] = TS_uS_TO_TICKS(TS_SHORT_uS);
+            Duration[e++] = TS_uS_TO_TICKS(TS_LONG_uS);
         }
+        data <<= 1;
     }
+    Duration[e++] = TS_uS_TO_TICKS(TS_SHORT_uS);                                // Closing low
+    Duration[e]   = TS_uS_TO_TICKS(TS_GAP_uS);                                  // Gap high
 }
 
 // OR   set   bit without affecting other bits
@@ -36,31 +36,26 @@ int             OP_TBS::TBSProp3TimerID;
 boolean         OP_TBS::Prop3TimerComplete;
 uint8_t         OP_TBS::currentProp3SoundNum;
 uint8_t         OP_TBS::previousProp3SoundNum;
+boolean         OP_TBS::currentProp3OneTime;
+OP_TBS::Prop3Event OP_TBS::Prop3Queue[PROP3_QUEUE_SIZE];
+uint8_t         OP_TBS::Prop3QueueCount;
+boolean         OP_TBS::Prop3Gap;
 // Squeaky stuff
-boolean         OP_TBS::Squeak1_Enabled;
-boolean         OP_TBS::Squeak2_Enabled;
-boolean         OP_TBS::Squeak3_Enabled;
-boolean         OP_TBS::Squeak1_Active;
-boolean         OP_TBS::Squeak2_Active;
-boolean         OP_TBS::Squeak3_Active;
+OP_TBS::SqueakState OP_TBS::Squeaks[TBS_NUM_SQUEAKS];
 boolean         OP_TBS::AllSqueaks_Active;
-int             OP_TBS::Squeak1TimerID;
-int             OP_TBS::Squeak2TimerID;
-int             OP_TBS::Squeak3TimerID;
-unsigned int    OP_TBS::SQUEAK1_MIN_mS;
-unsigned int    OP_TBS::SQUEAK1_MAX_mS;
-unsigned int    OP_TBS::SQUEAK2_MIN_mS;
-unsigned int    OP_TBS::SQUEAK2_MAX_mS;
-unsigned int    OP_TBS::SQUEAK3_MIN_mS;
-unsigned int    OP_TBS::SQUEAK3_MAX_mS;
+int             OP_TBS::SqueakTimerID;
+uint16_t        OP_TBS::SqueakSeed;
+
+// Prop3 sound for each squeak
+const uint8_t SqueakSound[TBS_NUM_SQUEAKS] = { SOUND_SQUEAK_1, SOUND_SQUEAK_2, SOUND_SQUEAK_3 };
 
 
 // CONSTRUCTOR 
-OP_TBS::OP_TBS(OP_SimpleTimer * t) 
+OP_TBS::OP_TBS(OP_SimpleTimer * t, OP_Arena &arena) 
 {
     TBSTimer = t;                       // We will use the sketch's SimpleTimer object rather than creating a new instance of the class
     
-    TBSProp = new OP_Servos; 
+    TBSProp = new (arena) OP_Servos;    // Created in the same arena as the TBS object itself, see ARENA_ANY_SOUND in the sketch
     
     // Initialize
     Prop2TimerComplete = true;
@@ -69,24 +64,27 @@ OP_TBS::OP_TBS(OP_SimpleTimer * t)
     TBSProp3TimerID = 0;
     currentProp3SoundNum = SOUND_OFF;
     previousProp3SoundNum = SOUND_OFF;
+    currentProp3OneTime = true;
+    Prop3QueueCount = 0;
+    Prop3Gap = false;
     
     // Initialize squeak times, and set them to off to begin
     // Later we will load in the user's settings for squeak times and whether they are enabled or not. 
-    SQUEAK1_MIN_mS = DEFAULT_SQUEAK_MIN_mS - 300;   // Squeak 1 is most frequent
-    SQUEAK1_MAX_mS = DEFAULT_SQUEAK_MAX_mS - 500;
-    SQUEAK2_MIN_mS = DEFAULT_SQUEAK_MIN_mS;         // Squeak 2 is medium frequency
-    SQUEAK2_MAX_mS = DEFAULT_SQUEAK_MAX_mS;
-    SQUEAK3_MIN_mS = DEFAULT_SQUEAK_MIN_mS + 1000;  // Squeak 3 is least frequent
-    SQUEAK3_MAX_mS = DEFAULT_SQUEAK_MAX_mS + 1000;  
-    Squeak1_Enabled = false;
-    Squeak2_Enabled = false;
-    Squeak3_Enabled = false;
-    Squeak1_Active = false;
-    Squeak2_Active = false;
-    Squeak3_Active = false;
-    Squeak1TimerID = 0;
-    Squeak2TimerID = 0;
-    Squeak3TimerID = 0;
+    // Squeak 1 is most frequent, squeak 2 is medium frequency, squeak 3 is least frequent
+    for (uint8_t i=0; i<TBS_NUM_SQUEAKS; i++)
+    {
+        Squeaks[i].Min_mS = DEFAULT_SQUEAK_MIN_mS;
+        Squeaks[i].Max_mS = DEFAULT_SQUEAK_MAX_mS;
+        Squeaks[i].Next = 0;
+        Squeaks[i].Enabled = false;
+    }
+    Squeaks[0].Min_mS -= 300;
+    Squeaks[0].Max_mS -= 500;
+    Squeaks[2].Min_mS += 1000;
+    Squeaks[2].Max_mS += 1000;
+    AllSqueaks_Active = false;
+    SqueakTimerID = 0;
+    SqueakSeed = 1;
     
     // Initialize these as well, but again, they will in the end be set by the user's preference
     HeadlightSound_Enabled = true;
@@ -108,6 +106,7 @@ void OP_TBS::InitializeOutputs(void)
     TBSProp->writeMicroseconds(PROP1, PROP1_IDLE);          // Initialize to speed = 0
     TBSProp->writeMicroseconds(PROP2, PROP2_SWITCH_OFF);    // Initialize to engine off
     TBSProp->writeMicroseconds(PROP3, Prop3SoundPulse(SOUND_OFF));  // Initialize to no special sounds
+    Prop3QueueCount = 0;                                    // Forget anything waiting to play
     ClearProp3Timer();
 }
 
@@ -206,20 +205,51 @@ void OP_TBS::StopRepairSound(void)
 // the machine gun to be a "constant-on" sound (until specifically turned off - that is why you must set both an MG on trigger AND
 // and MG off trigger). And we also set the MG sound to be a higher priority than squeaks. So now when you start the MG sound, it stays on,
 // and no sound with a lower priority will play until it is turned off. 
+// A sound that can't play because something of equal or higher priority is playing is no longer thrown away, it goes into a small queue 
+// (see PROP3_QUEUE_SIZE in OP_TBS.h). When the current sound is done the queue is played back-to-back, with a brief return to SOUND_OFF
+// between each. A repeating sound (MG) that gets interrupted by a higher priority one-time sound (squeak) is also queued, so it resumes afterwards. 
+// Only one timer is ever in use for all of this, TBSProp3TimerID either times the current one-time sound or the gap before the next queued one. 
 void OP_TBS::StartProp3Timer(void)
 {
     // Start the timer to briefly send a special sound signal. 
     Prop3TimerComplete = false;
-    TBSProp3TimerID = TBSTimer->setTimeout(TBS_SIGNAL_mS, ClearProp3Timer);    
+    TBSProp3TimerID = TBSTimer->setTimeout(TBS_SIGNAL_mS, EndProp3Sound);    
 }
 
 void OP_TBS::ClearProp3Timer(void)
+{
+    // Stop whatever is playing now. If a timer was still running (one-time sound, or gap) delete it so it doesn't cut short whatever plays next. 
+    // Don't call this from the timer callbacks themselves - SimpleTimer deletes the slot of a one-shot timer after the callback returns. 
+    if (TBSTimer->isEnabled(TBSProp3TimerID)) TBSTimer->deleteTimer(TBSProp3TimerID);
+    Prop3Gap = false;
+    EndProp3Sound();
+}
+
+void OP_TBS::EndProp3Sound(void)
 {
     // Quit sending the special sound signal
     TBSProp->writeMicroseconds(PROP3, Prop3SoundPulse(SOUND_OFF));
     Prop3TimerComplete = true;
     currentProp3SoundNum = SOUND_OFF;
     previousProp3SoundNum = SOUND_OFF;
+    currentProp3OneTime = true;
+    TBSProp3TimerID = 0;
+    // Anything waiting? 
+    StartNextProp3();
+}
+
+void OP_TBS::PlayProp3Sound(uint8_t soundNum, boolean oneTime)
+{
+    // If another sound was playing and its stop timer was still running, clear it so it won't stop this new sound
+    if (TBSTimer->isEnabled(TBSProp3TimerID)) TBSTimer->deleteTimer(TBSProp3TimerID);
+    // If we are interrupting a repeating sound, put it back in line so it picks up again when this one is done
+    if (currentProp3SoundNum != SOUND_OFF && !currentProp3OneTime) QueueProp3(currentProp3SoundNum, false);
+    // Now set the new pulse
+    TBSProp->writeMicroseconds(PROP3, Prop3SoundPulse(soundNum));
+    previousProp3SoundNum = currentProp3SoundNum;
+    currentProp3SoundNum = soundNum;
+    currentProp3OneTime = oneTime;
+    if (oneTime)    StartProp3Timer();  // If it's just a one-time sound, we start a brief timer so the pulse has time to register with the TBS, then it will turn the pulse off. 
 }
 
 void OP_TBS::TriggerSpecialSound(int soundNum, boolean oneTime /* = true */)
@@ -227,20 +257,22 @@ void OP_TBS::TriggerSpecialSound(int soundNum, boolean oneTime /* = true */)
     // Only send a special sound if it has a higher priority than the sound currently playing.
     // If no sound is playing the actual current sound will be SOUND_OFF. We made sure to set 
     // SOUND_OFF at priority 0 and all other sounds at least to priority 1, so they will always supersede SOUND_OFF. 
-    if (Prop3SoundPriority(soundNum) > Prop3SoundPriority(currentProp3SoundNum))
+    // While we are in the gap between two queued sounds the channel is still considered busy. 
+    if (!Prop3Gap && Prop3SoundPriority(soundNum) > Prop3SoundPriority(currentProp3SoundNum))
     {   
-        // If another sound was playing and its stop timer was still running, clear it so it won't stop this new sound
-        if (TBSTimer->isEnabled(TBSProp3TimerID)) TBSTimer->deleteTimer(TBSProp3TimerID);
-        // Now set the new pulse
-        TBSProp->writeMicroseconds(PROP3, Prop3SoundPulse(soundNum));
-        previousProp3SoundNum = currentProp3SoundNum;
-        currentProp3SoundNum = soundNum;
-        if (oneTime)    StartProp3Timer();  // If it's just a one-time sound, we start a brief timer so the pulse has time to register with the TBS, then it will turn the pulse off. 
+        PlayProp3Sound(soundNum, oneTime);
+    }
+    else if (soundNum != currentProp3SoundNum)
+    {
+        // Otherwise wait our turn. If this same sound is already playing there is no need. 
+        QueueProp3(soundNum, oneTime);
     }
 }
 
 void OP_TBS::StopSpecialSounds(int soundNum)
-{   // If the priority of the sound we want to stop is equal to or greater than the current sound,
+{   // Whatever happens, this sound should no longer play later
+    UnqueueProp3(soundNum);
+    // If the priority of the sound we want to stop is equal to or greater than the current sound,
     // stop the current sound. We need the equal-to check because we are probably trying to stop the 
     // current sound, in other words, it will be equal. 
     if (Prop3SoundPriority(soundNum) >= Prop3SoundPriority(currentProp3SoundNum))
@@ -249,6 +281,95 @@ void OP_TBS::StopSpecialSounds(int soundNum)
     }
 }
 
+void OP_TBS::QueueProp3(uint8_t soundNum, boolean oneTime)
+{
+    uint8_t i;
+    uint8_t lowest = 0; 
+    uint32_t expires = millis() + PROP3_QUEUE_EXPIRE_mS;
+    
+    // If this sound is already waiting, just refresh it. A repeating request supersedes a one-time request for the same sound. 
+    for (i=0; i<Prop3QueueCount; i++)
+    {
+        if (Prop3Queue[i].Sound == soundNum)
+        {
+            Prop3Queue[i].OneTime &= oneTime;
+            Prop3Queue[i].Expires = expires;
+            return;
+        }
+    }
+    
+    if (Prop3QueueCount >= PROP3_QUEUE_SIZE)
+    {
+        // Queue is full. Find the lowest priority event (the newest among equals, so older events keep their place)
+        for (i=1; i<Prop3QueueCount; i++)
+        {
+            if (Prop3SoundPriority(Prop3Queue[i].Sound) <= Prop3SoundPriority(Prop3Queue[lowest].Sound)) lowest = i;
+        }
+        // If the new event is no more important than that, it's the one that gets dropped
+        if (Prop3SoundPriority(soundNum) <= Prop3SoundPriority(Prop3Queue[lowest].Sound)) return;
+        // Otherwise remove the lowest one to make room
+        for (i=lowest; i<Prop3QueueCount-1; i++) Prop3Queue[i] = Prop3Queue[i+1];
+        Prop3QueueCount--;
+    }
+    
+    // Events are kept in the order they arrived
+    Prop3Queue[Prop3QueueCount].Sound = soundNum;
+    Prop3Queue[Prop3QueueCount].OneTime = oneTime;
+    Prop3Queue[Prop3QueueCount].Expires = expires;
+    Prop3QueueCount++;
+}
+
+void OP_TBS::UnqueueProp3(uint8_t soundNum)
+{
+    uint8_t i, j = 0;
+    for (i=0; i<Prop3QueueCount; i++)
+    {
+        if (Prop3Queue[i].Sound != soundNum) Prop3Queue[j++] = Prop3Queue[i];
+    }
+    Prop3QueueCount = j;
+}
+
+void OP_TBS::StartNextProp3(void)
+{
+    if (Prop3QueueCount)
+    {
+        Prop3Gap = true;
+        TBSProp3TimerID = TBSTimer->setTimeout(TBS_SIGNAL_GAP_mS, PlayNextProp3);
+    }
+}
+
+void OP_TBS::PlayNextProp3(void)
+{
+    uint8_t i, j = 0;
+    int8_t next = -1;
+    uint32_t now = millis();
+    
+    // This is our own timer calling, SimpleTimer will delete it. Make sure PlayProp3Sound doesn't. 
+    TBSProp3TimerID = 0;
+    Prop3Gap = false;
+    
+    // Discard one-time events that have waited too long
+    for (i=0; i<Prop3QueueCount; i++)
+    {
+        if (!Prop3Queue[i].OneTime || (int32_t)(now - Prop3Queue[i].Expires) < 0) Prop3Queue[j++] = Prop3Queue[i];
+    }
+    Prop3QueueCount = j;
+    
+    // Highest priority goes next, oldest first among equals
+    for (i=0; i<Prop3QueueCount; i++)
+    {
+        if (next < 0 || Prop3SoundPriority(Prop3Queue[i].Sound) > Prop3SoundPriority(Prop3Queue[next].Sound)) next = i;
+    }
+    
+    if (next >= 0)
+    {
+        Prop3Event e = Prop3Queue[next];
+        for (i=next; i<Prop3QueueCount-1; i++) Prop3Queue[i] = Prop3Queue[i+1];
+        Prop3QueueCount--;
+        PlayProp3Sound(e.Sound, e.OneTime);
+    }
+}
+
 
 
 //------------------------------------------------------------------------------------------------------------------------>>
@@ -400,6 +521,7 @@ void OP_TBS::DecreaseVolume(void)
 }                                                   // until explicitly turned off, or until interrupted by another sound with a higher priority. 
 void OP_TBS::StopVolume(void)
 {
+    UnqueueProp3(SOUND_VOLUME_DN);                  // In case one was waiting behind the other
     StopSpecialSounds(SOUND_VOLUME_UP);             // It doesn't matter if we pass volume up or down here, as long as they both have the same priority. 
 }
 
@@ -409,24 +531,25 @@ void OP_TBS::StopVolume(void)
 //------------------------------------------------------------------------------------------------------------------------>>
 void OP_TBS::StartSqueaks(void)
 {   // We actually don't start squeaking right away because that can sound weird. We wait until the tank has been moving for
-    // SQUEAK_DELAY_mS time before truly starting them
+    // SQUEAK_DELAY_mS time before truly starting them. After that each squeak starts at some random point within its minimum interval, 
+    // so they don't all go off at once. 
     if (AllSqueaks_Active == false)
-    {   // It doesn't matter what ID we use for this, so long as it's one that will get cleared when StopSqueaks() gets called
-        Squeak1TimerID = TBSTimer->setTimeout(SQUEAK_DELAY_mS, StartSqueaksForReal);
+    {   
+        uint32_t now = millis();
+        if (SqueakSeed == 1) SqueakSeed ^= (uint16_t)micros();  // Some variation from one power-up to the next
+        if (SqueakSeed == 0) SqueakSeed = 1;
+        for (uint8_t i=0; i<TBS_NUM_SQUEAKS; i++)
+        {
+            Squeaks[i].Next = now + SQUEAK_DELAY_mS + (SqueakInterval(i) % ((uint32_t)Squeaks[i].Min_mS + 1));   // 32 bits, Min_mS + 1 would wrap to 0 at 65535
+        }
         AllSqueaks_Active = true;
+        ArmSqueakTimer(now);
     }
 }
-void OP_TBS::StartSqueaksForReal(void)
-{
-    if (Squeak1_Enabled) Squeak1_Activate();
-    if (Squeak2_Enabled) Squeak2_Activate();
-    if (Squeak3_Enabled) Squeak3_Activate();
-}
 void OP_TBS::StopSqueaks(void)
 {
-    Squeak1_Pause();
-    Squeak2_Pause();
-    Squeak3_Pause();
+    if (TBSTimer->isEnabled(SqueakTimerID)) TBSTimer->deleteTimer(SqueakTimerID);
+    SqueakTimerID = 0;
     AllSqueaks_Active = false;
 }
 boolean OP_TBS::AreSqueaksActive(void)
@@ -434,113 +557,68 @@ boolean OP_TBS::AreSqueaksActive(void)
     return AllSqueaks_Active;
 }
 
-
 void OP_TBS::SetSqueak_Interval(uint8_t s, unsigned int min, unsigned int max)
 {
-    switch (s)
+    if (s >= 1 && s <= TBS_NUM_SQUEAKS)
     {
-        case 1: 
-            SQUEAK1_MIN_mS = min;
-            SQUEAK1_MAX_mS = max;            
-            break;
-        case 2: 
-            SQUEAK2_MIN_mS = min;
-            SQUEAK2_MAX_mS = max;            
-            break;
-        case 3: 
-            SQUEAK3_MIN_mS = min;
-            SQUEAK3_MAX_mS = max;            
-            break;
+        Squeaks[s-1].Min_mS = min;
+        Squeaks[s-1].Max_mS = max;
     }
 }
 void OP_TBS::Squeak_SetEnabled(uint8_t s, boolean enabled)
 {   // This is for enabling the squeak or not, which is a user setting. It is not the same thing
     // as active/inactive (that determines if the squeak is squeaking or just waiting to squeak).
     // If a squeak is disabled, the sound won't play. 
-    switch (s)
-    {
-        case 1: Squeak1_Enabled = enabled; break;
-        case 2: Squeak2_Enabled = enabled; break;
-        case 3: Squeak3_Enabled = enabled; break;
-    }
+    if (s >= 1 && s <= TBS_NUM_SQUEAKS) Squeaks[s-1].Enabled = enabled;
 }
 
-
-void OP_TBS::Squeak1(void)
-{
-    if (Squeak1_Active)
-    {
-        // Play the squeak sound
-        TriggerSpecialSound(SOUND_SQUEAK_1);
-        // Wait some random amount of time, then call me again
-        Squeak1TimerID = TBSTimer->setTimeout(random(SQUEAK1_MIN_mS,SQUEAK1_MAX_mS), Squeak1);    
-    }
-}
-void OP_TBS::Squeak1_Activate(void)
+unsigned int OP_TBS::SqueakInterval(uint8_t i)
 {
-    // Only activate me if I'm not already running and if I'm enabled in the first place. 
-    if (Squeak1_Active == false && Squeak1_Enabled == true)
-    {
-        Squeak1_Active = true;
-        Squeak1();      // Squeak1 will play itself over and over until disabled
-    }
+    // 16-bit xorshift, much cheaper than random() which needs a 32-bit multiply and divide
+    SqueakSeed ^= SqueakSeed << 7;
+    SqueakSeed ^= SqueakSeed >> 9;
+    SqueakSeed ^= SqueakSeed << 8;
+    if (Squeaks[i].Max_mS <= Squeaks[i].Min_mS) return Squeaks[i].Min_mS;
+    return Squeaks[i].Min_mS + (SqueakSeed % (Squeaks[i].Max_mS - Squeaks[i].Min_mS));
 }
-void OP_TBS::Squeak1_Pause(void)
-{
-    TBSTimer->deleteTimer(Squeak1TimerID);
-    Squeak1_Active = false;
-}
-
 
-void OP_TBS::Squeak2(void)
-{   
-    if (Squeak2_Active)
-    {
-        // Play the squeak sound
-        TriggerSpecialSound(SOUND_SQUEAK_2);
-        // Wait some random amount of time, then call me again
-        Squeak2TimerID = TBSTimer->setTimeout(random(SQUEAK2_MIN_mS,SQUEAK2_MAX_mS), Squeak2);       
-    }
-}
-void OP_TBS::Squeak2_Activate(void)
+void OP_TBS::SqueakTick(void)
 {
-    // Only activate me if I'm not already running and if I'm enabled in the first place. 
-    if (Squeak2_Active == false && Squeak2_Enabled == true) 
+    uint32_t now = millis();
+    
+    // This is our own timer calling, SimpleTimer will delete it when we return
+    SqueakTimerID = 0;
+    if (!AllSqueaks_Active) return;
+    
+    for (uint8_t i=0; i<TBS_NUM_SQUEAKS; i++)
     {
-        Squeak2_Active = true;
-        Squeak2();      // Squeak will play itself over and over until disabled
+        if ((int32_t)(now - Squeaks[i].Next) >= 0)
+        {
+            // Play the squeak sound, then wait some random amount of time before the next one. 
+            // If two come due together the second will wait in the Prop3 queue. 
+            if (Squeaks[i].Enabled) TriggerSpecialSound(SqueakSound[i]);
+            Squeaks[i].Next = now + SqueakInterval(i);
+        }
     }
+    ArmSqueakTimer(now);
 }
-void OP_TBS::Squeak2_Pause(void)
-{
-    TBSTimer->deleteTimer(Squeak2TimerID);
-    Squeak2_Active = false;
-}
-
 
-void OP_TBS::Squeak3(void)
-{
-    if (Squeak3_Active)
-    {
-        // Play the squeak sound
-        TriggerSpecialSound(SOUND_SQUEAK_3);
-        // Wait some random amount of time, then call me again
-        Squeak3TimerID = TBSTimer->setTimeout(random(SQUEAK3_MIN_mS,SQUEAK3_MAX_mS), Squeak3);    
-    }
-}
-void OP_TBS::Squeak3_Activate(void)
+void OP_TBS::ArmSqueakTimer(uint32_t now)
 {
-    // Only activate me if I'm not already running and if I'm enabled in the first place. 
-    if (Squeak3_Active == false && Squeak3_Enabled == true) 
+    int32_t wait = -1;
+    int32_t t;
+    
+    // Find the earliest deadline among the enabled squeaks. If none are enabled we don't need a timer at all. 
+    for (uint8_t i=0; i<TBS_NUM_SQUEAKS; i++)
     {
-        Squeak3_Active = true;
-        Squeak3();      // Squeak will play itself over and over until disabled
+        if (Squeaks[i].Enabled)
+        {
+            t = (int32_t)(Squeaks[i].Next - now);
+            if (t < 0) t = 0;
+            if (wait < 0 || t < wait) wait = t;
+        }
     }
-}
-void OP_TBS::Squeak3_Pause(void)
-{
-    TBSTimer->deleteTimer(Squeak3TimerID);
-    Squeak3_Active = false;
+    if (wait >= 0) SqueakTimerID = TBSTimer->setTimeout(wait, SqueakTick);
 }
 
 
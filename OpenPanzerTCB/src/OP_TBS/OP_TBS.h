@@ -32,6 +32,7 @@
 #include "../OP_Servo/OP_Servo.h"
 #include "../OP_Motors/OP_Motors.h"
 #include "../OP_SimpleTimer/OP_SimpleTimer.h"
+#include "../OP_Arena/OP_Arena.h"
 #include "../OP_Tank/OP_BattleTimes.h"
 
 // To save typing
@@ -117,11 +118,23 @@ const Prop3Settings Prop3[PROP3_NUM_SOUNDS] PROGMEM_FAR = {
 
 #define TBS_SIGNAL_mS         50        // How long to send a temporary signal for TBS to get it. 20ms didn't seem stable, so it needs to be greater than that, but as small as possible. 
 #define TBS_SIGNAL_PROP2_mS   500       // Prop2 is used to toggle the engine. We find it works better with a longer signal, and because it doesn't interfere with other sounds it's fine to set it long. 
+#define TBS_SIGNAL_GAP_mS     40        // When queued Prop3 sounds are played back-to-back, return to SOUND_OFF this long in between so the TBS sees each one as a new signal
+
+// Prop3 sounds that can't play right away because a sound of equal or higher priority is playing are held in a small queue and played back-to-back 
+// when the channel frees up, highest priority first (oldest first among equals). One-time sounds expire if they have waited longer than 
+// PROP3_QUEUE_EXPIRE_mS - a cannon hit sound that plays several seconds after the hit would be worse than none at all. Repeating sounds don't expire, 
+// they wait until played or until explicitly stopped. If the queue is full the lowest priority event is dropped. 
+#define PROP3_QUEUE_SIZE      4
+#define PROP3_QUEUE_EXPIRE_mS 1500
 
 #define DEFAULT_SQUEAK_MIN_mS 800       // Min time between squeaks defaults to 0.8 seconds
 #define DEFAULT_SQUEAK_MAX_mS 3500      // Max time between squeaks defaults to 3.5 seconds
 #define SQUEAK_DELAY_mS       3000      // We don't start squeaking until this amount of time has passed after we first start moving
                                         // I suppose this should probably be stuck in EEPROM and let the user adjust it... 
+// All squeaks share a single timer slot. Each squeak keeps its own next-fire deadline, and the timer is re-armed as a one-shot for whichever deadline 
+// comes first. To add a squeak, increase TBS_NUM_SQUEAKS and add its Prop3 sound number to the SqueakSound array in OP_TBS.cpp. The TBS only has 
+// three Prop3 positions set aside for squeaks (shared with user sounds 4-6), so that's what we use. 
+#define TBS_NUM_SQUEAKS       3
 
 // Let's create descriptions of these sounds so we can print them out during the teaching routine (EDIT: teaching routine is no longer required
 // since TBS Flash v3.0 but these have still be useful in testing. For production we comment them out). 
@@ -157,7 +170,7 @@ const char _sound_descr_table_[PROP3_NUM_SOUNDS][SOUNDNAME_CHARS] PROGMEM_FAR =
 class OP_TBS
 {
 public:
-    OP_TBS(OP_SimpleTimer * t);                             // Constructor
+    OP_TBS(OP_SimpleTimer * t, OP_Arena &arena);            // Constructor - our servo object is created in the sketch's object arena
     void begin();                                           // Attach servo outputs and initialize
     void InitializeOutputs(void);                           // Initialize
                 
@@ -223,39 +236,44 @@ public:
     static int          TBSProp3TimerID;
     static boolean      Prop3TimerComplete; 
     static void         StartProp3Timer(void);
-    static void         ClearProp3Timer(void);
+    static void         ClearProp3Timer(void);              // Stop the current sound now, cancelling its timer
+    static void         EndProp3Sound(void);                // Timer callback when a one-time sound is done
+    static void         PlayProp3Sound(uint8_t, boolean);   // Put a sound on the Prop3 output 
     static uint8_t      currentProp3SoundNum;               // Which sound number is currently playing
     static uint8_t      previousProp3SoundNum;              // Which sound was playing before
+    static boolean      currentProp3OneTime;                // Is the current sound a one-time sound, or repeating
+    
+    // Prop3 queue
+    typedef struct {
+        uint8_t  Sound;
+        boolean  OneTime;
+        uint32_t Expires;                                   // millis() time after which a one-time sound is no longer worth playing
+    } Prop3Event;
+    static Prop3Event   Prop3Queue[PROP3_QUEUE_SIZE];
+    static uint8_t      Prop3QueueCount;
+    static boolean      Prop3Gap;                           // True while we are waiting TBS_SIGNAL_GAP_mS before playing the next queued sound
+    static void         QueueProp3(uint8_t, boolean);       // Add an event to the queue 
+    static void         UnqueueProp3(uint8_t);              // Remove any queued events for this sound
+    static void         StartNextProp3(void);               // If anything is queued, start the gap timer 
+    static void         PlayNextProp3(void);                // Gap timer callback, plays the most important queued event that hasn't expired
     boolean             HeadlightSound_Enabled;
     boolean             TurretSound_Enabled;
     boolean             BarrelSound_Enabled;
     
-    static void         StartSqueaksForReal(void);
-    static void         Squeak1_Activate(void);
-    static void         Squeak1_Pause(void);
-    static void         Squeak1(void);
-    static void         Squeak2_Activate(void);
-    static void         Squeak2_Pause(void);
-    static void         Squeak2(void);
-    static void         Squeak3_Activate(void);
-    static void         Squeak3_Pause(void);    
-    static void         Squeak3(void);
-    static boolean      Squeak1_Enabled;                    // Enabled means, are we going to use this sqeak or not
-    static boolean      Squeak2_Enabled;                    // The user has the option of disabling some or all of the sqeaks in settings
-    static boolean      Squeak3_Enabled;            
-    static boolean      AllSqueaks_Active;          
-    static boolean      Squeak1_Active;                     // Active means, is this sqeak now sqeaking, or is it waiting to sqeak
-    static boolean      Squeak2_Active;                     // Squeaks are only active while the tank is moving. 
-    static boolean      Squeak3_Active;
-    static int          Squeak1TimerID;
-    static int          Squeak2TimerID;
-    static int          Squeak3TimerID;
-    static unsigned int SQUEAK1_MIN_mS;
-    static unsigned int SQUEAK1_MAX_mS;
-    static unsigned int SQUEAK2_MIN_mS;
-    static unsigned int SQUEAK2_MAX_mS;
-    static unsigned int SQUEAK3_MIN_mS;
-    static unsigned int SQUEAK3_MAX_mS;
+    // Squeaks
+    typedef struct {
+        unsigned int Min_mS;                                // Min and max time between squeaks
+        unsigned int Max_mS;
+        uint32_t     Next;                                  // millis() time this squeak is next due
+        boolean      Enabled;                               // Enabled means, are we going to use this squeak or not. The user has the option of disabling some or all of the squeaks in settings
+    } SqueakState;
+    static SqueakState  Squeaks[TBS_NUM_SQUEAKS];
+    static boolean      AllSqueaks_Active;                  // Active means, are squeaks now squeaking. Squeaks are only active while the tank is moving. 
+    static int          SqueakTimerID;
+    static uint16_t     SqueakSeed;                         // State of the squeak interval random number generator
+    static void         SqueakTick(void);                   // Timer callback, plays any squeaks that are due
+    static void         ArmSqueakTimer(uint32_t);           // Set the timer for the earliest squeak deadline
+    static unsigned int SqueakInterval(uint8_t);            // Random interval for squeak x (0-based)
     
 };
 
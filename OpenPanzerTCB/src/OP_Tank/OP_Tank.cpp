@@ -242,7 +242,7 @@ boolean OP_Tank::isRepairTank()
 {   
     // Repair tank setting is set by the position of a physical switch on the TCB board. 
     // If LOW (held to ground), tank is fighter. If HIGH (through input pullup), tank is repair. 
-    return digitalRead(pin_RepairTank);
+    return PIN_READ(pin_RepairTank);
 }
 
 void OP_Tank::SetMechBarrelWithCannon(boolean isSet)
@@ -606,11 +606,11 @@ void OP_Tank::MechanicalRecoil(void)
 void OP_Tank::StartMechRecoilMotor(void)
 {   
     // P-channel MOSFET, logic low is off, high is on
-    digitalWrite(pin_MechRecoilMotor, HIGH);
+    PIN_HIGH(pin_MechRecoilMotor);
 }
 void OP_Tank::StopMechRecoilMotor(void)
 {
-    digitalWrite(pin_MechRecoilMotor, LOW);
+    PIN_LOW(pin_MechRecoilMotor);
     if (TankTimer->isEnabled(MechRecoilTimeoutTimerID)) TankTimer->deleteTimer(MechRecoilTimeoutTimerID);
 }
 void OP_Tank::Enable_MechRecoilInterrupt(void)
@@ -690,24 +690,26 @@ void OP_Tank::INT6_RECOIL_ISR()
 void OP_Tank::TriggerMuzzleFlash(void)
 {
     // This one is a PNP transistor, so logic HIGH = OFF, LOW = ON
-    digitalWrite(pin_MuzzleFlash, LOW);
+    PIN_LOW(pin_MuzzleFlash);
     TankTimer->setTimeout(MUZZLE_FLASH_TRIGGER_mS, ClearMuzzleFlash);
 }
 void OP_Tank::ClearMuzzleFlash(void)
 {
     // Muzzle flash is over. Remember, for PNP HIGH = off
-    digitalWrite(pin_MuzzleFlash, HIGH);
+    PIN_HIGH(pin_MuzzleFlash);
 }
 void OP_Tank::TriggerAuxFlash(void)
 {
     // This is an N-Channel MOSFET, so logic HIGH = ON, LOW = OFF
-    digitalWrite(pin_AuxOutput, HIGH);    
+    PIN_PWM_OFF(pin_AuxOutput);
+    PIN_HIGH(pin_AuxOutput);    
     TankTimer->setTimeout(_AuxFlashTime_mS, ClearAuxFlash);
 }
 void OP_Tank::ClearAuxFlash(void)
 {
     // Aux flash is over. Turn off light.
-    digitalWrite(pin_AuxOutput, LOW);   
+    PIN_PWM_OFF(pin_AuxOutput);
+    PIN_LOW(pin_AuxOutput);   
 }
 
 
@@ -1106,12 +1108,14 @@ void OP_Tank::ResetBattleImmediate(void)
 //------------------------------------------------------------------------------------------------------------------------>>
 void OP_Tank::HitLEDs_On(void)
 {
-    digitalWrite(pin_HitNotifyLEDs, HIGH);
+    PIN_PWM_OFF(pin_HitNotifyLEDs);
+    PIN_HIGH(pin_HitNotifyLEDs);
     HitLEDsOn = true;
 }
 void OP_Tank::HitLEDs_Off(void)
 {
-    digitalWrite(pin_HitNotifyLEDs, LOW);
+    PIN_PWM_OFF(pin_HitNotifyLEDs);
+    PIN_LOW(pin_HitNotifyLEDs);
     HitLEDsOn = false;
 }
 void OP_Tank::HitLEDs_Toggle(void)
@@ -0,0 +1,206 @@
+/* OP_TrackSpeed.cpp    Open Panzer Track Speed - closed-loop track speed control from wheel encoders on the general purpose IO ports
+ * Source:              openpanzer.org
+ * Authors:             Luke Middleton
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "OP_TrackSpeed.h"
+
+
+// Static variables must be declared outside the class
+boolean           OP_TrackSpeed::Active = false;
+boolean           OP_TrackSpeed::Running = false;
+uint16_t          OP_TrackSpeed::FullSpeedCPS = DEFAULT_ENCODER_FULLSPEED_CPS;
+uint32_t          OP_TrackSpeed::SpeedScale;
+uint8_t           OP_TrackSpeed::Kp = DEFAULT_SPEED_LOOP_KP;
+uint8_t           OP_TrackSpeed::Ki = DEFAULT_SPEED_LOOP_KI;
+uint8_t           OP_TrackSpeed::MaxSpeedPct = 100;
+uint32_t          OP_TrackSpeed::LastTick;
+volatile uint16_t OP_TrackSpeed::Count[NUM_TRACKS];
+uint8_t           OP_TrackSpeed::LastPins;
+uint16_t          OP_TrackSpeed::WindowCount[NUM_TRACKS][SPEED_LOOP_WINDOW];
+uint16_t          OP_TrackSpeed::WindowTime[SPEED_LOOP_WINDOW];
+uint8_t           OP_TrackSpeed::WindowPos;
+uint16_t          OP_TrackSpeed::SumCount[NUM_TRACKS];
+uint32_t          OP_TrackSpeed::SumTime;
+int16_t           OP_TrackSpeed::Command[NUM_TRACKS];
+int16_t           OP_TrackSpeed::Measured[NUM_TRACKS];
+int32_t           OP_TrackSpeed::Integral[NUM_TRACKS];
+int16_t           OP_TrackSpeed::Output[NUM_TRACKS];
+
+
+void OP_TrackSpeed::begin(uint16_t fullSpeedCPS, uint8_t kp, uint8_t ki)
+{
+    if (fullSpeedCPS < ENCODER_MIN_FULLSPEED_CPS) fullSpeedCPS = ENCODER_MIN_FULLSPEED_CPS;
+    FullSpeedCPS = fullSpeedCPS;
+    SpeedScale = ((uint32_t)MOTOR_MAX_FWDSPEED * 1000000UL) / fullSpeedCPS;
+    Kp = kp;
+    Ki = ki;
+    stop();
+
+    // Enable the pin-change interrupt for the two IO pins. The pins themselves are already set to inputs with pullups (see SetupPins() in the sketch).
+    byte sregRestore = SREG;
+    cli();
+        LastPins = pin_IO_A_PIN;
+        IO_PCMSK |= (_BV(pin_IO_A_BIT) | _BV(pin_IO_B_BIT));
+        PCIFR = _BV(IO_PCIF);           // Clear any change already flagged, writing a 1 clears it
+        PCICR |= _BV(IO_PCIE);
+    SREG = sregRestore;
+
+    Active = true;
+}
+
+void OP_TrackSpeed::stop(void)
+{
+    for (uint8_t t = 0; t < NUM_TRACKS; t++)
+    {
+        Command[t] = 0;
+        Integral[t] = 0;
+        Output[t] = 0;
+    }
+    Running = false;
+}
+
+boolean OP_TrackSpeed::update(int16_t leftCommand, int16_t rightCommand)
+{
+    if (!Active) return false;
+
+    int16_t lastOutput[NUM_TRACKS] = { Output[TRACK_LEFT], Output[TRACK_RIGHT] };
+    int16_t command[NUM_TRACKS] = { leftCommand, rightCommand };
+    for (uint8_t t = 0; t < NUM_TRACKS; t++)
+    {
+        // If a track changes direction whatever the integral built up going the other way no longer applies
+        if ((command[t] > 0 && Command[t] < 0) || (command[t] < 0 && Command[t] > 0)) Integral[t] = 0;
+        Command[t] = command[t];
+    }
+
+    uint32_t now = micros();
+    if (!Running || (now - LastTick) > SPEED_LOOP_RESTART_uS)
+    {
+        // Starting up, or it has been a long time since the last tick. Throw away whatever was counted while we weren't looking, and until the first
+        // tick just pass the commands through.
+        byte sregRestore = SREG;
+        cli();
+            Count[TRACK_LEFT] = 0;
+            Count[TRACK_RIGHT] = 0;
+        SREG = sregRestore;
+        for (uint8_t t = 0; t < NUM_TRACKS; t++)
+        {
+            for (uint8_t i = 0; i < SPEED_LOOP_WINDOW; i++) WindowCount[t][i] = 0;
+            SumCount[t] = 0;
+            Measured[t] = 0;
+            Integral[t] = 0;
+            Output[t] = Command[t];
+        }
+        for (uint8_t i = 0; i < SPEED_LOOP_WINDOW; i++) WindowTime[i] = 0;
+        SumTime = 0;
+        WindowPos = 0;
+        LastTick = now;
+        Running = true;
+    }
+    else if ((now - LastTick) >= SPEED_LOOP_PERIOD_uS)
+    {
+        tick((uint16_t)(now - LastTick));       // Can't be more than SPEED_LOOP_RESTART_uS, so fits
+        LastTick = now;
+    }
+
+    return (Output[TRACK_LEFT] != lastOutput[TRACK_LEFT] || Output[TRACK_RIGHT] != lastOutput[TRACK_RIGHT]);
+}
+
+void OP_TrackSpeed::tick(uint16_t elapsed)
+{
+    uint16_t counts[NUM_TRACKS];
+
+    // Take the counts and zero them in one go so we don't miss an edge
+    byte sregRestore = SREG;
+    cli();
+        counts[TRACK_LEFT] = Count[TRACK_LEFT];
+        counts[TRACK_RIGHT] = Count[TRACK_RIGHT];
+        Count[TRACK_LEFT] = 0;
+        Count[TRACK_RIGHT] = 0;
+    SREG = sregRestore;
+
+    // Swap this tick into the window in place of the oldest one. The tick isn't always exactly SPEED_LOOP_PERIOD_mS long since it depends on when
+    // the main loop gets to it, which is why we keep the time as well as the counts.
+    SumTime = SumTime - WindowTime[WindowPos] + elapsed;
+    WindowTime[WindowPos] = elapsed;
+    for (uint8_t t = 0; t < NUM_TRACKS; t++)
+    {
+        SumCount[t] = SumCount[t] - WindowCount[t][WindowPos] + counts[t];
+        WindowCount[t][WindowPos] = counts[t];
+
+        uint32_t speed = ((uint32_t)SumCount[t] * SpeedScale) / SumTime;
+        Measured[t] = (speed > (MOTOR_MAX_FWDSPEED * 2)) ? (MOTOR_MAX_FWDSPEED * 2) : (int16_t)speed;
+        Output[t] = control(t, Command[t]);
+    }
+    if (++WindowPos >= SPEED_LOOP_WINDOW) WindowPos = 0;
+}
+
+int16_t OP_TrackSpeed::control(uint8_t t, int16_t command)
+{
+    if (command == 0)
+    {
+        Integral[t] = 0;
+        return 0;
+    }
+
+    // Work in the forward direction and put the sign back at the end. The command itself is still the feed-forward, the motor object applies any 
+    // damage cut to it, but the speed we aim for is cut by the same amount.
+    int16_t target = abs(command);
+    int16_t wanted = (MaxSpeedPct < 100) ? (int16_t)(((int32_t)target * MaxSpeedPct) / 100) : target;
+    int16_t error = wanted - Measured[t];
+    const int32_t limit = (int32_t)MOTOR_MAX_FWDSPEED << SPEED_LOOP_GAIN_SHIFT;
+
+    // Only integrate once we are close. While the motor is still spinning up (or down) the error is large for a short time no matter what, and the
+    // window means the measured speed lags a bit behind, so integrating then only winds up a correction that turns into overshoot.
+    if (abs(error) <= SPEED_LOOP_INTEGRATE_BAND) Integral[t] += (int32_t)Ki * error;
+    if (Integral[t] > limit)        Integral[t] = limit;
+    else if (Integral[t] < -limit)  Integral[t] = -limit;
+
+    int16_t out = target + (int16_t)(((int32_t)Kp * error + Integral[t]) >> SPEED_LOOP_GAIN_SHIFT);
+    if (out > MOTOR_MAX_FWDSPEED)   out = MOTOR_MAX_FWDSPEED;
+    else if (out < 0)               out = 0;            // Never reverse a track to slow it down
+
+    return (command > 0) ? out : -out;
+}
+
+int16_t OP_TrackSpeed::measuredSpeed(uint8_t track)
+{
+    if (!Running || SumTime == 0) return 0;
+    return (Command[track] < 0) ? -Measured[track] : Measured[track];
+}
+
+uint16_t OP_TrackSpeed::measuredCPS(uint8_t track)
+{
+    if (!Running || SumTime == 0) return 0;
+    return ((uint32_t)SumCount[track] * 1000000UL) / SumTime;
+}
+
+
+// The two IO pins are both on port K and share one pin-change interrupt. It fires for any change on either pin, so we compare against the last
+// reading to see which one it was. Both rising and falling edges count.
+ISR(IO_PCINT_vect)
+{
+    OP_TrackSpeed::PCINT_ISR(pin_IO_A_PIN);
+}
+
+void OP_TrackSpeed::PCINT_ISR(uint8_t pins)
+{
+    uint8_t changed = pins ^ LastPins;
+    LastPins = pins;
+    if (changed & _BV(pin_IO_A_BIT)) Count[TRACK_LEFT]++;
+    if (changed & _BV(pin_IO_B_BIT)) Count[TRACK_RIGHT]++;
+}
@@ -0,0 +1,119 @@
+/* OP_TrackSpeed.h  Open Panzer Track Speed - closed-loop track speed control from wheel encoders on the general purpose IO ports
+ * Source:          openpanzer.org
+ * Authors:         Luke Middleton
+ *
+ * Normally the tracks are driven open-loop: the driver code works out a speed command for each track and the motor object turns that into a PWM duty cycle
+ * or a serial ESC command. How fast the track actually turns for a given command depends on the battery voltage, the gearbox, the load and the terrain.
+ *
+ * If both IO ports are set to encoder inputs (IO_INPUT_ENCODER, see OP_IO.h), port A reads a sensor on the left track drive and port B one on the right.
+ * These can be any single-channel sensor that produces a pulse train proportional to speed (a hall sensor and magnet on the motor shaft or drive sprocket,
+ * an optical slot sensor, etc...). Both pins are on the ATmega's port K, which shares one pin-change interrupt, so every edge on either pin is counted
+ * in a very short ISR.
+ *
+ * At a fixed rate (SPEED_LOOP_PERIOD_mS) the counts are turned into a measured speed for each track in the same units as the motor commands (0-255), and
+ * a PI loop adjusts the command actually sent to the motor so the measured speed matches the speed the driver code asked for. The driver command is passed
+ * straight through as feed-forward, the PI terms only add the correction, so with both gains set to zero the tracks run exactly as they do open-loop.
+ * That is also how the encoders are calibrated: with the gains at zero drive at full throttle and read the measured counts per second from the system info
+ * dump, then enter that as the full speed counts per second.
+ *
+ * A single-channel sensor can't tell direction, so the measured speed is always taken to be in the direction of the command. The loop never reverses a
+ * track to slow it down, the most it will do is cut the power to zero.
+ *
+ * All of the math is integer. The one division per track per tick is the conversion from counts to speed.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef OP_TRACKSPEED_H
+#define OP_TRACKSPEED_H
+
+#include <Arduino.h>
+#include <avr/interrupt.h>
+#include "../OP_Settings/OP_Settings.h"
+
+
+#define NUM_TRACKS                      2
+#define TRACK_LEFT                      0       // IO port A
+#define TRACK_RIGHT                     1       // IO port B
+
+#define SPEED_LOOP_PERIOD_mS            20      // The speed loop runs at this fixed rate (50 Hz)
+#define SPEED_LOOP_PERIOD_uS            ((uint32_t)SPEED_LOOP_PERIOD_mS * 1000UL)
+#define SPEED_LOOP_RESTART_uS           (SPEED_LOOP_PERIOD_uS * 3)  // If update() hasn't been called for this long the loop starts over rather than act on stale counts
+#define SPEED_LOOP_WINDOW               4       // Measured speed is the count over this many ticks (80 mS). With only a few edges per tick a single tick is too coarse to control on.
+#define SPEED_LOOP_GAIN_SHIFT           5       // Gains are stored as multiples of 1/32, so a Kp of 32 means one step of command per step of speed error
+#define SPEED_LOOP_INTEGRATE_BAND       32      // The integral only accumulates while the speed error is within this many steps (of 255)
+
+#define ENCODER_MIN_FULLSPEED_CPS       50      // Fewer than one edge per tick at full speed is too few to measure anything with
+#define DEFAULT_ENCODER_FULLSPEED_CPS   1000    // Edges (rising and falling both count) per second at full speed
+#define DEFAULT_SPEED_LOOP_KP           16      // 0.5
+#define DEFAULT_SPEED_LOOP_KI           4       // 0.125 per tick
+
+
+class OP_TrackSpeed
+{
+    public:
+        OP_TrackSpeed(void) {}
+        static void     begin(uint16_t fullSpeedCPS, uint8_t Kp, uint8_t Ki);  // Only call this if both IO ports are set to encoder inputs
+        static boolean  isActive(void)                  { return Active; }
+
+        // Call every time through the loop while the tracks are being driven, with the speeds the driver code wants. Returns true when the outputs have
+        // changed and should be sent to the motors.
+        static boolean  update(int16_t leftCommand, int16_t rightCommand);
+        static int16_t  output(uint8_t track)           { return Output[track]; }
+        static void     stop(void);                     // Call when the tracks stop. The next update() starts the loop fresh.
+
+        // Battle damage cuts the speed range of the tread motors (see Motor::cut_SpeedPct), so the same command gives a slower track. The speed loop has
+        // to be told, otherwise it would see the track going too slow and push it right back up to the speed commanded.
+        static void     setMaxSpeedPct(uint8_t pct)     { MaxSpeedPct = (pct > 100) ? 100 : pct; }
+
+        // Measured speed, 0 when stopped
+        static int16_t  measuredSpeed(uint8_t track);   // In motor command units (0 to 255, or negative in reverse)
+        static uint16_t measuredCPS(uint8_t track);     // In encoder edges per second
+        static uint16_t fullSpeedCPS(void)              { return FullSpeedCPS; }
+        static uint8_t  getKp(void)                     { return Kp; }
+        static uint8_t  getKi(void)                     { return Ki; }
+
+        static void     PCINT_ISR(uint8_t pins);        // The actual ISR calls this so it can get at the class variables
+
+    private:
+        static void     tick(uint16_t elapsed);
+        static int16_t  control(uint8_t track, int16_t command);
+
+        static boolean  Active;
+        static boolean  Running;                        // Has the loop been started since the last stop()
+        static uint16_t FullSpeedCPS;
+        static uint32_t SpeedScale;                     // MOTOR_MAX_FWDSPEED * 1,000,000 / FullSpeedCPS. Counts times this, divided by uS, gives speed.
+        static uint8_t  Kp;
+        static uint8_t  Ki;
+        static uint8_t  MaxSpeedPct;                    // Speed the tracks are allowed to reach, as a percent of what the driver code commands
+        static uint32_t LastTick;                       // micros() of the last tick
+
+        static volatile uint16_t Count[NUM_TRACKS];     // Edges since the last tick, incremented by the ISR
+        static uint8_t  LastPins;                       // Port K as of the last pin-change interrupt, so the ISR can tell which pin changed
+
+        static uint16_t WindowCount[NUM_TRACKS][SPEED_LOOP_WINDOW];     // Edges in each of the last few ticks
+        static uint16_t WindowTime[SPEED_LOOP_WINDOW];                  // And how long each of those ticks was, in uS
+        static uint8_t  WindowPos;
+        static uint16_t SumCount[NUM_TRACKS];           // Running totals of the window
+        static uint32_t SumTime;
+
+        static int16_t  Command[NUM_TRACKS];            // Latest command from the driver code
+        static int16_t  Measured[NUM_TRACKS];           // Measured speed as of the last tick, always positive
+        static int32_t  Integral[NUM_TRACKS];           // Integral term, scaled up by SPEED_LOOP_GAIN_SHIFT
+        static int16_t  Output[NUM_TRACKS];             // What we are sending to the motors
+};
+
+
+#endif
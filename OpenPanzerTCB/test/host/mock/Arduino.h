@@ -0,0 +1,170 @@
+// Stand-in for the Arduino core, just enough of it for the libraries in src/ to compile on the PC for the host tests. 
+// The AVR registers are plain variables (each test defines the ones it links against), cli()/sei() do nothing, and PROGMEM 
+// is ordinary memory. Timing functions (millis, micros, delay) and HardwareSerial are declared here but each test provides 
+// its own, since the test decides how time passes and what arrives on the serial ports. 
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+typedef bool boolean; typedef uint8_t byte;
+#define REG8(n) extern volatile uint8_t n;
+#define REG16(n) extern volatile uint16_t n;
+REG8(SREG) REG8(DDRA) REG8(PORTA) REG8(PINA) REG8(TIMSK1) REG8(TIFR1) REG8(TCCR1A) REG8(TCCR1B) REG8(TCCR1C)
+REG16(TCNT1) REG16(OCR1A) REG16(OCR1B) REG16(OCR1C) REG16(ICR1)
+REG8(TIMSK3) REG8(TIFR3) REG8(TCCR3A) REG8(TCCR3B) REG16(TCNT3) REG16(OCR3A)
+REG8(TIMSK4) REG8(TIFR4) REG8(TCCR4A) REG8(TCCR4B) REG16(TCNT4) REG16(OCR4A) REG16(OCR4B) REG16(OCR4C) REG16(ICR4)
+REG8(TIMSK5) REG8(TIFR5) REG8(TCCR5A) REG8(TCCR5B) REG16(TCNT5) REG16(OCR5A) REG16(OCR5B) REG16(OCR5C) REG16(ICR5)
+REG8(TCCR2A) REG8(TCCR2B) REG8(OCR2A) REG8(OCR2B)
+REG8(PORTB) REG8(DDRB) REG8(PINB) REG8(PORTC) REG8(DDRC) REG8(PINC) REG8(PORTD) REG8(DDRD) REG8(PIND)
+REG8(PORTE) REG8(DDRE) REG8(PINE) REG8(PORTF) REG8(DDRF) REG8(PINF) REG8(PORTG) REG8(DDRG) REG8(PING)
+REG8(PORTH) REG8(DDRH) REG8(PINH) REG8(PORTK) REG8(DDRK) REG8(PINK) REG8(PORTL) REG8(DDRL) REG8(PINL)
+REG8(EICRA) REG8(EICRB) REG8(EIMSK) REG8(EIFR) REG8(PCICR) REG8(PCMSK2) REG8(PCIFR)
+REG8(TWCR) REG8(TWDR) REG8(TWSR) REG8(TWBR) REG8(TWAR)
+REG8(UCSR3A) REG8(UCSR3B) REG8(UCSR3C) REG8(UDR3) REG16(UBRR3)
+REG8(MCUSR)
+#define OCIE1A 1
+#define OCIE1B 2
+#define OCIE1C 3
+#define ICIE1 5
+#define ICF1 5
+#define ICES1 6
+#define ICNC1 7
+#define OCF1A 1
+#define OCF1B 2
+#define OCF1C 3
+#define TOIE4 0
+#define OCIE4A 1
+#define OCIE4B 2
+#define OCIE4C 3
+#define OCF4A 1
+#define OCIE3A 1
+#define OCIE5A 1
+#define ICIE5 5
+#define ICIE4 5
+#define ICES4 6
+#define ICNC4 7
+#define ICF4 5
+#define ICES5 6
+#define ICNC5 7
+#define ICF5 5
+#define COM1A0 6
+#define COM1A1 7
+#define COM4A0 6
+#define COM4A1 7
+#define FOC4A 7
+#define INT5 5
+#define INTF5 5
+#define ISC50 2
+#define ISC51 3
+#define PCIE2 2
+#define COM2B1 5
+#define WGM20 0
+#define WGM22 3
+#define CS20 0
+#define TWINT 7
+#define TWEA 6
+#define TWSTA 5
+#define TWSTO 4
+#define TWEN 2
+#define TWIE 0
+#define PE2 2
+#define _BV(b) (1<<(b))
+#define cli() 
+#define sei() 
+#define ISR(v) extern "C" void v(void)
+#define HIGH 1
+#define RISING 3
+#define FALLING 2
+#define CHANGE 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define A0 54
+#define A3 57
+#define A4 58
+#define A5 59
+#define A6 60
+#define A8 62
+#define A9 63
+#define A10 64
+#define A11 65
+#define A12 66
+#define A14 68
+#define A15 69
+#define DEC 10
+#define HEX 16
+#define BIN 2
+#define PROGMEM
+#define F(s) ((const __FlashStringHelper*)(s))
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define pgm_read_byte_far(p) ((uint8_t)(p))
+#define pgm_read_word_far(p) ((uint16_t)(p))
+#define pgm_get_far_address(v) ((uint32_t)0)
+#define strcpy_P strcpy
+#define memcpy_P memcpy
+#define strlen_P strlen
+#define bitSet(v,b) ((v) |= (1UL<<(b)))
+#define bitClear(v,b) ((v) &= ~(1UL<<(b)))
+#define bitRead(v,b) (((v)>>(b))&1)
+#define lowByte(w) ((uint8_t)((w) & 0xff))
+#define highByte(w) ((uint8_t)((w) >> 8))
+#define constrain(amt,low,high) ((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+#define SYSCLOCK 16000000
+#define B01111111 127     // (binary.h has the rest, add them here as they are needed)
+#define F_CPU 16000000UL
+class __FlashStringHelper;
+unsigned long millis(); unsigned long micros(); void delay(unsigned long); void delayMicroseconds(unsigned int);
+void digitalWrite(uint8_t,uint8_t); int digitalRead(uint8_t); void pinMode(uint8_t,uint8_t); int analogRead(uint8_t); void analogWrite(uint8_t,int);
+long random(long); long random(long,long); void randomSeed(unsigned long);
+long map(long,long,long,long,long);
+class String { public: String(const char* =""){} String(int,int=10){} void reserve(unsigned){} void concat(const String&){} void concat(const char*){} void concat(char){} String& operator+=(const String&){return *this;} String& operator+=(const char*){return *this;} String& operator+=(char){return *this;} void toCharArray(char*b,unsigned n) const{if(n)b[0]=0;} unsigned length() const{return 0;} };
+class Print { public:
+ size_t print(const __FlashStringHelper*); size_t print(const char*); size_t print(char); size_t print(int,int=DEC); size_t print(unsigned int,int=DEC); size_t print(long,int=DEC); size_t print(unsigned long,int=DEC); size_t print(double,int=2); size_t print(const String&);
+ size_t print(unsigned char,int=DEC);
+ size_t println(const __FlashStringHelper*); size_t println(const char*); size_t println(char); size_t println(int,int=DEC); size_t println(unsigned int,int=DEC); size_t println(long,int=DEC); size_t println(unsigned long,int=DEC); size_t println(double,int=2); size_t println(void); size_t println(const String&);
+ size_t println(unsigned char,int=DEC);
+ virtual size_t write(uint8_t){return 1;} size_t write(const uint8_t*, size_t);
+};
+class Stream : public Print { public: virtual int available(){return 0;} virtual int read(){return -1;} virtual int peek(){return -1;} };
+class HardwareSerial : public Stream { public: void begin(unsigned long); void begin(unsigned long, uint8_t); void end(); int availableForWrite(); void flush(); int available(); int read(); operator bool(){return true;} };
+extern HardwareSerial Serial, Serial1, Serial2, Serial3;
+#define SERIAL_8E2 0x2E
+#define SERIAL_8N1 0x06
+#ifndef MOCK_PINMAP
+#define MOCK_PINMAP
+extern volatile uint8_t PORTA;
+inline uint8_t digitalPinToPort(uint8_t){ return 1; }
+inline volatile uint8_t* portOutputRegister(uint8_t){ return &PORTA; }
+inline volatile uint8_t* portInputRegister(uint8_t){ return &PORTA; }
+inline volatile uint8_t* portModeRegister(uint8_t){ return &PORTA; }
+inline uint8_t digitalPinToBitMask(uint8_t p){ return 1<<(p%8); }
+#endif
+#ifndef MOCK_USART3
+#define MOCK_USART3
+extern volatile uint8_t DDRJ, PORTJ, PRR1, UBRR3H, UBRR3L;
+#define PJ0 0
+#define PRUSART3 2
+#define RXCIE3 7
+#define RXEN3 4
+#endif
+#ifndef MOCK_PCINT2
+#define MOCK_PCINT2
+#define PK0 0
+#define PK1 1
+#define PCIF2 2
+#define PCINT2_vect PCINT2_vect_isr
+#endif
+#ifndef MOCK_ITOA
+#define MOCK_ITOA
+#include <stdio.h>
+inline char *itoa(int v, char *s, int){ sprintf(s,"%d",(int16_t)v); return s; }
+inline char *utoa(unsigned v, char *s, int){ sprintf(s,"%u",(uint16_t)v); return s; }
+#endif
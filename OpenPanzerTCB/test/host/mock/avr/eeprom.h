@@ -0,0 +1,17 @@
+#pragma once
+#include <stdint.h>
+#define EEMEM
+static inline uint8_t eeprom_read_byte(const uint8_t*){return 0;}
+static inline void eeprom_write_byte(uint8_t*,uint8_t){}
+static inline void eeprom_update_byte(uint8_t*,uint8_t){}
+static inline uint16_t eeprom_read_word(const uint16_t*){return 0;}
+static inline void eeprom_write_word(uint16_t*,uint16_t){}
+static inline void eeprom_update_word(uint16_t*,uint16_t){}
+static inline uint32_t eeprom_read_dword(const uint32_t*){return 0;}
+static inline void eeprom_write_dword(uint32_t*,uint32_t){}
+static inline void eeprom_update_dword(uint32_t*,uint32_t){}
+static inline void eeprom_read_block(void*,const void*,size_t){}
+static inline void eeprom_write_block(const void*,void*,size_t){}
+static inline void eeprom_update_block(const void*,void*,size_t){}
+static inline int eeprom_is_ready(){return 1;}
+#define E2END 4095
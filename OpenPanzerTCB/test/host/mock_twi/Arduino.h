@@ -0,0 +1,42 @@
+// Stand-in Arduino core for test_bno055 only. Unlike mock/, the TWI registers here are SimReg objects that call back into the test 
+// when the driver writes them, so the test can play the part of the TWI hardware and the BNO055. Time only moves when the test says so, 
+// or when the code under test calls delay() - which the test adds up in blockedUs. 
+#pragma once
+#include <stdint.h>
+#include <stdlib.h>
+typedef bool boolean;
+typedef uint8_t byte;
+#define F_CPU 16000000UL
+#define _BV(b) (1 << (b))
+extern double simUs;
+extern double blockedUs;          // time that passed inside a call because of delay()/delayMicroseconds()
+unsigned long micros();
+inline unsigned long millis() { return (unsigned long)(simUs / 1000); }
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+#define ISR(v) void v(void)
+#define TWI_vect TWI_vect_isr
+void TWI_vect_isr(void);
+
+struct SimReg {
+    uint8_t v; void (*hook)(uint8_t oldv, uint8_t newv);
+    SimReg &operator=(uint8_t x) { uint8_t o = v; v = x; if (hook) hook(o, x); return *this; }
+    SimReg &operator|=(uint8_t x) { return *this = (uint8_t)(v | x); }
+    SimReg &operator&=(uint8_t x) { return *this = (uint8_t)(v & x); }
+    operator uint8_t() const { return v; }
+};
+extern SimReg TWCR, DDRD, PORTD, SREG;
+inline void cli() { SREG &= 0x7F; }
+inline void sei() { SREG |= 0x80; }
+extern uint8_t TWSR, TWDR, TWBR;
+uint8_t sim_pind();
+#define PIND (sim_pind())
+#define PD0 0
+#define PD1 1
+#define TWINT 7
+#define TWEA 6
+#define TWSTA 5
+#define TWSTO 4
+#define TWWC 3
+#define TWEN 2
+#define TWIE 0
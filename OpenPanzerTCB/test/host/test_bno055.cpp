@@ -0,0 +1,238 @@
+/* test_bno055.cpp  Host test for OP_I2C and OP_BNO055, against a simulated ATmega2560 TWI peripheral and BNO055
+ * 
+ * The TWI registers are hooked (see mock_twi/Arduino.h): writes to TWCR start the next bus phase, and a short while later in simulated 
+ * time the "hardware" sets TWINT, loads TWSR and calls the TWI interrupt, just like the real thing. The slave has a register file and 
+ * can be made to NACK its address or a data byte, report a bus error, or hang holding SDA low until it gets enough SCL clocks. 
+ * 
+ * Checks: 
+ *  - transaction sequencing: the setup register writes and mode switch waits, the exact bus sequence for one sample, queue order and queue full
+ *  - error recovery: each injected fault is followed by a good sample within 50 mS, and a hung bus is freed by exactly one bus reset each time
+ *  - zero blocking time: over a minute of the sketch's main loop, the IMU code never waits in delay() or delayMicroseconds() except for the 
+ *    SCL clocks of a bus reset, and every sample holds exactly what the slave had in its registers
+ * Returns non-zero if any check fails. 
+ */
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <math.h>
+#include "OP_I2C/OP_I2C.h"
+#include "OP_BNO055/OP_BNO055.h"
+
+double simUs = 0, blockedUs = 0;
+uint8_t TWSR, TWDR, TWBR;
+static bool inIsr = false;
+static long isrCount = 0;
+
+// ---- bus / slave model ----
+struct Slave {
+    uint8_t addr = 0x28; bool present = true; uint8_t regs[256]; uint8_t ptr = 0; bool firstByte = false;
+    int sdaHold = 0;                                    // SCL clocks before it lets go of SDA
+} slave;
+enum { M_IDLE, M_START, M_MT, M_MR } mode = M_IDLE;
+static bool ownBus = false, evPending = false; static double evAt; static uint8_t evStatus;
+static std::string busLog; static bool logOn = true;
+// Fault injection, armed for the next byte-phase event
+static bool injHang = false, injNackAddr = false, injNackData = false, injBusErr = false;
+static long sclRises = 0;
+static double writeTimes[16]; static uint8_t writeRegs[16], writeVals[16]; static int nWrites = 0;
+
+static void logb(const char *f, int v = -1) { if (!logOn) return; char b[16]; snprintf(b, sizeof(b), f, v); busLog += b; busLog += ' '; }
+static void schedule(double dt, uint8_t st) { evPending = true; evAt = simUs + dt; evStatus = st; }
+
+static void twcrHook(uint8_t o, uint8_t n)
+{
+    if (!(n & _BV(TWEN))) { evPending = false; mode = M_IDLE; ownBus = false; return; }
+    if (!(n & _BV(TWINT))) return;
+    TWCR.v &= ~_BV(TWINT);                              // Writing a one clears the flag
+    if (n & _BV(TWSTO))
+    {
+        logb("P"); ownBus = false; mode = M_IDLE; TWCR.v &= ~_BV(TWSTO);
+        if (!(n & _BV(TWSTA))) return;
+    }
+    if (n & _BV(TWSTA))
+    {
+        logb(ownBus ? "Sr" : "S"); schedule(2.5, ownBus ? 0x10 : 0x08); ownBus = true; mode = M_START; return;
+    }
+    if (injHang) { injHang = false; logb("HANG"); slave.sdaHold = 5; return; }     // Slave stretches the clock forever: no more events
+    if (injBusErr) { injBusErr = false; logb("BERR"); schedule(22.5, 0x00); mode = M_IDLE; ownBus = false; return; }
+    switch (mode)
+    {
+        case M_START: {
+            uint8_t a = TWDR >> 1, rw = TWDR & 1;
+            logb(rw ? "A%02XR" : "A%02XW", a);
+            bool ack = slave.present && a == slave.addr && !injNackAddr; injNackAddr = false;
+            if (!ack) { logb("NACK"); schedule(22.5, rw ? 0x48 : 0x20); break; }
+            schedule(22.5, rw ? 0x40 : 0x18); mode = rw ? M_MR : M_MT; slave.firstByte = true; break; }
+        case M_MT:
+            logb("W%02X", TWDR);
+            if (injNackData) { injNackData = false; logb("NACK"); schedule(22.5, 0x30); break; }
+            if (slave.firstByte) { slave.ptr = TWDR; slave.firstByte = false; }
+            else { if (nWrites < 16) { writeRegs[nWrites] = slave.ptr; writeVals[nWrites] = TWDR; writeTimes[nWrites++] = simUs; } slave.regs[slave.ptr++] = TWDR; }
+            schedule(22.5, 0x28); break;
+        case M_MR:
+            TWDR = slave.regs[slave.ptr++];
+            logb((n & _BV(TWEA)) ? "R+" : "R-");
+            schedule(22.5, (n & _BV(TWEA)) ? 0x50 : 0x58); break;
+        default: logb("??"); break;
+    }
+}
+static void ddrHook(uint8_t o, uint8_t n)
+{   // SCL released (input) after being driven: a rising edge
+    if ((o & 1) && !(n & 1)) { sclRises++; if (slave.sdaHold > 0) slave.sdaHold--; }
+}
+uint8_t sim_pind() { uint8_t v = 0x03; if (slave.sdaHold > 0) v &= ~0x02; if (DDRD.v & 1) v &= ~1; if (DDRD.v & 2) v &= ~2; return v; }
+
+static void dispatch()
+{
+    while (evPending && evAt <= simUs && !inIsr && (SREG.v & 0x80))
+    {
+        evPending = false; TWSR = evStatus; TWCR.v |= _BV(TWINT);
+        if ((TWCR.v & _BV(TWIE)) && (TWCR.v & _BV(TWEN))) { inIsr = true; SREG.v &= 0x7F; isrCount++; TWI_vect_isr(); SREG.v |= 0x80; inIsr = false; }
+    }
+}
+static void sregHook(uint8_t o, uint8_t n) { if ((n & 0x80) && !(o & 0x80)) dispatch(); }
+SimReg TWCR = { 0, twcrHook }, DDRD = { 0, ddrHook }, PORTD = { 0, 0 }, SREG = { 0x80, sregHook };
+
+unsigned long micros() { simUs += 0.25; dispatch(); return (unsigned long)simUs; }    // Each call costs a little CPU time
+void delayMicroseconds(unsigned int us) { simUs += us; blockedUs += us; dispatch(); }
+void delay(unsigned long ms) { for (unsigned long i = 0; i < ms * 10; i++) { simUs += 100; blockedUs += 100; dispatch(); } }
+static void advance(double us) { double t = simUs + us; while (simUs < t) { double step = (evPending && evAt < t) ? evAt : t; simUs = step; dispatch(); } }
+
+static void setSample(int16_t v[6]) { for (int i = 0; i < 6; i++) { slave.regs[0x14 + 2 * i] = v[i] & 0xFF; slave.regs[0x15 + 2 * i] = (uint16_t)v[i] >> 8; } }
+
+static int fails = 0;
+#define CHECK(c, ...) do { if (!(c)) { fails++; printf("FAIL: "); printf(__VA_ARGS__); printf("\n"); } } while (0)
+
+int main()
+{
+    memset(slave.regs, 0, sizeof(slave.regs)); slave.regs[0] = 0xA0;
+
+    // ---- 1. Setup: sensor still booting for the first 600 mS, then answers ----
+    OP_BNO055 IMU;
+    IMU.begin();
+    CHECK(TWBR == 12, "TWBR %d for 400 kHz", TWBR);
+    slave.present = false; logOn = false;
+    {   // The slave doesn't answer until it has finished booting at 600 mS. checkIfPresent() without waiting tries once, so we poll it every 10 mS. 
+        double appear = 600000;
+        while (simUs < appear) { if (IMU.checkIfPresent(false)) break; delay(10); }
+        slave.present = true;
+        CHECK(!IMU.isPresent(), "present before boot");
+        CHECK(IMU.checkIfPresent(true), "not found after boot");
+    }
+    printf("setup: sensor found at %.0f mS (came up at 600 mS), bus reads NACKed while booting: %ld errors\n", simUs / 1000, (long)OP_I2C::errorCount());
+    nWrites = 0; logOn = true; busLog.clear();
+    CHECK(IMU.setup(true, OP_BNO055::OPERATION_MODE_IMUPLUS), "setup failed");
+    uint8_t expReg[] = { 0x3D, 0x3E, 0x07, 0x3F, 0x3D }, expVal[] = { 0x00, 0x00, 0x00, 0x80, 0x08 };
+    CHECK(nWrites == 5, "setup wrote %d registers", nWrites);
+    for (int i = 0; i < 5 && i < nWrites; i++) CHECK(writeRegs[i] == expReg[i] && writeVals[i] == expVal[i], "setup write %d: reg %02X = %02X", i, writeRegs[i], writeVals[i]);
+    CHECK(writeTimes[1] - writeTimes[0] >= 19000 && writeTimes[4] - writeTimes[3] >= 9000, "mode switch waits");
+    printf("setup writes: "); for (int i = 0; i < nWrites; i++) printf("%02X=%02X ", writeRegs[i], writeVals[i]); printf("(bus: %s)\n", busLog.substr(0, 60).c_str());
+
+    // ---- 2. One sample, exact bus sequence ----
+    int16_t s0[6] = { 16, -32, 48, 1000, -200, 5 * 16 };
+    setSample(s0); slave.regs[0x35] = 0x3C;
+    busLog.clear(); long isr0 = isrCount;
+    double before = simUs; bool req = IMU.requestSample(); double reqCost = simUs - before;
+    CHECK(req, "requestSample");
+    int polls = 0; while (!IMU.process()) { advance(10); polls++; CHECK(polls < 1000, "sample never finished"); if (polls >= 1000) break; }
+    std::string expect = "S A28W W14 Sr A28R ";
+    for (int i = 0; i < 11; i++) expect += "R+ ";
+    expect += "R- P S A28W W35 Sr A28R R- P ";
+    CHECK(busLog == expect, "sequence\n got %s\n exp %s", busLog.c_str(), expect.c_str());
+    CHECK(IMU.transactionSuccessful() && IMU.gyro.x == 16 && IMU.gyro.y == -32 && IMU.gyro.z == 48 && IMU.orientation.x == 1000 &&
+          IMU.orientation.y == -200 && IMU.orientation.z == 80, "decode");
+    CHECK(IMU.calibration.system == 0 && IMU.calibration.gyro == 3 && IMU.calibration.accel == 3 && IMU.calibration.mag == 0, "calibration decode");
+    printf("one sample: %s\n  %ld interrupts, %.0f uS on the bus, requestSample() took %.2f uS of sim time\n", busLog.c_str(), isrCount - isr0, polls * 10.0, reqCost);
+
+    // ---- 3. Queue: fills at I2C_QUEUE_SIZE, runs in order ----
+    uint8_t b[4][2]; int8_t h[5]; busLog.clear();
+    for (int i = 0; i < 5; i++) h[i] = OP_I2C::read(0x28, 0x20 + i, b[i < 4 ? i : 0], 2);
+    CHECK(h[4] == I2C_NO_HANDLE && h[0] >= 0 && h[3] >= 0, "queue full handling");
+    advance(2000);
+    for (int i = 0; i < 4; i++) { CHECK(OP_I2C::successful(h[i]), "queued %d", i); OP_I2C::release(h[i]); }
+    CHECK(busLog.find("W20") < busLog.find("W21") && busLog.find("W21") < busLog.find("W22") && busLog.find("W22") < busLog.find("W23"), "order %s", busLog.c_str());
+    printf("queue: 5th request refused while 4 pending, 4 ran in order\n");
+
+    // ---- 4. Main loop for 60 s with faults injected; the sketch's fixed-rate scheduling copied from loop() ----
+    logOn = false;
+    const int IMU_SamplePeriod = 20;
+    uint32_t IMU_NextSample = millis();
+    long samples = 0, good = 0, bad = 0, loops = 0, wrongData = 0; double maxCallUs = 0, sumCallUs = 0, maxBlockedUs = 0, maxRecoveryUs = 0; long calls = 0;
+    double lastGood = 0, maxGap = 0; double startUs = simUs;
+    int16_t cur[6]; long k = 0;
+    struct Fault { double at; int kind; const char *name; long recovered; } faults[] = {
+        { 5e6, 1, "address NACK", -1 }, { 10e6, 2, "data NACK (register write)", -1 }, { 15e6, 3, "bus error", -1 }, { 20e6, 4, "hung bus, SDA held low", -1 },
+        { 30e6, 4, "hung bus, SDA held low", -1 }, { 40e6, 1, "address NACK", -1 } };
+    int nf = sizeof(faults) / sizeof(faults[0]), fi = 0;
+    long recov0 = OP_I2C::recoveryCount();
+    double faultAt = -1; int waitingRecovery = -1; bool sawFailure = false;
+    while (simUs - startUs < 60e6)
+    {
+        // The slave's readings change all the time
+        k++; for (int i = 0; i < 6; i++) cur[i] = (int16_t)(1000 * sin(k * 0.001 * (i + 1)));
+        if (!IMU.sampling()) setSample(cur);                   // (only between samples, so we can tell what a sample should hold)
+        static int16_t expected[6]; static bool haveExpected = false;
+        if (fi < nf && simUs - startUs >= faults[fi].at)
+        {
+            switch (faults[fi].kind) { case 1: injNackAddr = true; break; case 3: injBusErr = true; break; case 4: injHang = true; break;
+                case 2: { // A register write the slave refuses. Wait for any sample in progress to get off the bus first, so the NACK lands on our write. 
+                          int8_t w = OP_I2C::write(0x28, 0x3D, 0x08);
+                          while (OP_I2C::status(w) == I2C_QUEUED) advance(1);
+                          injNackData = true;
+                          while (!OP_I2C::done(w)) advance(10);
+                          CHECK(OP_I2C::status(w) == I2C_ERROR_NACK_DATA, "refused write finished with status %d", OP_I2C::status(w));
+                          OP_I2C::release(w); injNackData = false; break; } }
+            faultAt = simUs; waitingRecovery = fi; sawFailure = (faults[fi].kind == 2); fi++;     // The refused write was the failure, the samples should carry on
+        }
+
+        unsigned long currentMillis = millis();
+        double c0 = simUs, b0 = blockedUs; long r0 = OP_I2C::recoveryCount();
+        bool updated = false;
+        if (IMU.process())
+        {
+            samples++;
+            if (IMU.transactionSuccessful())
+            {
+                good++; updated = true;
+                const int16_t got[6] = { IMU.gyro.x, IMU.gyro.y, IMU.gyro.z, IMU.orientation.x, IMU.orientation.y, IMU.orientation.z };
+                if (haveExpected && memcmp(got, expected, sizeof(got))) wrongData++;
+                if (lastGood && (simUs - lastGood) > maxGap) maxGap = simUs - lastGood;
+                lastGood = simUs;
+                if (waitingRecovery >= 0 && sawFailure) { sawFailure = false; faults[waitingRecovery].recovered = (long)((simUs - faultAt) / 1000); waitingRecovery = -1; }
+            }
+            else { bad++; if (waitingRecovery >= 0) sawFailure = true; }
+        }
+        if (!IMU.sampling() && (long)(currentMillis - IMU_NextSample) >= 0)
+        {
+            memcpy(expected, cur, sizeof(expected)); haveExpected = true;
+            if (IMU.requestSample())
+            {
+                IMU_NextSample += IMU_SamplePeriod;
+                if ((long)(currentMillis - IMU_NextSample) >= 0) IMU_NextSample = currentMillis + IMU_SamplePeriod;
+            }
+        }
+        double cost = simUs - c0, blocked = blockedUs - b0;
+        if (OP_I2C::recoveryCount() == r0) { if (blocked > maxBlockedUs) maxBlockedUs = blocked; }       // Ordinary pass
+        else if (blocked > maxRecoveryUs) maxRecoveryUs = blocked;                                      // Pass that reset a hung bus
+        if (cost > maxCallUs) maxCallUs = cost; sumCallUs += cost; calls++;
+        loops++;
+        advance(250);                                          // The rest of the main loop (estimate: radio, sound, lights, motors)
+    }
+    double secs = (simUs - startUs) / 1e6;
+    printf("main loop %.0f s: %ld samples (%.1f/s), %ld good, %ld failed, %ld with data that didn't match the slave\n", secs, samples, samples / secs, good, bad, wrongData);
+    printf("  IMU code per loop: max %.2f uS, mean %.3f uS of sim time (a blocking read would be ~350 uS), worst gap between good samples %.1f mS\n", maxCallUs, sumCallUs / calls, maxGap / 1000);
+    printf("  bus resets %ld, SCL clocks sent by recovery %ld, I2C errors total %u\n", OP_I2C::recoveryCount() - recov0, sclRises, OP_I2C::errorCount());
+    for (int i = 0; i < nf; i++) printf("  fault at %2.0f s: %-26s -> next good sample %ld mS later\n", faults[i].at / 1e6, faults[i].name, faults[i].recovered);
+    CHECK(wrongData == 0, "data mismatch");
+    CHECK(samples > secs * 49, "rate %f", samples / secs);
+    CHECK(OP_I2C::recoveryCount() - recov0 == 2, "recoveries");
+    for (int i = 0; i < nf; i++) CHECK(faults[i].recovered >= 0 && faults[i].recovered < 50, "fault %d not recovered", i);      // -1 until a good sample follows it
+    printf("  waiting in delay: %.0f uS at most on an ordinary pass, %.0f uS on a pass that reset the bus\n", maxBlockedUs, maxRecoveryUs);
+    CHECK(maxBlockedUs == 0, "IMU code waited %.0f uS on an ordinary pass", maxBlockedUs);
+    CHECK(maxRecoveryUs <= (I2C_RECOVERY_CLOCKS + 1) * 10, "bus reset waited %.0f uS", maxRecoveryUs);
+    CHECK(maxCallUs < 200, "IMU code took %.0f uS of one pass", maxCallUs);
+    printf("%s (%d failures)\n", fails ? "FAILED" : "ALL CHECKS PASSED", fails);
+    return fails != 0;
+}
@@ -0,0 +1,262 @@
+/* test_crsf.cpp    Host test for OP_CRSFDecode, and for CRSF detection and failsafe through OP_Radio
+ * 
+ * Feeds the decoder a corpus of generated frames, byte by byte exactly as the Serial3 interrupt would: 
+ *  - random RC channel frames, mixed with link statistics and other frame types, checked against the channel scaling (v-992)*5/8+1500
+ *  - every single-bit corruption of a frame, all of which the CRC8 must reject
+ *  - frames cut short and followed by good ones, to see how quickly we get back in sync
+ *  - frames joined part way through, with the 0xC8 sync byte also appearing inside the payload
+ *  - link statistics with LQ 0 (receiver lost the transmitter but keeps sending channels), and the PCComm frame rate limit
+ * Then runs OP_Radio's auto-detection against a simulated 150 Hz CRSF receiver, and checks failsafe follows the link statistics. 
+ * Returns non-zero if any check fails. 
+ */
+#include <initializer_list>
+#include <Arduino.h>
+#include <stdio.h>
+#include <string.h>
+#include "OP_Radio/OP_Radio.h"
+#include "OP_SimpleTimer/OP_SimpleTimer.h"
+#include "OP_EEPROM/OP_EEPROM_Struct.h"
+
+// Minimal byte buffer (std::vector breaks under -fpack-struct)
+struct Buf {
+    uint8_t d[512]; int n;
+    Buf() : n(0) {}
+    Buf(std::initializer_list<uint8_t> l) : n(0) { for (uint8_t b : l) d[n++] = b; }
+    void push_back(uint8_t b) { d[n++] = b; }
+    uint8_t &operator[](int i) { return d[i]; }
+    int size() const { return n; }
+    const uint8_t *begin() const { return d; }
+    const uint8_t *end() const { return d + n; }
+    void append(const Buf &o, int from = 0, int to = -1) { if (to < 0) to = o.n; for (int i = from; i < to; i++) d[n++] = o.d[i]; }
+    void prepend(const Buf &o) { memmove(d + o.n, d, n); memcpy(d, o.d, o.n); n += o.n; }
+};
+static uint8_t rxq[1 << 16]; static unsigned rxHead = 0, rxTail = 0;
+static void rxPush(const Buf &b) { for (uint8_t x : b) rxq[rxHead++ & 0xFFFF] = x; }
+
+static unsigned long simMs = 0;
+unsigned long millis() { return simMs; }
+unsigned long micros() { return simMs * 1000UL; }
+void delay(unsigned long) {}
+void delayMicroseconds(unsigned int) {}
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+int digitalRead(uint8_t) { return 0; }
+long map(long x, long a, long b, long c, long d) { return (x - a) * (d - c) / (b - a) + c; }
+HardwareSerial Serial, Serial1, Serial2, Serial3;
+static bool serial3On = false;
+void HardwareSerial::begin(unsigned long b) { if (this == &Serial3) { serial3On = true; rxHead = rxTail = 0; printf("  Serial3.begin(%lu)\n", b); } }
+void HardwareSerial::begin(unsigned long b, uint8_t) { begin(b); }
+void HardwareSerial::end() { if (this == &Serial3) serial3On = false; }
+int HardwareSerial::availableForWrite() { return 64; } void HardwareSerial::flush() {}
+int HardwareSerial::available() { return this == &Serial3 ? (int)(rxHead - rxTail) : 0; }
+int HardwareSerial::read() { if (this != &Serial3 || rxHead == rxTail) return -1; return rxq[rxTail++ & 0xFFFF]; }
+volatile uint8_t DDRJ, EICRB, EIFR, EIMSK, PORTJ, PRR1, SREG, UBRR3H, UBRR3L, UCSR3A, UCSR3B, UCSR3C;
+volatile uint16_t TCNT1;
+
+OP_SimpleTimer timer;
+OP_Radio Radio;
+_eeprom_hot hot;
+
+static uint8_t crc8(const uint8_t *p, int n)
+{
+    uint8_t c = 0;
+    for (int i = 0; i < n; i++) { c ^= p[i]; for (int b = 0; b < 8; b++) c = (c & 0x80) ? (uint8_t)((c << 1) ^ 0xD5) : (uint8_t)(c << 1); }
+    return c;
+}
+static Buf rcFrame(const uint16_t ch[16])
+{
+    Buf f{ 0xC8, 24, 0x16 };
+    uint32_t bits = 0; int n = 0;
+    for (int i = 0; i < 16; i++) { bits |= (uint32_t)ch[i] << n; n += 11; while (n >= 8) { f.push_back(bits & 0xFF); bits >>= 8; n -= 8; } }
+    f.push_back(crc8(&f[2], 23));
+    return f;
+}
+static Buf lsFrame(uint8_t lq)
+{
+    Buf f{ 0xC8, 12, 0x14, 60, 70, lq, 10, 0, 5, 2, 80, 100, 8 };
+    f.push_back(crc8(&f[2], 11));
+    return f;
+}
+static int expected(uint16_t v) { return ((int)v - 992) * 5 / 8 + 1500; }
+
+static int fails = 0;
+static void check(bool ok, const char *what) { printf("  %-60s %s\n", what, ok ? "ok" : "FAIL"); if (!ok) fails++; }
+
+int main()
+{
+    srand(43);
+    CRSFDecode d;
+    d.begin();
+    int16_t out[16];
+    uint16_t ch[16];
+
+    printf("Decoder corpus\n");
+    // 1. Random valid frames, with and without link stats and other frame types in between
+    int good = 0, bad = 0;
+    for (int k = 0; k < 2000; k++)
+    {
+        for (int i = 0; i < 16; i++) ch[i] = 172 + rand() % (1811 - 172 + 1);
+        Buf f = rcFrame(ch);
+        if (k % 7 == 0) { Buf l = lsFrame(100); f.prepend(l); }
+        if (k % 11 == 0) { Buf dev{ 0xC8, 4, 0x29, 0xC8, 0x00, 0 }; dev[5] = crc8(&dev[2], 3); f.prepend(dev); }
+        CRSFDecode::NewFrame = false;
+        for (uint8_t b : f) CRSFDecode::parseByte(b);
+        if (!CRSFDecode::NewFrame) { bad++; continue; }
+        d.GetCRSF_Frame(out, 16);
+        bool ok = true;
+        for (int i = 0; i < 16; i++) if (out[i] != expected(ch[i])) ok = false;
+        ok ? good++ : bad++;
+        simMs += 7;
+    }
+    printf("  2000 random frames: %d decoded correctly, %d wrong/missing\n", good, bad);
+    check(bad == 0, "random frames decode to (v-992)*5/8+1500");
+    check(d.getState() == READY_state, "state READY after valid frames");
+    check(d.getCRCErrors() == 0, "no CRC errors on clean stream");
+
+    // 2. Bad CRC: every bit of every byte after the length flipped in turn
+    for (int i = 0; i < 16; i++) ch[i] = 992;
+    Buf ref = rcFrame(ch);
+    int accepted = 0; uint16_t crcBefore = d.getCRCErrors();
+    for (size_t pos = 2; pos < ref.size(); pos++)
+        for (int bit = 0; bit < 8; bit++)
+        {
+            Buf f = ref; f[pos] ^= (1 << bit);
+            CRSFDecode::NewFrame = false;
+            for (uint8_t b : f) CRSFDecode::parseByte(b);
+            if (CRSFDecode::NewFrame) accepted++;
+        }
+    printf("  %d single-bit corruptions: %d accepted, %u CRC errors counted\n", (int)(ref.size() - 2) * 8, accepted, d.getCRCErrors() - crcBefore);
+    check(accepted == 0, "single-bit corruptions all rejected");
+
+    // 3. Truncated frames followed by a continuous stream of good frames: how many good frames are lost before the first one decodes?
+    int lostHist[6] = { 0 }, trials = 0, spliced = 0;
+    for (int k = 0; k < 5000; k++)
+    {
+        for (int i = 0; i < 16; i++) ch[i] = 172 + rand() % 1640;
+        Buf g = rcFrame(ch);
+        int cut = 1 + rand() % (ref.size() - 1);
+        for (int i = 0; i < cut; i++) CRSFDecode::parseByte(ref[i]);
+        int lost = 0;
+        for (;;)
+        {
+            CRSFDecode::NewFrame = false;
+            for (uint8_t b : g) CRSFDecode::parseByte(b);
+            if (CRSFDecode::NewFrame) break;
+            lost++;
+        }
+        d.GetCRSF_Frame(out, 16);
+        bool ok = true; for (int i = 0; i < 16; i++) if (out[i] != expected(ch[i])) ok = false;
+        if (!ok)
+        {   // A spliced frame (end of the truncated one + start of the good one) that happened to pass the CRC. The next good frame must still decode.
+            spliced++;
+            CRSFDecode::NewFrame = false;
+            for (uint8_t b : g) CRSFDecode::parseByte(b);
+            d.GetCRSF_Frame(out, 16);
+            ok = true; for (int i = 0; i < 16; i++) if (out[i] != expected(ch[i])) ok = false;
+            lost = ok ? lost + 1 : 5;
+        }
+        lostHist[lost > 5 ? 5 : lost]++; trials++;
+    }
+    printf("  truncated frame then good stream, %d trials: good frames lost 0:%d 1:%d 2:%d 3:%d 4:%d 5+/wrong:%d (spliced frames passing CRC8: %d)\n", trials, lostHist[0], lostHist[1], lostHist[2], lostHist[3], lostHist[4], lostHist[5], spliced);
+    check(lostHist[3] + lostHist[4] + lostHist[5] == 0, "resync after truncated frame within 2 frames");
+
+    // 4. 0xC8 bytes inside the payload (channel data chosen so packed bytes contain 0xC8), starting mid-stream
+    int c8good = 0, c8trials = 0;
+    for (int k = 0; k < 200; k++)
+    {
+        for (int i = 0; i < 16; i++) ch[i] = (i & 1) ? 0x6C8 : 0x0C8 + (rand() % 4) * 0x100;
+        Buf g = rcFrame(ch);
+        Buf f; f.append(g, 1 + rand() % 20);      // join mid-frame
+        for (int r = 0; r < 3; r++) f.append(g);
+        CRSFDecode::NewFrame = false;
+        for (uint8_t b : f) CRSFDecode::parseByte(b);
+        c8trials++;
+        if (CRSFDecode::NewFrame) { d.GetCRSF_Frame(out, 16); bool ok = true; for (int i = 0; i < 16; i++) if (out[i] != expected(ch[i])) ok = false; if (ok) c8good++; }
+    }
+    printf("  joined mid-frame with 0xC8 in payload: %d/%d correct\n", c8good, c8trials);
+    check(c8good == c8trials, "0xC8 in payload does not derail sync");
+
+    // 5. Address byte followed by 0xC8 as length (out of range) then a real frame
+    {
+        Buf f{ 0xC8, 0xC8 }; f.append(ref, 1);
+        CRSFDecode::NewFrame = false;
+        for (uint8_t b : f) CRSFDecode::parseByte(b);
+        check(CRSFDecode::NewFrame, "0xC8 0xC8 <len>... treated as a frame start");
+    }
+
+    // 6. Link statistics LQ=0 -> failsafe state, channel frames ignored and not stamped; LQ back -> frames resume
+    {
+        uint32_t stampBefore = d.getLastFrameTime();
+        simMs += 100;
+        for (uint8_t b : lsFrame(0)) CRSFDecode::parseByte(b);
+        check(d.getState() == FAILSAFE_state && d.getLinkQuality() == 0, "LQ=0 puts decoder in FAILSAFE");
+        CRSFDecode::NewFrame = false;
+        for (uint8_t b : ref) CRSFDecode::parseByte(b);
+        check(!CRSFDecode::NewFrame && d.getLastFrameTime() == stampBefore, "channel frames ignored and not stamped while link down");
+        for (uint8_t b : lsFrame(95)) CRSFDecode::parseByte(b);
+        for (uint8_t b : ref) CRSFDecode::parseByte(b);
+        check(CRSFDecode::NewFrame && d.getState() == READY_state && d.getRSSI() == 60, "link back: frames pass, READY, RSSI from active antenna");
+    }
+
+    // 7. PCComm decimation: at 500 Hz (2 mS) with an 18 mS minimum, count passed frames over 1 second
+    {
+        d.slowDownForPCComm();
+        int passed = 0, stamped = 0; uint32_t last = d.getLastFrameTime();
+        for (int k = 0; k < 500; k++)
+        {
+            simMs += 2;
+            CRSFDecode::NewFrame = false;
+            for (uint8_t b : ref) CRSFDecode::parseByte(b);
+            if (CRSFDecode::NewFrame) passed++;
+            if (d.getLastFrameTime() != last) { stamped++; last = d.getLastFrameTime(); }
+        }
+        d.defaultSpeed();
+        printf("  500 Hz for 1 s at PCComm speed: %d frames passed on, %d stamped\n", passed, stamped);
+        check(passed >= 50 && passed <= 56 && stamped == 500, "PCComm speed passes ~1 frame per 18 mS, stamps all");
+    }
+    d.shutdown();
+
+    // 8. Detection through OP_Radio: 150 Hz CRSF on Serial3 from t=0
+    printf("Detection through OP_Radio (CRSF at 150 Hz on Serial3)\n");
+    memset(&hot, 0, sizeof(hot));
+    stick_channel_settings *s[4] = { &hot.ThrottleSettings, &hot.TurnSettings, &hot.ElevationSettings, &hot.AzimuthSettings };
+    for (int i = 0; i < 4; i++) { s[i]->pulseMin = 1000; s[i]->pulseMax = 2000; s[i]->pulseCenter = 1500; s[i]->deadband = 15; s[i]->channelNum = i + 1; }
+    for (int a = 0; a < AUXCHANNELS; a++) { hot.Aux_ChannelSettings[a].pulseMin = 1000; hot.Aux_ChannelSettings[a].pulseMax = 2000; hot.Aux_ChannelSettings[a].pulseCenter = 1500; hot.Aux_ChannelSettings[a].channelNum = 5 + a; }
+    Radio.saveTimer(&timer);
+    simMs = 10000;
+    unsigned long start = simMs, nextFrame = simMs;
+    for (int i = 0; i < 16; i++) ch[i] = 1500;
+    Buf mid = rcFrame(ch);
+    while (Radio.Status() != READY_state && simMs < start + 5000)
+    {
+        if (simMs >= nextFrame) { if (serial3On) rxPush(mid); nextFrame += 7; }
+        Radio.detect(); timer.run(); Radio.Update();
+        simMs += 1;
+    }
+    printf("  detected protocol %d (%s) after %lu ms\n", Radio.getProtocol(), (const char *)RadioProtocol(Radio.getProtocol()), simMs - start);
+    check(Radio.getProtocol() == PROTOCOL_CRSF && simMs - start <= RADIO_DETECT_WORST_MS && RADIO_DETECT_WORST_MS < 800, "CRSF detected within RADIO_DETECT_WORST_MS, which is within PCComm's 800 mS");
+    Radio.begin(&hot);
+    printf("  channel count %d\n", Radio.getChannelCount());
+    check(Radio.getChannelCount() == 16, "all 16 CRSF channels counted");
+
+    // 9. Failsafe from frame age, and from LQ=0 link stats while channel frames keep coming
+    bool fs = false; unsigned long lsAt = 0, lqBack = 0, fsAt = 0, recoveredAt = 0;
+    for (int t = 0; t < 1000; t++)
+    {
+        if (simMs >= nextFrame)
+        {
+            if (t >= 300 && !lsAt) { rxPush(lsFrame(0)); lsAt = simMs; }
+            if (t >= 700 && !lqBack) { rxPush(lsFrame(90)); lqBack = simMs; }
+            rxPush(mid); nextFrame += 7;
+        }
+        timer.run(); Radio.Update(); Radio.GetCommands();
+        if (Radio.InFailsafe && !fs) { fsAt = simMs; printf("  failsafe %lu ms after LQ=0 link stats (channel frames still arriving)\n", simMs - lsAt); }
+        if (!Radio.InFailsafe && fs) { recoveredAt = simMs; printf("  recovered %lu ms after LQ returned\n", simMs - lqBack); }
+        fs = Radio.InFailsafe;
+        simMs += 1;
+    }
+    check(lsAt && fsAt > lsAt && fsAt - lsAt <= 500, "failsafe within 500 mS of LQ=0, frames still arriving");
+    check(lqBack && recoveredAt >= lqBack && recoveredAt - lqBack <= 50, "failsafe ends as soon as the link is back");
+    printf("%s\n", fails ? "FAILURES" : "all checks passed");
+    return fails;
+}
@@ -0,0 +1,143 @@
+/* test_incline.cpp Host test for OP_Incline, the fixed-point barrel stabilization and hill physics, against a float model of the mapf code it replaced
+ * 
+ *  - Static mapping: every sensitivity, a spread of end-points (some reversed) and pitches out to 90 degrees, compared with mapf
+ *  - Closed loop: a minute of noisy, bumpy slopes at 50 Hz, fixed point and float side by side sample by sample
+ *  - The rate limits and deadbands, and sensitivity 100
+ * It also prints the time per sample of each on the PC. The PC has a floating point unit and the ATmega doesn't, so that is only a rough 
+ * comparison and is not checked - see the estimate in OP_Incline.h. 
+ * Returns non-zero if any check fails. 
+ */
+#include <stdio.h>
+#include <math.h>
+#include <random>
+#include <chrono>
+#include <Arduino.h>
+#include "OP_Incline/OP_Incline.h"
+
+static float mapf(float x, float in_min, float in_max, float out_min, float out_max) { return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min; }
+
+// Float reference: the sketch's original mapf math, with the same deadband and rate limit
+struct RefBarrel {
+    float R; int epMin, epMax; bool rev; float level0, pos0, pos;
+    float level(float pitchDeg) { return rev ? mapf(pitchDeg, R, -R, epMin, epMax) : mapf(pitchDeg, -R, R, epMin, epMax); }
+    void ref(float pitchDeg, float p) { level0 = level(pitchDeg); pos0 = pos = p; }
+    bool update(float pitchDeg) {
+        float t = pos0 + (level0 - level(pitchDeg));
+        t = fminf(fmaxf(t, epMin), epMax);
+        if (fabsf(t - pos) <= BARREL_STAB_DEADBAND_uS) return false;
+        pos += fmaxf(-BARREL_STAB_MAX_STEP_uS, fminf(BARREL_STAB_MAX_STEP_uS, t - pos)); return true; }
+};
+struct RefHill {
+    float R, adj = 0;
+    float target(float pitchDeg) {
+        if (fabsf(pitchDeg) * 16 <= HILL_DEADBAND) return 0;
+        return (pitchDeg > 0 ? 1 : -1) * fabsf(mapf(fminf(fmaxf(pitchDeg, -R), R), -R, R, -400, 400)); }
+    void update(float pitchDeg) { float t = target(pitchDeg); adj += fmaxf(-HILL_MAX_STEP_uS, fminf(HILL_MAX_STEP_uS, t - adj)); }
+};
+
+int main()
+{
+    std::mt19937 rng(50);
+    int fails = 0;
+
+    // ---- 1. Static mapping, no rate limit in the way: target error against mapf, every sensitivity, a spread of end-points and pitches ----
+    double maxBarrelErr = 0, maxHillErr = 0; long n = 0;
+    for (int s = 1; s <= 100; s++)
+    for (int e = 0; e < 6; e++)
+    {
+        int epMin = 1000 - e * 50, epMax = 2000 + e * 50; bool rev = e & 1;
+        OP_Incline::setBarrelScale(s, epMin, epMax, rev);
+        OP_Incline::setHillScale(s);
+        RefBarrel rb; rb.R = 100 - (s > 99 ? 99 : s); rb.epMin = epMin; rb.epMax = epMax; rb.rev = rev;
+        RefHill rh; rh.R = 120 - s;
+        for (int k = 0; k < 400; k++)
+        {
+            int16_t p0 = (int16_t)(rng() % 1441) - 720, p1 = (int16_t)(rng() % 2881) - 1440;   // +-45 and +-90 degrees
+            int16_t base = epMin + rng() % (epMax - epMin + 1);
+            // One update from the reference, with a step small enough that neither deadband nor rate limit hides the mapping
+            OP_Incline::setBarrelReference(p0, base); rb.ref(p0 / 16.0f, base);
+            float want = rb.pos0 + (rb.level0 - rb.level(p1 / 16.0f)); want = fminf(fmaxf(want, epMin), epMax);
+            // Fixed point target: step the rate limiter until it settles
+            for (int i = 0; i < 200; i++) OP_Incline::updateBarrel(p1);
+            double err = fabs(OP_Incline::barrelPosition() - want);
+            // The deadband can leave it up to BARREL_STAB_DEADBAND_uS short, so only count what's beyond that
+            double errNoDb = err - BARREL_STAB_DEADBAND_uS; if (errNoDb < 0) errNoDb = 0;
+            if (errNoDb > maxBarrelErr) maxBarrelErr = errNoDb;
+
+            OP_Incline::resetHill(); for (int i = 0; i < 100; i++) OP_Incline::updateHill(p1);
+            double herr = fabs(OP_Incline::hillAdjust() - rh.target(p1 / 16.0f));
+            if (herr > maxHillErr) maxHillErr = herr;
+            n++;
+        }
+    }
+    printf("static mapping, %ld cases (sensitivity 1-100, 6 end-point sets incl. reversed, pitch to +-90 deg):\n", n);
+    printf("  barrel: max error vs mapf %.2f uS beyond the %d uS deadband\n  hill:   max error vs mapf %.2f uS\n", maxBarrelErr, BARREL_STAB_DEADBAND_uS, maxHillErr);
+    if (maxBarrelErr > 1.5 || maxHillErr > 1.5) { printf("FAIL static mapping\n"); fails++; }
+
+    // ---- 2. Closed loop on driving-like pitch traces at 50 Hz: fixed point vs float reference, sample by sample ----
+    double maxTrackB = 0, maxTrackH = 0, sumB = 0, sumH = 0; long samples = 0, writesFixed = 0, writesFloat = 0;
+    for (int run = 0; run < 200; run++)
+    {
+        int s = 1 + rng() % 100, epMin = 900 + rng() % 200, epMax = 1900 + rng() % 300; bool rev = rng() & 1;
+        OP_Incline::setBarrelScale(s, epMin, epMax, rev); OP_Incline::setHillScale(s);
+        RefBarrel rb; rb.R = 100 - (s > 99 ? 99 : s); rb.epMin = epMin; rb.epMax = epMax; rb.rev = rev;
+        RefHill rh; rh.R = 120 - s; OP_Incline::resetHill();
+        std::normal_distribution<float> noise(0, 0.3f);                 // Sensor noise, degrees
+        float hill = 0, hillTarget = 0; int16_t base = 1500;
+        OP_Incline::setBarrelReference(0, base); rb.ref(0, base);
+        for (int i = 0; i < 50 * 60; i++)                                // A minute of driving
+        {
+            if (i % 250 == 0) hillTarget = (float)((int)(rng() % 61) - 30);   // A new slope every 5 seconds, +-30 degrees
+            hill += fmaxf(-0.4f, fminf(0.4f, hillTarget - hill));           // Tank noses over at up to 20 deg/s
+            float bump = (rng() % 100 == 0) ? (float)((int)(rng() % 21) - 10) : 0;   // The odd bump
+            float deg = hill + noise(rng) + bump;
+            int16_t p = (int16_t)lrintf(deg * 16);                         // What the BNO055 gives us
+            if (OP_Incline::updateBarrel(p)) writesFixed++;
+            if (rb.update(p / 16.0f)) writesFloat++;
+            OP_Incline::updateHill(p); rh.update(p / 16.0f);
+            double eb = fabs(OP_Incline::barrelPosition() - rb.pos), eh = fabs(OP_Incline::hillAdjust() - rh.adj);
+            if (eb > maxTrackB) maxTrackB = eb; if (eh > maxTrackH) maxTrackH = eh; sumB += eb; sumH += eh; samples++;
+        }
+    }
+    printf("closed loop, 200 one-minute runs at 50 Hz (%ld samples, random sensitivity/end-points, noise, bumps):\n", samples);
+    printf("  barrel: fixed vs float mean %.2f uS, max %.2f uS; servo writes fixed %ld, float %ld (%.0f%% of samples)\n", sumB / samples, maxTrackB, writesFixed, writesFloat, 100.0 * writesFixed / samples);
+    printf("  hill:   fixed vs float mean %.2f uS, max %.2f uS\n", sumH / samples, maxTrackH);
+    if (maxTrackB > BARREL_STAB_DEADBAND_uS + 2 || maxTrackH > 2) { printf("FAIL tracking\n"); fails++; }
+
+    // ---- 3. Rate limit and deadband behaviour ----
+    OP_Incline::setBarrelScale(50, 1000, 2000, false); OP_Incline::setBarrelReference(0, 1500);
+    int steps = 0; while (OP_Incline::updateBarrel(-30 * 16)) { steps++; if (steps > 100) break; }
+    int barrelSteps = steps;
+    bool okRate = OP_Incline::barrelPosition() == 1800 && steps == 12;           // 300 uS at 25 per sample
+    OP_Incline::setBarrelReference(0, 1500);
+    bool okDb = !OP_Incline::updateBarrel(-1) && !OP_Incline::updateBarrel(1) && OP_Incline::barrelPosition() == 1500;  // 1/16 deg = 0.6 uS
+    OP_Incline::setHillScale(50); OP_Incline::resetHill();
+    bool okHillDb = !OP_Incline::updateHill(16) && !OP_Incline::updateHill(-16) && OP_Incline::hillAdjust() == 0;
+    steps = 0; while (OP_Incline::updateHill(90 * 16)) steps++;
+    bool okHillRate = OP_Incline::hillAdjust() == 400 && steps == 40;
+    OP_Incline::setBarrelScale(100, 1000, 2000, false);
+    bool okS100 = OP_Incline::barrelGain() == 128000;  // Sensitivity 100 treated as 99: 1000 uS over +-1 degree, 31.25 uS per step in Q12
+    printf("rate limit: barrel 300 uS correction in %d samples, hill 400 uS in %d samples; deadbands hold: %s; sensitivity 100 gain %ld\n", barrelSteps, steps,
+           (okDb && okHillDb) ? "yes" : "NO", (long)OP_Incline::barrelGain());
+    if (!(okRate && okDb && okHillDb && okHillRate && okS100)) { printf("FAIL behaviour %d %d %d %d %d\n", okRate, okDb, okHillDb, okHillRate, okS100); fails++; }
+
+    // ---- 4. Time per update on this host (x86, so only the ratio means anything for the ATmega) ----
+    {
+        const int N = 5000000; static int16_t trace[4096]; for (int i = 0; i < 4096; i++) trace[i] = (int16_t)(rng() % 1441) - 720;
+        OP_Incline::setBarrelScale(50, 1000, 2000, false); OP_Incline::setHillScale(50); OP_Incline::setBarrelReference(0, 1500);
+        volatile long sink = 0;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < N; i++) { int16_t p = trace[i & 4095]; sink += OP_Incline::updateBarrel(p) + OP_Incline::updateHill(p); }
+        auto t1 = std::chrono::steady_clock::now();
+        // The original float code per sample: pitch / 16.0, the barrel mapf, and the hill constrain + mapf
+        volatile float R = 50, H = 70, e0 = 1000, e1 = 2000; volatile float fsink = 0;
+        for (int i = 0; i < N; i++) { float pitch = (float)trace[i & 4095] / 16.0f;
+            int level = (int)mapf(pitch, -R, R, e0, e1); int adj = abs((int)mapf(fminf(fmaxf(pitch, -H), H), -H, H, -400, 400)); fsink += level + adj; }
+        auto t2 = std::chrono::steady_clock::now();
+        double nsFixed = std::chrono::duration<double, std::nano>(t1 - t0).count() / N, nsFloat = std::chrono::duration<double, std::nano>(t2 - t1).count() / N;
+        printf("host time per sample (barrel + hill): fixed %.2f ns, float %.2f ns (x86 has an FPU, the ATmega doesn't)\n", nsFixed, nsFloat);
+    }
+
+    printf("%s\n", fails ? "FAILED" : "ALL CHECKS PASSED");
+    return fails;
+}
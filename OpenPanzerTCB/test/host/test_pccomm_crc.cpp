@@ -0,0 +1,171 @@
+/* test_pccomm_crc.cpp  Host test for the PC link's table-driven CRC in OP_PCComm, against the bitwise calcrc it replaced
+ *
+ *  - One step of crcUpdate from every CRC value with every byte value (16,777,216 cases), against one step of the old loop. This covers
+ *    the sign-extended char path the old code took for bytes above 127.
+ *  - A million random buffers and sentences, the running CRC against calcrc over the whole buffer
+ *  - sendSentence: the bytes that go out on the serial port are the sentence, the old calcrc printed as a signed number, and a newline
+ *  - ReadData: sentences fed in byte by byte, with good and bad checksums. Lines ending in LF must be accepted or rejected exactly as the
+ *    old ParseSentence would have. Lines ending in CRLF must be accepted when the checksum is good - the old code took the index of the
+ *    newline to size the range, so it pulled the first checksum digit into the CRC and never accepted them.
+ * Returns non-zero if any check fails.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <Arduino.h>
+#define private public          // The CRC and sentence functions are private to the class
+#include "OP_PCComm/OP_PCComm.h"
+#undef private
+
+// Verbatim from OP_PCComm.cpp before the table went in
+static int16_t calcrc(char *ptr, int16_t count)
+{
+    int16_t crc;
+    uint8_t i;
+    crc = 0;
+    while (--count >= 0)
+    {
+        crc = crc ^ (int16_t) *ptr++ << 8;
+        i = 8;
+        do
+        {
+            if (crc & 0x8000)
+                crc = crc << 1 ^ 0x1021;
+            else
+                crc = crc << 1;
+        } while(--i);
+    }
+    return (crc);
+}
+
+// The range the old ParseSentence ran calcrc over: the index of the newline less the length of the last segment. Carriage returns
+// were skipped without counting toward the segment, so in a CRLF line the range takes in one character too many.
+static int oldRange(const char *d, int n)
+{
+    int seg = 0;
+    for (int l = 0; l < n; l++)
+    {
+        char c = d[l];
+        if (c == NEWLINE) return l - seg;
+        if (c == '\r') continue;
+        if (c == DELIMITER) seg = 0; else if (l < SENTENCE_BUFF - 1) seg++;
+    }
+    return -1;
+}
+
+// Stand-in core: a serial port that records what is written and plays back what we queue for it to "receive"
+static char txBuf[256]; static int txLen;
+static char rxBuf[256]; static int rxHead, rxTail;
+class CaptureSerial : public HardwareSerial { public: size_t write(uint8_t c) { if (txLen < (int)sizeof(txBuf) - 1) txBuf[txLen++] = c; txBuf[txLen] = 0; return 1; } };
+static CaptureSerial PCSerial;
+
+unsigned long millis() { return 0; }
+unsigned long micros() { return 0; }
+void delay(unsigned long) {}
+HardwareSerial Serial, Serial1, Serial2, Serial3;
+void HardwareSerial::flush() {}
+int HardwareSerial::available() { return rxHead - rxTail; }
+int HardwareSerial::read() { return rxHead == rxTail ? -1 : (uint8_t)rxBuf[rxTail++]; }
+size_t Print::print(char c) { return write(c); }
+size_t Print::print(int n, int) { char b[8]; int k = sprintf(b, "%d", n); for (int i = 0; i < k; i++) write(b[i]); return k; }
+
+static uint64_t rng = 88172645463325252ULL;
+static uint32_t r() { rng ^= rng << 13; rng ^= rng >> 7; rng ^= rng << 17; return (uint32_t)rng; }
+
+// A sentence the way the PC builds them: Command | ID | Value | - without the checksum
+static int randomSentence(char *d) { return sprintf(d, "%d|%d|%ld|", (int)(r() % 256), (int)(r() % 3000), (long)((int32_t)r() >> (r() % 31))); }
+
+static int fails = 0;
+static void check(bool ok, const char *what) { printf("  %-90s %s\n", what, ok ? "ok" : "FAIL"); if (!ok) fails++; }
+
+int main()
+{
+    long n, bad;
+    OP_PCComm::begin(NULL, NULL);
+    OP_PCComm::_serial = &PCSerial;
+
+    // 1. One step, every CRC with every byte
+    bad = n = 0;
+    for (uint32_t start = 0; start < 65536; start++)
+    {
+        for (int b = 0; b < 256; b++)
+        {
+            int16_t crc = (int16_t)start;
+            crc = crc ^ (int16_t)(char)b << 8;
+            for (uint8_t i = 8; i; i--) crc = (crc & 0x8000) ? crc << 1 ^ 0x1021 : crc << 1;
+            if ((uint16_t)crc != OP_PCComm::crcUpdate((uint16_t)start, (uint8_t)b)) bad++;
+            n++;
+        }
+    }
+    printf("%ld single steps, %ld mismatches\n", n, bad);
+    check(n == 16777216L && bad == 0, "crcUpdate matches one step of the old loop for every CRC and byte");
+
+    // 2. Whole buffers: random bytes on odd passes, sentences on even ones
+    bad = n = 0;
+    for (long t = 0; t < 1000000; t++)
+    {
+        char buf[SENTENCE_BUFF];
+        int len = r() % SENTENCE_BUFF;
+        if (t & 1) for (int i = 0; i < len; i++) buf[i] = (char)r();
+        else len = randomSentence(buf);
+        uint16_t crc = 0;
+        for (int i = 0; i < len; i++) crc = OP_PCComm::crcUpdate(crc, buf[i]);
+        if ((int16_t)crc != calcrc(buf, len)) bad++;
+        n++;
+    }
+    printf("%ld buffers, %ld mismatches\n", n, bad);
+    check(bad == 0, "running CRC matches calcrc over the whole buffer");
+
+    // 3. Outgoing sentences
+    bad = n = 0;
+    for (long t = 0; t < 100000; t++)
+    {
+        char s[SENTENCE_BUFF], expect[SENTENCE_BUFF + 8];
+        int len = randomSentence(s);
+        sprintf(expect, "%s%d\n", s, calcrc(s, len));
+        txLen = 0; txBuf[0] = 0;
+        OP_PCComm::sendSentence(s);
+        if (strcmp(txBuf, expect) != 0) { if (!bad) printf("  sent \"%s\", expected \"%s\"\n", txBuf, expect); bad++; }
+        n++;
+    }
+    printf("%ld sentences sent, %ld wrong\n", n, bad);
+    check(bad == 0, "sendSentence writes the sentence, the old calcrc as a signed number, and a newline");
+
+    // 4. Incoming sentences. One in eight has a random (almost certainly wrong) checksum, one in four ends in CRLF.
+    long lf = 0, lfBad = 0, crlf = 0, crlfBad = 0, crlfOldAccepted = 0, crlfRejected = 0;
+    for (long t = 0; t < 1000000; t++)
+    {
+        char d[SENTENCE_BUFF + 8];
+        int len = randomSentence(d);
+        int16_t good = calcrc(d, len);
+        int16_t sent = (r() % 8) ? good : (int16_t)r();
+        boolean cr = (r() % 4 == 0);
+        len += sprintf(d + len, "%d%s\n", sent, cr ? "\r" : "");
+        boolean oldAccepted = (sent == calcrc(d, oldRange(d, len)));
+
+        memcpy(rxBuf, d, len); rxHead = len; rxTail = 0;
+        boolean accepted = OP_PCComm::ReadData();
+        if (rxTail != rxHead) { printf("  ReadData left bytes unread\n"); fails++; break; }
+
+        if (cr)
+        {
+            crlf++;
+            if (accepted != (sent == good)) crlfBad++;
+            if (oldAccepted) crlfOldAccepted++;
+            if (sent == good && !oldAccepted) crlfRejected++;
+        }
+        else
+        {
+            lf++;
+            if (accepted != oldAccepted) lfBad++;
+        }
+    }
+    printf("%ld LF sentences received, %ld decided differently from the old code\n", lf, lfBad);
+    printf("%ld CRLF sentences received, %ld decided wrongly; the old code accepted %ld and turned away %ld good ones\n", crlf, crlfBad, crlfOldAccepted, crlfRejected);
+    check(lf > 0 && lfBad == 0, "LF lines: accepted and rejected exactly as before");
+    check(crlf > 0 && crlfBad == 0, "CRLF lines: accepted when the checksum is good, rejected when it isn't");
+    check(crlfRejected > 0, "CRLF lines: the old code rejected good ones (the behaviour that changed)");
+
+    printf("%s\n", fails ? "FAILURES" : "all checks passed");
+    return fails;
+}
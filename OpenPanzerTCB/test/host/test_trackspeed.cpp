@@ -0,0 +1,134 @@
+/* test_trackspeed.cpp  Host test for OP_TrackSpeed, the closed-loop track speed PI controller, against a simulated motor and encoder
+ * 
+ * Each track is a first-order motor model with friction, driving an encoder whose edges toggle the PINK bits and call the pin change 
+ * interrupt just as the real encoders do. The right track is 15% weaker than the left. The sketch calls update() every 0.7 to 1.6 mS, 
+ * like the main loop. Each run lasts 9 seconds: a step to the commanded speed on a fresh 8.2 V battery, then the battery sags to 6.8 V, 
+ * then both tracks take a 20% load. The same run is done open loop (command straight to the motors) and closed loop, and the checks are 
+ * on the steady speed error in each phase, the rise time and overshoot of the step, and how far the two tracks drift apart. 
+ * 
+ * "./test_trackspeed" runs the checks. "./test_trackspeed cmd [Kp Ki [speed cut %]]" just prints one open/closed pair, for tuning. 
+ * Returns non-zero if any check fails. 
+ */
+#include <stdio.h>
+#include <math.h>
+#include <Arduino.h>
+#include "OP_TrackSpeed/OP_TrackSpeed.h"
+
+static uint64_t simUs = 0;
+unsigned long millis() { return (unsigned long)(simUs / 1000); }
+unsigned long micros() { return (unsigned long)simUs; }
+volatile uint8_t SREG, PINK, PCMSK2, PCICR, PCIFR;
+extern "C" void PCINT2_vect_isr(void);
+
+static uint64_t rng = 88172645463325252ULL;
+static double urand() { rng ^= rng << 13; rng ^= rng >> 7; rng ^= rng << 17; return (rng >> 11) * (1.0 / 9007199254740992.0); }
+
+// Motor: first-order, speed in encoder edges/s. Full command at 7.4 V and no load = 1000 edges/s. Below ~8% of the supply it doesn't turn (friction).
+struct Motor { double w, phase, strength; int bit; };
+static double Vbatt = 7.4, load[2] = { 0, 0 };
+static const double TAU = 0.12, FRICTION = 0.08, FULLCPS = 1000;
+static void plant(Motor &m, int track, double u, double dt)
+{
+    double drive = fabs(u) / 255.0 * Vbatt / 7.4 * m.strength;
+    double wss = drive > FRICTION ? (drive - FRICTION) / (1 - FRICTION) * FULLCPS - load[track] : 0;
+    if (wss < 0) wss = 0;
+    m.w += (wss - m.w) * dt / TAU;
+    m.phase += m.w * dt;
+    while (m.phase >= 1) { m.phase -= 1; PINK ^= (1 << m.bit); if (PCICR) PCINT2_vect_isr(); }
+}
+
+struct Result { double rise90, overshoot, errStep, errSag, errLoad, drift, isrPerSec; };
+
+static int cutPct = 100;
+static Result run(bool closed, int kp, int ki, int cmd)
+{
+    OP_TrackSpeed ts;
+    simUs = 1000000; PINK = 0xFF; PCICR = 0; PCMSK2 = 0;
+    if (closed) { ts.begin(1000, kp, ki); ts.setMaxSpeedPct(cutPct); }
+    Motor m[2] = { { 0, 0, 1.0, 1 }, { 0, 0, 0.85, 0 } };       // right track 15% weaker (gearbox friction, worn motor...)
+    Vbatt = 8.2; load[0] = load[1] = 0;
+    double out[2] = { 0, 0 }, target = cmd / 255.0 * FULLCPS * cutPct / 100.0, dist[2] = { 0, 0 };
+    Result r = { -1, 0, 0, 0, 0, 0, 0 };
+    double errAcc[3] = { 0 }; int errN[3] = { 0 }; long isr = 0;
+    uint64_t t0 = simUs, nextLoop = simUs; double maxW = 0;
+    // 0-3 s: step to cmd on fresh battery. 3-6 s: battery sags to 6.8 V. 6-9 s: both tracks hit 20% load (grass, slope)
+    while (simUs < t0 + 9000000)
+    {
+        double t = (simUs - t0) / 1e6;
+        if (t >= 3) Vbatt = 6.8;
+        if (t >= 6) load[0] = load[1] = 0.2 * FULLCPS;
+        if (simUs >= nextLoop)
+        {
+            int c = cmd;
+            if (closed)
+            {
+                if (ts.update(c, c)) { out[0] = ts.output(TRACK_LEFT); out[1] = ts.output(TRACK_RIGHT); }
+            }
+            else { out[0] = c; out[1] = c; }
+            nextLoop += 700 + (uint64_t)(urand() * 900);        // main loop 0.7 - 1.6 mS
+        }
+        for (int k = 0; k < 2; k++) { uint8_t before = PINK; plant(m[k], k, out[k] * cutPct / 100.0, 10e-6); if (PINK != before) isr++; dist[k] += m[k].w * 10e-6; }
+        // Metrics on the left track (the one at nominal strength), averaged over the last second of each phase
+        if (r.rise90 < 0 && m[0].w >= 0.9 * target) r.rise90 = t;       // (never set if it can't get there)
+        if (t < 3 && m[0].w > maxW) maxW = m[0].w;
+        int ph = t >= 2 && t < 3 ? 0 : t >= 5 && t < 6 ? 1 : t >= 8 ? 2 : -1;
+        if (ph >= 0) { errAcc[ph] += (m[0].w - target) / target * 100; errN[ph]++; }
+        simUs += 10;
+    }
+    r.overshoot = (maxW - target) / target * 100;
+    r.errStep = errAcc[0] / errN[0]; r.errSag = errAcc[1] / errN[1]; r.errLoad = errAcc[2] / errN[2];
+    r.drift = (dist[0] - dist[1]) / dist[0] * 100;       // difference in distance left vs right, % of left
+    r.isrPerSec = isr / 9.0;
+    return r;
+}
+
+static void print(const char *what, int cmd, int kp, int ki, const Result &r)
+{
+    printf("%-6s cmd %3d Kp %2d Ki %2d cut %3d%% | rise to 90%% %6.3f s  overshoot %+5.1f%% | speed error: 8.2V %+6.1f%%  6.8V %+6.1f%%  6.8V+load %+6.1f%% | L/R distance diff %+5.1f%% | edges/s %.0f\n",
+           what, cmd, kp, ki, cutPct, r.rise90, r.overshoot, r.errStep, r.errSag, r.errLoad, r.drift, r.isrPerSec);
+}
+
+static int fails = 0;
+static void check(bool ok, const char *what) { printf("  %-70s %s\n", what, ok ? "ok" : "FAIL"); if (!ok) fails++; }
+
+int main(int argc, char **argv)
+{
+    const int kp = DEFAULT_SPEED_LOOP_KP, ki = DEFAULT_SPEED_LOOP_KI;
+    if (argc > 1)
+    {   // Tuning: one open/closed pair with whatever the command line asks for
+        int cmd = atoi(argv[1]), p = argc > 2 ? atoi(argv[2]) : kp, i = argc > 3 ? atoi(argv[3]) : ki;
+        cutPct = argc > 4 ? atoi(argv[4]) : 100;
+        print("open", cmd, p, i, run(false, p, i, cmd));
+        print("closed", cmd, p, i, run(true, p, i, cmd));
+        return 0;
+    }
+
+    // Low and mid speed: the motors have headroom in every phase, so the loop should hold the speed and keep the tracks together
+    const int cmds[2] = { 64, 128 };
+    for (int k = 0; k < 2; k++)
+    {
+        Result o = run(false, kp, ki, cmds[k]), c = run(true, kp, ki, cmds[k]);
+        print("open", cmds[k], kp, ki, o); print("closed", cmds[k], kp, ki, c);
+        check(c.rise90 >= 0 && c.rise90 < 0.2, "closed: reaches 90% of the set speed within 200 mS");
+        check(c.overshoot < 10, "closed: overshoot under 10%");
+        check(fabs(c.errStep) < 2 && fabs(c.errSag) < 2 && fabs(c.errLoad) < 2, "closed: speed within 2% on a fresh battery, a flat one, and under load");
+        check(fabs(c.drift) < 2, "closed: tracks within 2% of each other, though one motor is 15% weaker");
+        check(fabs(o.errLoad) > 10 && fabs(o.drift) > 10, "open: the same run is well off (so the plant really does sag and drift)");
+    }
+
+    // Near full speed, and with a 50% speed cut: once the load is on, the motors can't reach the set speed even at full output. The loop 
+    // must still hold speed where it can, and do better than open loop where it can't. 
+    const int cuts[2] = { 100, 50 };
+    for (int k = 0; k < 2; k++)
+    {
+        cutPct = cuts[k];
+        Result o = run(false, kp, ki, 200), c = run(true, kp, ki, 200);
+        print("open", 200, kp, ki, o); print("closed", 200, kp, ki, c);
+        check(fabs(c.errStep) < 2 && fabs(c.errSag) < 2, "closed: speed within 2% while there is headroom");
+        check(fabs(c.errLoad) < fabs(o.errLoad) && fabs(c.drift) < fabs(o.drift), "closed: out of headroom, still closer to the set speed than open loop");
+    }
+    cutPct = 100;
+
+    printf("%s\n", fails ? "FAILURES" : "all checks passed");
+    return fails;
+}